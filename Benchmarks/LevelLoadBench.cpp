@@ -0,0 +1,221 @@
+#include "LevelFile.h"
+#include "LevelFileWriter.h"
+#include <raylib.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+    Level load time for a large generated level (default 1024 x 1024
+    tiles plus 16k spawns), loaded three ways:
+
+        construct    read the file into memory, then build a Rectangle
+                     per solid tile and an object per spawn (what a
+                     hardcoded or parsed layout costs)
+        mmap-open    LevelFile::b_Open: map, validate tables, done
+        mmap-scan    b_Open, then read every tile and spawn in place
+
+    mmap-open is the fixed cost a map pays before play starts; mmap-scan
+    bounds what touching the whole level costs, which is memory/I/O
+    bandwidth rather than allocation. The first run of each mode is a
+    discarded warm-up, so all modes read from a hot OS file cache.
+
+    Usage: level_bench [width] [height] [runs]
+*/
+
+using Clock = std::chrono::steady_clock;
+
+struct t_BuiltTile
+{
+    Rectangle rect;
+    int32_t type;
+};
+
+struct t_BuiltSpawn
+{
+    std::string type;
+    Vector2 position;
+    float param_a;
+    float param_b;
+};
+
+static double s_fMedian(std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+static double s_fElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Rolling terrain: solid below a wavy surface, with sparse floating platforms
+static bool s_bfBuildLevel(const std::string& out_path, uint32_t width, uint32_t height)
+{
+    std::vector<uint16_t> tiles(static_cast<size_t>(width) * height, c_LEVEL_TILE_EMPTY);
+    for (uint32_t x = 0; x < width; ++x)
+    {
+        const uint32_t SURFACE = height / 2 + (x * 7919u) % (height / 8 + 1);
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            const bool b_Platform = (y % 37 == 0) && ((x / 5) % 3 == 0);
+            if (y >= SURFACE || b_Platform)
+            {
+                tiles[static_cast<size_t>(y) * width + x] = static_cast<uint16_t>(1 + (x + y) % 16);
+            }
+        }
+    }
+
+    LevelFileWriter writer;
+    writer.SetTileSize(32.0f);
+    writer.AddLayer("ground", width, height, 0.0f, 0.0f, std::move(tiles));
+    for (uint32_t i = 0; i < 16384; ++i)
+    {
+        const float X = static_cast<float>((i * 2654435761u) % width) * 32.0f;
+        writer.AddSpawn(i % 4 == 0 ? "player" : "slime", X, 0.0f, X - 100.0f, X + 100.0f);
+    }
+
+    std::string error;
+    if (!writer.b_Write(out_path, error))
+    {
+        std::cerr << "[Bench] Failed to write " << out_path << ": " << error << "\n";
+        return false;
+    }
+    return true;
+}
+
+static double s_fTimeConstruct(const std::string& path, size_t& out_checksum)
+{
+    const auto START = Clock::now();
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    std::vector<unsigned char> bytes(static_cast<size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+    LevelFile level;
+    level.b_OpenBuffer(std::move(bytes), path);
+
+    std::vector<t_BuiltTile> tiles;
+    std::vector<t_BuiltSpawn> spawns;
+    for (const t_LevelLayer& LAYER : level.GetLayers())
+    {
+        const std::span<const uint16_t> IDS = level.GetTiles(LAYER);
+        for (size_t i = 0; i < IDS.size(); ++i)
+        {
+            if (IDS[i] != c_LEVEL_TILE_EMPTY)
+            {
+                const float X = LAYER.origin_x + static_cast<float>(i % LAYER.width) * level.GetTileSize();
+                const float Y = LAYER.origin_y + static_cast<float>(i / LAYER.width) * level.GetTileSize();
+                tiles.push_back({ { X, Y, level.GetTileSize(), level.GetTileSize() }, IDS[i] });
+            }
+        }
+    }
+    for (const t_LevelSpawn& SPAWN : level.GetSpawns())
+    {
+        spawns.push_back
+        ({
+            std::string(level.GetSpawnType(SPAWN)), { SPAWN.x, SPAWN.y }, SPAWN.param_a, SPAWN.param_b
+        });
+    }
+
+    const double ELAPSED_MS = s_fElapsedMs(START);
+    out_checksum = tiles.size() + spawns.size();
+    return ELAPSED_MS;
+}
+
+static double s_fTimeMapped(const std::string& path, bool b_Scan, size_t& out_checksum)
+{
+    const auto START = Clock::now();
+
+    LevelFile level;
+    level.b_Open(path);
+
+    size_t checksum = level.GetLayers().size() + level.GetSpawns().size();
+    if (b_Scan)
+    {
+        checksum = 0;
+        for (const t_LevelLayer& LAYER : level.GetLayers())
+        {
+            for (const uint16_t ID : level.GetTiles(LAYER))
+            {
+                checksum += ID != c_LEVEL_TILE_EMPTY;
+            }
+        }
+        for (const t_LevelSpawn& SPAWN : level.GetSpawns())
+        {
+            checksum += !level.GetSpawnType(SPAWN).empty();
+        }
+    }
+
+    const double ELAPSED_MS = s_fElapsedMs(START);
+    out_checksum = checksum;
+    return ELAPSED_MS;
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t WIDTH = argc > 1 ? static_cast<uint32_t>(std::max(8, std::stoi(argv[1]))) : 1024;
+    const uint32_t HEIGHT = argc > 2 ? static_cast<uint32_t>(std::max(8, std::stoi(argv[2]))) : 1024;
+    const int RUNS = argc > 3 ? std::max(1, std::stoi(argv[3])) : 15;
+
+    const fs::path TEMP_DIR = fs::temp_directory_path() / "raywaves_level_bench";
+    fs::create_directories(TEMP_DIR);
+    const std::string LEVEL_PATH = (TEMP_DIR / "bench.rwl").string();
+
+    if (!s_bfBuildLevel(LEVEL_PATH, WIDTH, HEIGHT))
+    {
+        return 1;
+    }
+
+    const uint64_t TILE_COUNT = static_cast<uint64_t>(WIDTH) * HEIGHT;
+    const double FILE_MB = static_cast<double>(fs::file_size(LEVEL_PATH)) / (1024.0 * 1024.0);
+
+    std::cout << "\n" << TILE_COUNT << " tiles (" << WIDTH << " x " << HEIGHT << "), "
+              << std::fixed << std::setprecision(1) << FILE_MB << " MB, "
+              << RUNS << " runs per mode\n\n";
+    std::cout << std::left << std::setw(14) << "mode"
+              << std::right << std::setw(12) << "median ms"
+              << std::setw(10) << "min ms"
+              << std::setw(10) << "max ms"
+              << std::setw(12) << "MB/s"
+              << std::setw(12) << "checksum" << "\n";
+
+    const char* MODE_NAMES[] = { "construct", "mmap-open", "mmap-scan" };
+    for (int mode = 0; mode < 3; ++mode)
+    {
+        size_t checksum = 0;
+        auto run_once = [&]()
+        {
+            return mode == 0
+                ? s_fTimeConstruct(LEVEL_PATH, checksum)
+                : s_fTimeMapped(LEVEL_PATH, mode == 2, checksum);
+        };
+
+        run_once();
+
+        std::vector<double> samples;
+        for (int run = 0; run < RUNS; ++run)
+        {
+            samples.push_back(run_once());
+        }
+
+        const double MEDIAN = s_fMedian(samples);
+        std::cout << std::left << std::setw(14) << MODE_NAMES[mode]
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << MEDIAN
+                  << std::setw(10) << *std::min_element(samples.begin(), samples.end())
+                  << std::setw(10) << *std::max_element(samples.begin(), samples.end())
+                  << std::setw(12) << std::setprecision(0) << FILE_MB / (MEDIAN / 1000.0)
+                  << std::setw(12) << checksum << "\n";
+    }
+
+    fs::remove_all(TEMP_DIR);
+    return 0;
+}
@@ -0,0 +1,192 @@
+#include "GameEditor.h"
+#include <raylib.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+    Edit-to-play latency of a GameLogic hot reload, split into phases:
+
+        copy          creating the shadow file in LoadDll (reflink,
+                      hardlink or full copy)
+        load          LoadLibrary / dlopen of the copy
+        symbol        GetDllSymbol("CreateGameMap")
+        create        CreateGameMap() and logic module registration
+        initialize    MapManager::Initialize (via SetMapManager)
+        restore       reload state and asset handoff (--keep-state only)
+        first frame   end of the load until the next editor frame is
+                      presented
+        total         b_ReloadGameLogic start to that frame
+
+    Each run rewrites the library, as a rebuild would, calls
+    GameEditor::b_ReloadGameLogic and runs editor frames until the reload
+    has been presented. The editor runs in a hidden window with the frame
+    limiter off, so "first frame" is render cost rather than vsync wait.
+    The first run is a discarded warm-up.
+
+    With an SLO the benchmark fails (exit code 1) when the p95 total is
+    above it, so it can gate iteration speed in CI.
+
+    Usage: reload_bench [runs] [slo_ms] [--keep-state]
+*/
+
+// Nearest-rank percentile of sorted samples
+static double s_fPercentile(const std::vector<double>& sorted, double percent)
+{
+    const size_t RANK = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(RANK, 1, sorted.size()) - 1];
+}
+
+int main(int argc, char** argv)
+{
+    int runs = 50;
+    double slo_ms = 0.0;
+    bool b_KeepState = false;
+
+    int positional = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--keep-state") == 0)
+        {
+            b_KeepState = true;
+        }
+        else if (positional++ == 0)
+        {
+            runs = std::max(1, std::stoi(argv[i]));
+        }
+        else
+        {
+            slo_ms = std::stod(argv[i]);
+        }
+    }
+
+    if (!fs::exists(c_GAME_LOGIC_LIBRARY))
+    {
+        std::cerr << "[Bench] " << c_GAME_LOGIC_LIBRARY << " not found; run from the build directory" << "\n";
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+
+    GameEditor editor;
+    editor.Init(1280, 720, "reload_bench");
+    SetTargetFPS(0);
+
+    if (!editor.b_LoadGameLogic(c_GAME_LOGIC_LIBRARY))
+    {
+        std::cerr << "[Bench] Failed to load " << c_GAME_LOGIC_LIBRARY << "\n";
+        return 1;
+    }
+    editor.b_IsPlaying = true;
+    editor.RunFrame();
+
+    auto reload_once = [&](GameEditor::t_ReloadTimings& out)
+    {
+        // Rewrite the library the way a linker does: a new file renamed over
+        // the old one. Touching it would keep the inode dlopen already has
+        // loaded; writing it in place would corrupt a hardlinked shadow
+        const fs::path TEMP_PATH = std::string(c_GAME_LOGIC_LIBRARY) + ".bench";
+        std::error_code ec;
+        fs::copy_file(c_GAME_LOGIC_LIBRARY, TEMP_PATH, fs::copy_options::overwrite_existing, ec);
+        if (!ec)
+        {
+            fs::rename(TEMP_PATH, c_GAME_LOGIC_LIBRARY, ec);
+        }
+        if (ec)
+        {
+            std::cerr << "[Bench] Failed to rewrite " << c_GAME_LOGIC_LIBRARY << ": " << ec.message() << "\n";
+            return false;
+        }
+
+        if (!editor.b_ReloadGameLogic(b_KeepState))
+        {
+            return false;
+        }
+        while (editor.b_IsReloadFramePending())
+        {
+            editor.RunFrame();
+        }
+        out = editor.GetLastReloadTimings();
+        return true;
+    };
+
+    GameEditor::t_ReloadTimings timings;
+    if (!reload_once(timings))
+    {
+        std::cerr << "[Bench] Reload failed" << "\n";
+        return 1;
+    }
+
+    struct t_PhaseSamples
+    {
+        const char* name;
+        double GameEditor::t_ReloadTimings::* field;
+        std::vector<double> samples;
+    };
+
+    std::vector<t_PhaseSamples> phases =
+    {
+        { "copy", &GameEditor::t_ReloadTimings::copy_ms, {} },
+        { "load", &GameEditor::t_ReloadTimings::load_ms, {} },
+        { "symbol", &GameEditor::t_ReloadTimings::symbol_ms, {} },
+        { "create", &GameEditor::t_ReloadTimings::create_ms, {} },
+        { "initialize", &GameEditor::t_ReloadTimings::initialize_ms, {} },
+        { "restore", &GameEditor::t_ReloadTimings::restore_ms, {} },
+        { "first frame", &GameEditor::t_ReloadTimings::first_frame_ms, {} },
+        { "total", &GameEditor::t_ReloadTimings::total_ms, {} },
+    };
+
+    for (int run = 0; run < runs; ++run)
+    {
+        if (!reload_once(timings))
+        {
+            std::cerr << "[Bench] Reload failed on run " << run << "\n";
+            return 1;
+        }
+        for (t_PhaseSamples& phase : phases)
+        {
+            phase.samples.push_back(timings.*phase.field);
+        }
+    }
+
+    std::cout << "\n" << runs << " reloads of " << c_GAME_LOGIC_LIBRARY
+              << (b_KeepState ? " (keeping state)" : "") << "\n\n";
+    std::cout << std::left << std::setw(14) << "phase"
+              << std::right << std::setw(10) << "p50 ms"
+              << std::setw(10) << "p90 ms"
+              << std::setw(10) << "p95 ms"
+              << std::setw(10) << "p99 ms"
+              << std::setw(10) << "max ms" << "\n";
+
+    double total_p95 = 0.0;
+    for (t_PhaseSamples& phase : phases)
+    {
+        std::sort(phase.samples.begin(), phase.samples.end());
+        std::cout << std::left << std::setw(14) << phase.name
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(10) << s_fPercentile(phase.samples, 50.0)
+                  << std::setw(10) << s_fPercentile(phase.samples, 90.0)
+                  << std::setw(10) << s_fPercentile(phase.samples, 95.0)
+                  << std::setw(10) << s_fPercentile(phase.samples, 99.0)
+                  << std::setw(10) << phase.samples.back() << "\n";
+        if (phase.field == &GameEditor::t_ReloadTimings::total_ms)
+        {
+            total_p95 = s_fPercentile(phase.samples, 95.0);
+        }
+    }
+
+    if (slo_ms > 0.0)
+    {
+        const bool b_Met = total_p95 <= slo_ms;
+        std::cout << "\nSLO: p95 total " << total_p95 << " ms "
+                  << (b_Met ? "<= " : "> ") << slo_ms << " ms ("
+                  << (b_Met ? "met" : "MISSED") << ")" << "\n";
+        return b_Met ? 0 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include "AssetManager.h"
+#include "AssetPackWriter.h"
+#include <raylib.h>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+    Time to first frame for the game's textures, loaded four ways:
+
+        loose-png    raylib LoadTexture on the loose PNGs (editor path)
+        pack-png     Assets.pak holding the original PNG bytes
+        pack-raw     Assets.pak with pre-decoded pixels (zero-copy upload)
+        pack-raw-lz  pre-decoded pixels, LZ-compressed
+
+    Each run mounts the pack, loads every texture, draws them once and
+    presents the frame. The first run of each mode is a discarded warm-up
+    so all modes read from a hot OS file cache.
+
+    Usage: texture_bench [assets_dir] [runs]
+*/
+
+using Clock = std::chrono::steady_clock;
+
+struct t_BenchMode
+{
+    const char* name;
+    std::string pack_path;     // empty = loose files
+};
+
+static double s_fMedian(std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+static bool s_bfBuildPack
+(
+    const std::vector<std::string>& textures,
+    const std::string& out_path,
+    bool b_PreDecode,
+    bool b_Compress
+)
+{
+    AssetPackWriter writer;
+    writer.SetTextureConversion(b_PreDecode);
+    writer.SetCompression(b_Compress);
+    for (const std::string& PATH : textures)
+    {
+        writer.AddFile(PATH, PATH);
+    }
+
+    std::string error;
+    t_PackWriteStats stats;
+    if (!writer.b_Write(out_path, error, &stats))
+    {
+        std::cerr << "[Bench] Failed to write " << out_path << ": " << error << "\n";
+        return false;
+    }
+
+    std::cout << "[Bench] " << out_path << ": " << stats.file_count << " textures, "
+              << stats.stored_bytes / 1024 << " KB" << "\n";
+    return true;
+}
+
+// Milliseconds from "mount" to the first presented frame
+static double s_fTimeFirstFrame
+(
+    const t_BenchMode& mode,
+    const std::vector<std::string>& textures
+)
+{
+    const auto START = Clock::now();
+
+    AssetManager assets;
+    if (!mode.pack_path.empty())
+    {
+        assets.b_MountPack(mode.pack_path);
+    }
+
+    std::vector<Texture2D> loaded;
+    loaded.reserve(textures.size());
+    for (const std::string& PATH : textures)
+    {
+        loaded.push_back(assets.LoadTexture(PATH.c_str()));
+    }
+
+    BeginDrawing();
+    ClearBackground(BLACK);
+    for (const Texture2D& TEXTURE : loaded)
+    {
+        DrawTexture(TEXTURE, 0, 0, WHITE);
+    }
+    EndDrawing();
+
+    const double ELAPSED_MS =
+        std::chrono::duration<double, std::milli>(Clock::now() - START).count();
+
+    for (const Texture2D& TEXTURE : loaded)
+    {
+        UnloadTexture(TEXTURE);
+    }
+    return ELAPSED_MS;
+}
+
+int main(int argc, char** argv)
+{
+    const fs::path ASSETS_DIR = argc > 1 ? argv[1] : "Assets";
+    const int RUNS = argc > 2 ? std::max(1, std::stoi(argv[2])) : 15;
+
+    // Same keys the game uses, e.g. "Assets/tileset.png"
+    std::vector<std::string> textures;
+    for (const auto& ENTRY : fs::directory_iterator(ASSETS_DIR))
+    {
+        if (ENTRY.is_regular_file() && ENTRY.path().extension() == ".png")
+        {
+            textures.push_back(ENTRY.path().generic_string());
+        }
+    }
+    std::sort(textures.begin(), textures.end());
+
+    if (textures.empty())
+    {
+        std::cerr << "[Bench] No .png files in " << ASSETS_DIR << "\n";
+        return 1;
+    }
+
+    const fs::path TEMP_DIR = fs::temp_directory_path() / "raywaves_texture_bench";
+    fs::create_directories(TEMP_DIR);
+
+    std::vector<t_BenchMode> modes =
+    {
+        { "loose-png", "" },
+        { "pack-png", (TEMP_DIR / "png.pak").string() },
+        { "pack-raw", (TEMP_DIR / "raw.pak").string() },
+        { "pack-raw-lz", (TEMP_DIR / "raw_lz.pak").string() },
+    };
+
+    if (!s_bfBuildPack(textures, modes[1].pack_path, false, false) ||
+        !s_bfBuildPack(textures, modes[2].pack_path, true, false) ||
+        !s_bfBuildPack(textures, modes[3].pack_path, true, true))
+    {
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(320, 240, "texture_bench");
+
+    std::cout << "\n" << textures.size() << " textures, " << RUNS << " runs per mode\n\n";
+    std::cout << std::left << std::setw(14) << "mode"
+              << std::right << std::setw(12) << "median ms"
+              << std::setw(10) << "min ms"
+              << std::setw(10) << "max ms"
+              << std::setw(10) << "vs png" << "\n";
+
+    double baseline_ms = 0.0;
+    for (const t_BenchMode& MODE : modes)
+    {
+        s_fTimeFirstFrame(MODE, textures);
+
+        std::vector<double> samples;
+        for (int run = 0; run < RUNS; ++run)
+        {
+            samples.push_back(s_fTimeFirstFrame(MODE, textures));
+        }
+
+        const double MEDIAN = s_fMedian(samples);
+        if (baseline_ms == 0.0)
+        {
+            baseline_ms = MEDIAN;
+        }
+
+        std::cout << std::left << std::setw(14) << MODE.name
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << MEDIAN
+                  << std::setw(10) << *std::min_element(samples.begin(), samples.end())
+                  << std::setw(10) << *std::max_element(samples.begin(), samples.end())
+                  << std::setw(9) << baseline_ms / MEDIAN << "x" << "\n";
+    }
+
+    CloseWindow();
+    fs::remove_all(TEMP_DIR);
+    return 0;
+}
@@ -69,8 +69,9 @@ if (Test-Path "$BuildPath/main.exe") {
     Copy-Item "$BuildPath/main.exe" "$DistPath/editor.exe" -Force
 }
 
-# Copy GameLogic DLL to root
+# Copy GameLogic DLL and its logic modules to root
 Copy-Item "$BuildPath/GameLogic.dll" "$DistPath/" -Force
+Copy-Item "$BuildPath/GameLogic_*.dll" "$DistPath/" -Force
 
 # Copy raylib files to raylib folder structure
 Copy-Item "$BuildPath/raylib.dll" "$DistPath/raylib/bin/" -Force
@@ -0,0 +1,576 @@
+#include "ExportPipeline.h"
+#include "CVar.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+// Read when an export starts
+static CVar<int32_t> s_ExportJobs
+(
+    "export.jobs",
+    0,
+    0,
+    256,
+    "Threads that hash, copy and convert files during export (0 = one per core)",
+    CVarFlags::Archive
+);
+
+static constexpr std::string_view c_MANIFEST_HEADER = "RWEXPORT 1";
+
+/*
++--------------------------------------------------------+
+|                     CONTENT HASH                       |
++--------------------------------------------------------+
+*/
+
+static constexpr uint64_t c_HASH_PRIME = 0x9E3779B97F4A7C15ull;
+
+static uint64_t s_fMix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+static uint64_t s_fCombine(uint64_t hash, uint64_t value)
+{
+    return s_fMix(std::rotl(hash, 31) * c_HASH_PRIME ^ value);
+}
+
+static uint64_t s_fHashString(std::string_view text, uint64_t seed = 0)
+{
+    return HashExportBytes
+    (
+        { reinterpret_cast<const unsigned char*>(text.data()), text.size() },
+        seed
+    );
+}
+
+uint64_t HashExportBytes(std::span<const unsigned char> bytes, uint64_t seed)
+{
+    // Four independent lanes keep the multiplies from serializing, so
+    // hashing runs well ahead of the disk
+    uint64_t lanes[4] =
+    {
+        seed ^ c_HASH_PRIME,
+        seed + bytes.size(),
+        std::rotl(seed, 17) ^ 0xC2B2AE3D27D4EB4Full,
+        ~seed
+    };
+
+    size_t at = 0;
+    for (; at + 32 <= bytes.size(); at += 32)
+    {
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            uint64_t word;
+            std::memcpy(&word, bytes.data() + at + lane * 8, sizeof(word));
+            lanes[lane] = std::rotl(lanes[lane] ^ (word * c_HASH_PRIME), 29) * 0xFF51AFD7ED558CCDull;
+        }
+    }
+
+    uint64_t hash = bytes.size();
+    for (uint64_t lane : lanes)
+    {
+        hash = s_fCombine(hash, lane);
+    }
+
+    for (; at + 8 <= bytes.size(); at += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes.data() + at, sizeof(word));
+        hash = s_fCombine(hash, word);
+    }
+
+    uint64_t tail = 0;
+    if (at < bytes.size())
+    {
+        std::memcpy(&tail, bytes.data() + at, bytes.size() - at);
+    }
+    return s_fCombine(hash, tail);
+}
+
+bool b_HashExportFile(const fs::path& path, uint64_t& out_hash)
+{
+    std::error_code ec;
+    if (fs::file_size(path, ec) == 0 && !ec)
+    {
+        // MappedFile refuses empty files
+        out_hash = HashExportBytes({});
+        return true;
+    }
+
+    MappedFile file;
+    if (!file.b_Open(path.string()))
+    {
+        return false;
+    }
+    out_hash = HashExportBytes(file.GetBytes());
+    return true;
+}
+
+/*
++--------------------------------------------------------+
+|                       MANIFEST                         |
++--------------------------------------------------------+
+*/
+
+static bool s_bfParseHex(std::string_view text, uint64_t& out)
+{
+    const auto RESULT = std::from_chars(text.data(), text.data() + text.size(), out, 16);
+    return RESULT.ec == std::errc() && RESULT.ptr == text.data() + text.size();
+}
+
+void ExportManifest::Load(const fs::path& file)
+{
+    sources.clear();
+    outputs.clear();
+
+    std::ifstream in(file);
+    std::string line;
+    if (!std::getline(in, line) || line != c_MANIFEST_HEADER)
+    {
+        return;
+    }
+
+    // S <hash> <size> <write time> <path>
+    // O <hash> <size> <path>
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line);
+        std::string kind;
+        std::string hash_text;
+        uint64_t hash = 0;
+        uint64_t size = 0;
+        fields >> kind >> hash_text >> size;
+        if (!fields || !s_bfParseHex(hash_text, hash))
+        {
+            continue;
+        }
+
+        int64_t write_time = 0;
+        if (kind == "S" && !(fields >> write_time))
+        {
+            continue;
+        }
+
+        std::string path;
+        fields.get();
+        std::getline(fields, path);
+        if (path.empty())
+        {
+            continue;
+        }
+
+        if (kind == "S")
+        {
+            sources[path] = { hash, size, write_time };
+        }
+        else if (kind == "O")
+        {
+            outputs[path] = { hash, size };
+        }
+    }
+}
+
+bool ExportManifest::b_Save(const fs::path& file) const
+{
+    std::ofstream out(file, std::ios::trunc);
+    if (!out.is_open())
+    {
+        return false;
+    }
+
+    char hash_text[17];
+    auto format_hash = [&hash_text](uint64_t hash)
+    {
+        const auto RESULT = std::to_chars(hash_text, hash_text + 16, hash, 16);
+        *RESULT.ptr = '\0';
+        return hash_text;
+    };
+
+    out << c_MANIFEST_HEADER << "\n";
+    for (const auto& [PATH, SOURCE] : sources)
+    {
+        out << "S " << format_hash(SOURCE.hash) << " " << SOURCE.size << " " << SOURCE.write_time << " " << PATH << "\n";
+    }
+    for (const auto& [PATH, OUTPUT] : outputs)
+    {
+        out << "O " << format_hash(OUTPUT.hash) << " " << OUTPUT.size << " " << PATH << "\n";
+    }
+    return out.good();
+}
+
+/*
++--------------------------------------------------------+
+|                       PIPELINE                         |
++--------------------------------------------------------+
+*/
+
+// Runs job(0..count-1) on up to thread_count threads, the caller included
+static void s_fRunParallel(size_t count, size_t thread_count, const std::function<void(size_t)>& job)
+{
+    std::atomic<size_t> next_index{ 0 };
+    auto worker = [&]()
+    {
+        for (size_t index = next_index++; index < count; index = next_index++)
+        {
+            job(index);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < (std::min)(thread_count, count); ++i)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : workers)
+    {
+        thread.join();
+    }
+}
+
+ExportPipeline::ExportPipeline(fs::path export_dir)
+    : m_ExportDir(std::move(export_dir))
+{
+}
+
+size_t ExportPipeline::GetThreadCount()
+{
+    const int32_t JOBS = s_ExportJobs.Get();
+    return JOBS > 0 ? static_cast<size_t>(JOBS) : static_cast<size_t>((std::max)(1u, std::thread::hardware_concurrency()));
+}
+
+void ExportPipeline::AddCopy(const fs::path& source, std::string_view output)
+{
+    m_Copies.push_back({ source, std::string(output) });
+}
+
+void ExportPipeline::AddGenerated(std::string_view output, std::string content)
+{
+    m_Generated.push_back({ std::string(output), std::move(content) });
+}
+
+void ExportPipeline::AddDerived
+(
+    std::string_view output,
+    std::vector<fs::path> inputs,
+    std::string options_key,
+    BuildCallback build
+)
+{
+    m_Derived.push_back({ std::string(output), std::move(inputs), std::move(options_key), std::move(build) });
+}
+
+bool ExportPipeline::b_IsOutputCurrent(const std::string& output, uint64_t hash) const
+{
+    auto it = m_Previous.outputs.find(output);
+    if (it == m_Previous.outputs.end() || it->second.hash != hash)
+    {
+        return false;
+    }
+
+    // Also catches outputs deleted or edited by hand since the last export
+    std::error_code ec;
+    const uintmax_t SIZE = fs::file_size(m_ExportDir / output, ec);
+    return !ec && SIZE == it->second.size;
+}
+
+bool ExportPipeline::b_Run
+(
+    std::string& out_error,
+    t_ExportStats* out_stats,
+    const std::atomic<bool>* cancel
+)
+{
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point START = Clock::now();
+    const size_t THREAD_COUNT = GetThreadCount();
+    const fs::path MANIFEST_PATH = m_ExportDir / c_MANIFEST_FILE;
+
+    auto b_Cancelled = [cancel]()
+    {
+        return cancel && cancel->load();
+    };
+
+    m_Previous.Load(MANIFEST_PATH);
+    m_Current = {};
+
+    std::mutex mutex;
+    std::string first_error;
+    auto fail = [&](std::string error)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (first_error.empty())
+        {
+            first_error = std::move(error);
+        }
+    };
+
+    // Every distinct source, whether it is copied or feeds a derived output
+    std::vector<std::string> source_keys;
+    std::unordered_map<std::string, size_t> source_index;
+    auto add_source = [&](const fs::path& path)
+    {
+        std::string key = path.generic_string();
+        if (source_index.emplace(key, source_keys.size()).second)
+        {
+            source_keys.push_back(std::move(key));
+        }
+    };
+    for (const t_Copy& COPY : m_Copies)
+    {
+        add_source(COPY.source);
+    }
+    for (const t_Derived& DERIVED : m_Derived)
+    {
+        for (const fs::path& INPUT : DERIVED.inputs)
+        {
+            add_source(INPUT);
+        }
+    }
+
+    // Hash sources; one whose size and write time match the manifest
+    // keeps its recorded hash without being read
+    std::vector<ExportManifest::t_Source> source_records(source_keys.size());
+    std::atomic<size_t> hashed_count{ 0 };
+    std::atomic<uint64_t> hashed_bytes{ 0 };
+
+    s_fRunParallel(source_keys.size(), THREAD_COUNT, [&](size_t index)
+    {
+        if (b_Cancelled())
+        {
+            return;
+        }
+
+        const fs::path PATH = source_keys[index];
+        std::error_code ec;
+        ExportManifest::t_Source& record = source_records[index];
+        record.size = fs::file_size(PATH, ec);
+        if (!ec)
+        {
+            record.write_time = static_cast<int64_t>(fs::last_write_time(PATH, ec).time_since_epoch().count());
+        }
+        if (ec)
+        {
+            fail("Cannot read " + PATH.string());
+            return;
+        }
+
+        auto previous = m_Previous.sources.find(source_keys[index]);
+        if (previous != m_Previous.sources.end() &&
+            previous->second.size == record.size &&
+            previous->second.write_time == record.write_time)
+        {
+            record.hash = previous->second.hash;
+            return;
+        }
+
+        if (!b_HashExportFile(PATH, record.hash))
+        {
+            fail("Cannot read " + PATH.string());
+            return;
+        }
+        ++hashed_count;
+        hashed_bytes += record.size;
+    });
+
+    for (size_t i = 0; i < source_keys.size() && first_error.empty(); ++i)
+    {
+        m_Current.sources[source_keys[i]] = source_records[i];
+    }
+
+    // Copies: directories first, so the workers never race to create them
+    std::vector<size_t> stale_copies;
+    std::atomic<size_t> skipped_count{ 0 };
+    for (size_t i = 0; i < m_Copies.size() && first_error.empty(); ++i)
+    {
+        const uint64_t HASH = source_records[source_index[m_Copies[i].source.generic_string()]].hash;
+        if (b_IsOutputCurrent(m_Copies[i].output, HASH))
+        {
+            m_Current.outputs[m_Copies[i].output] = m_Previous.outputs[m_Copies[i].output];
+            ++skipped_count;
+            continue;
+        }
+
+        std::error_code ec;
+        fs::create_directories((m_ExportDir / m_Copies[i].output).parent_path(), ec);
+        stale_copies.push_back(i);
+    }
+
+    std::atomic<uint64_t> written_bytes{ 0 };
+    std::vector<ExportManifest::t_Output> copy_records(stale_copies.size());
+    std::vector<char> copied(stale_copies.size(), 0);
+
+    if (first_error.empty())
+    {
+        s_fRunParallel(stale_copies.size(), THREAD_COUNT, [&](size_t index)
+        {
+            if (b_Cancelled())
+            {
+                return;
+            }
+
+            const t_Copy& COPY = m_Copies[stale_copies[index]];
+            std::error_code ec;
+            fs::copy_file(COPY.source, m_ExportDir / COPY.output, fs::copy_options::overwrite_existing, ec);
+            if (ec)
+            {
+                fail("Cannot copy " + COPY.source.string() + ": " + ec.message());
+                return;
+            }
+
+            const ExportManifest::t_Source& SOURCE = source_records[source_index[COPY.source.generic_string()]];
+            copy_records[index] = { SOURCE.hash, SOURCE.size };
+            copied[index] = 1;
+            written_bytes += SOURCE.size;
+        });
+    }
+
+    size_t copied_count = 0;
+    for (size_t i = 0; i < stale_copies.size(); ++i)
+    {
+        if (copied[i])
+        {
+            m_Current.outputs[m_Copies[stale_copies[i]].output] = copy_records[i];
+            ++copied_count;
+        }
+    }
+
+    // Generated files are small; their hash is that of the content
+    size_t built_count = 0;
+    for (const t_Generated& GENERATED : m_Generated)
+    {
+        if (!first_error.empty() || b_Cancelled())
+        {
+            break;
+        }
+
+        const uint64_t HASH = s_fHashString(GENERATED.content);
+        if (b_IsOutputCurrent(GENERATED.output, HASH))
+        {
+            m_Current.outputs[GENERATED.output] = m_Previous.outputs[GENERATED.output];
+            ++skipped_count;
+            continue;
+        }
+
+        const fs::path OUT_PATH = m_ExportDir / GENERATED.output;
+        std::error_code ec;
+        fs::create_directories(OUT_PATH.parent_path(), ec);
+        std::ofstream out(OUT_PATH, std::ios::binary | std::ios::trunc);
+        out.write(GENERATED.content.data(), static_cast<std::streamsize>(GENERATED.content.size()));
+        if (!out.good())
+        {
+            fail("Cannot write " + OUT_PATH.string());
+            break;
+        }
+
+        m_Current.outputs[GENERATED.output] = { HASH, GENERATED.content.size() };
+        written_bytes += GENERATED.content.size();
+        ++built_count;
+    }
+
+    // Derived outputs depend on the options and on every input's path and
+    // content, so adding, removing, renaming or editing one rebuilds them
+    for (const t_Derived& DERIVED : m_Derived)
+    {
+        if (!first_error.empty() || b_Cancelled())
+        {
+            break;
+        }
+
+        // Sorted, so directory iteration order does not matter
+        std::vector<std::string> input_keys;
+        for (const fs::path& INPUT : DERIVED.inputs)
+        {
+            input_keys.push_back(INPUT.generic_string());
+        }
+        std::sort(input_keys.begin(), input_keys.end());
+
+        uint64_t hash = s_fHashString(DERIVED.options_key);
+        for (const std::string& KEY : input_keys)
+        {
+            hash = s_fCombine(hash, s_fHashString(KEY));
+            hash = s_fCombine(hash, source_records[source_index[KEY]].hash);
+        }
+
+        if (b_IsOutputCurrent(DERIVED.output, hash))
+        {
+            m_Current.outputs[DERIVED.output] = m_Previous.outputs[DERIVED.output];
+            ++skipped_count;
+            continue;
+        }
+
+        const fs::path OUT_PATH = m_ExportDir / DERIVED.output;
+        std::string error;
+        std::error_code ec;
+        fs::create_directories(OUT_PATH.parent_path(), ec);
+        if (!DERIVED.build(OUT_PATH, error))
+        {
+            fail(error.empty() ? "Cannot build " + DERIVED.output : error);
+            break;
+        }
+
+        const uintmax_t SIZE = fs::file_size(OUT_PATH, ec);
+        m_Current.outputs[DERIVED.output] = { hash, ec ? 0 : static_cast<uint64_t>(SIZE) };
+        written_bytes += ec ? 0 : SIZE;
+        ++built_count;
+    }
+
+    // Only a complete export knows the full output set; a failed one keeps
+    // the old outputs and records just what it finished
+    size_t removed_count = 0;
+    const bool b_Complete = first_error.empty() && !b_Cancelled();
+    if (b_Complete)
+    {
+        for (const auto& [OUTPUT, RECORD] : m_Previous.outputs)
+        {
+            std::error_code ec;
+            if (!m_Current.outputs.contains(OUTPUT) && fs::remove(m_ExportDir / OUTPUT, ec))
+            {
+                ++removed_count;
+            }
+        }
+    }
+
+    if (!m_Current.b_Save(MANIFEST_PATH) && first_error.empty())
+    {
+        fail("Cannot write " + MANIFEST_PATH.string());
+    }
+
+    if (out_stats)
+    {
+        out_stats->hashed_count = hashed_count;
+        out_stats->copied_count = copied_count;
+        out_stats->built_count = built_count;
+        out_stats->skipped_count = skipped_count;
+        out_stats->removed_count = removed_count;
+        out_stats->hashed_bytes = hashed_bytes;
+        out_stats->written_bytes = written_bytes;
+        out_stats->thread_count = THREAD_COUNT;
+        out_stats->seconds = std::chrono::duration<double>(Clock::now() - START).count();
+    }
+
+    if (!first_error.empty())
+    {
+        out_error = first_error;
+        return false;
+    }
+    if (b_Cancelled())
+    {
+        out_error = "Export cancelled";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,144 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// 64-bit content hash used to decide whether an export output is stale
+uint64_t HashExportBytes(std::span<const unsigned char> bytes, uint64_t seed = 0);
+bool b_HashExportFile(const fs::path& path, uint64_t& out_hash);
+
+/**
+ * @brief What the last export wrote, stored next to the exported files
+ *
+ * Sources are recorded with their size and write time, so an unchanged
+ * file is not even re-read on the next export; outputs are recorded with
+ * the hash of what produced them and their size, so a deleted or modified
+ * output is rebuilt. Plain text, one record per line.
+ */
+class ExportManifest
+{
+public:
+    struct t_Source
+    {
+        uint64_t hash = 0;
+        uint64_t size = 0;
+        int64_t write_time = 0;
+    };
+
+    struct t_Output
+    {
+        uint64_t hash = 0;
+        uint64_t size = 0;
+    };
+
+    // A missing or unreadable manifest loads as empty (everything stale)
+    void Load(const fs::path& file);
+    bool b_Save(const fs::path& file) const;
+
+    std::unordered_map<std::string, t_Source> sources;     // by absolute generic path
+    std::unordered_map<std::string, t_Output> outputs;     // by path relative to the export folder
+};
+
+struct t_ExportStats
+{
+    size_t hashed_count = 0;        // sources read because their stamp changed
+    size_t copied_count = 0;
+    size_t built_count = 0;         // generated files and derived outputs written
+    size_t skipped_count = 0;       // outputs already up to date
+    size_t removed_count = 0;       // outputs of the last export that no longer exist
+    uint64_t hashed_bytes = 0;
+    uint64_t written_bytes = 0;
+    size_t thread_count = 0;
+    double seconds = 0.0;
+};
+
+/**
+ * @brief Incremental, parallel export into one folder
+ *
+ * Every source is content-hashed and compared against the manifest of the
+ * previous export in the same folder; only outputs whose inputs changed
+ * (or that went missing) are written again. Copies run on export.jobs
+ * threads. Derived outputs such as Assets.pak depend on a list of inputs
+ * plus an options key and are rebuilt as a whole when any of them changes.
+ * Outputs the previous export wrote that are not part of this one are
+ * deleted, so removed assets do not linger in the build.
+ *
+ * Example Usage:
+ * @code
+ * ExportPipeline pipeline(export_dir);
+ * pipeline.AddCopy(current_path / "game.exe", "MyGame.exe");
+ * pipeline.AddGenerated("config.ini", config_text);
+ * pipeline.AddDerived("Assets.pak", asset_files, "lz=1", build_pack);
+ * if (!pipeline.b_Run(error, &stats, &b_Cancel)) { ... }
+ * @endcode
+ */
+class ExportPipeline
+{
+public:
+    // Writes the output to the given path; false fails the export
+    using BuildCallback = std::function<bool(const fs::path& out_path, std::string& out_error)>;
+
+    explicit ExportPipeline(fs::path export_dir);
+
+    // output is relative to the export folder, e.g. "Assets/slime.png"
+    void AddCopy(const fs::path& source, std::string_view output);
+    void AddGenerated(std::string_view output, std::string content);
+    void AddDerived
+    (
+        std::string_view output,
+        std::vector<fs::path> inputs,
+        std::string options_key,
+        BuildCallback build
+    );
+
+    bool b_Run
+    (
+        std::string& out_error,
+        t_ExportStats* out_stats = nullptr,
+        const std::atomic<bool>* cancel = nullptr
+    );
+
+    // export.jobs, with 0 resolved to one thread per core
+    static size_t GetThreadCount();
+
+    static constexpr std::string_view c_MANIFEST_FILE = "export.manifest";
+
+private:
+    struct t_Copy
+    {
+        fs::path source;
+        std::string output;
+    };
+
+    struct t_Generated
+    {
+        std::string output;
+        std::string content;
+    };
+
+    struct t_Derived
+    {
+        std::string output;
+        std::vector<fs::path> inputs;
+        std::string options_key;
+        BuildCallback build;
+    };
+
+    bool b_IsOutputCurrent(const std::string& output, uint64_t hash) const;
+
+    fs::path m_ExportDir;
+    std::vector<t_Copy> m_Copies;
+    std::vector<t_Generated> m_Generated;
+    std::vector<t_Derived> m_Derived;
+
+    ExportManifest m_Previous;
+    ExportManifest m_Current;
+};
@@ -1,6 +1,8 @@
+#include "../Engine/AssetPackWriter.h"
 #include "../Engine/MapManager.h"
 #include "../Game/DllLoader.h"
 #include "GameEditor.h"
+#include "ExportPipeline.h"
 
 using Clock = std::chrono::steady_clock;
 
@@ -25,7 +27,6 @@ GameEditor::GameEditor()
 	  m_DisplayTexture({ 0 }),
 	  m_SourceTexture({ 0 , 0 }),
 	  b_IsPlaying(false),
-	  b_IsCompiling(false),
 	  m_PlayIcon({ 0 }),
 	  m_PauseIcon({ 0 }),
 	  m_RestartIcon({ 0 }),
@@ -35,9 +36,13 @@ GameEditor::GameEditor()
 	  m_bIconsLoaded(false),
 	  m_GameLogicDll{},
 	  m_CreateGameMap(nullptr),
+	  m_LogSink(std::make_shared<MemoryLogSink>()),
+	  m_LogFileSink(std::make_shared<FileLogSink>("editor.log")),
 	  m_OpaqueShader({ 0 }),
 	  m_MapManager(nullptr)
 {
+	Logger::Get().AddSink(m_LogSink);
+	Logger::Get().AddSink(m_LogFileSink);
 }
 
 GameEditor::~GameEditor()
@@ -47,10 +52,17 @@ GameEditor::~GameEditor()
 		BEFORE unloading the DLL, otherwise vtable/function code may be gone
 		when the map's destructor runs.
 	*/
+	m_Simulation.Stop();
 	m_MapManager = nullptr; 
 	m_GameEngine.SetMap(nullptr);
 	m_GameEngine.SetMapManager(nullptr);
 
+	// The logger outlives the editor; everything logged so far still
+	// reaches editor.log
+	Logger::Get().Flush();
+	Logger::Get().RemoveSink(m_LogSink);
+	Logger::Get().RemoveSink(m_LogFileSink);
+
 	if (m_RaylibTexture.id != 0) 
 	{
 		UnloadRenderTexture(m_RaylibTexture);
@@ -80,6 +92,12 @@ GameEditor::~GameEditor()
 		m_bIconsLoaded = false;
 	}
 
+	for (t_LogicModule& module : m_LogicModules)
+	{
+		UnloadLogicModule(module);
+	}
+	m_LogicModules.clear();
+
 	if (m_GameLogicDll.handle)
 	{
 		UnloadDll(m_GameLogicDll);
@@ -99,26 +117,36 @@ void GameEditor::Init(int width, int height, std::string_view title)
 	{
 		SetWindowIcon(icon);
 		UnloadImage(icon);
-		printf("Window icon loaded successfully from Assets / icon.png\n");
+		RW_LOG_INFO("GameEditor", "Window icon loaded from Assets/EngineContent/icon.png");
 	} 
 	else
 	{
-		printf("Failed to load icon from Assets/icon.png\n");
+		RW_LOG_WARNING("GameEditor", "Failed to load icon from Assets/EngineContent/icon.png");
 	}
 	
-	rlImGuiSetup(true);
+	StartupProfiler& startup = m_GameEngine.GetStartupProfiler();
+	{
+		StartupProfiler::Scope phase(&startup, "Editor UI setup");
+		rlImGuiSetup(true);
+
+		ImGuiIO& io = ImGui::GetIO();
+		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
 
-	ImGuiIO& io = ImGui::GetIO();
-	io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+		rlImGuiReloadFonts();
 
-	rlImGuiReloadFonts();
+		SetEngineTheme();
+		LoadEditorDefaultIni();
+	}
 
-	SetEngineTheme();
-	LoadEditorDefaultIni();
+	bool b_ConfigLoaded = false;
+	{
+		StartupProfiler::Scope phase(&startup, "Config parse");
+		b_ConfigLoaded = GameConfig::GetInstance().m_bLoadFromFile("config.ini");
+	}
 
-	if (GameConfig::GetInstance().m_bLoadFromFile("config.ini"))
+	if (b_ConfigLoaded)
 	{
-		const auto& config = GameConfig::GetInstance().GetWindowConfig();
+		const t_WindowConfig config = GameConfig::GetInstance().GetWindowConfig();
 		m_SceneSettings.m_SceneWidth = config.scene_width;
 		m_SceneSettings.m_SceneHeight = config.scene_height;
 		m_SceneSettings.m_TargetFPS = config.scene_fps;
@@ -150,6 +178,8 @@ void GameEditor::Init(int width, int height, std::string_view title)
 	m_OpaqueShader = LoadOpaqueShader();
 
 	LoadIconTextures();
+
+	m_FileWatcher.WatchDirectory("Assets");
 }
 
 void GameEditor::LoadIconTextures()
@@ -252,93 +282,219 @@ void GameEditor::LoadIconTextures()
 
 void GameEditor::Run()
 {
-	while (!WindowShouldClose())
+	// Watch the original DLL path, not the shadow
+	if (!m_GameLogicPath.empty())
 	{
-		static auto s_LastReloadCheckTime = Clock::now();
+		m_FileWatcher.WatchFile(m_GameLogicPath);
+	}
+	for (const t_LogicModule& MODULE : m_LogicModules)
+	{
+		m_FileWatcher.WatchFile(MODULE.path);
+	}
+	m_FileWatcher.b_Start();
 
-		// Periodically check for GameLogic.dll changes (e.g., every 0.5s)
-		const auto CURRENT_TIME = Clock::now();
-		auto elapsed_time = std::chrono::duration<float>
-		(
-			CURRENT_TIME - s_LastReloadCheckTime
-		).count();
+	while (!WindowShouldClose())
+	{
+		RunFrame();
+	}
 
-		if (elapsed_time > 0.5f && !m_GameLogicPath.empty())
-		{
-			s_LastReloadCheckTime = CURRENT_TIME;
-			std::error_code ec;
+	// Its last asset loads need the window's GL context
+	m_Simulation.Stop();
+	Close();
+}
 
-			// cache path once per check
-			const fs::path PATH(m_GameLogicPath);
+void GameEditor::RunFrame()
+{
+	ProcessFileChanges();
 
-			auto now_write = fs::last_write_time(PATH, ec);
+	// Asset loads the simulation thread queued for this thread
+	m_GameEngine.GetAssetManager().GetRenderTasks().Pump();
 
-			if (!ec && now_write != m_LastLogicWriteTime)
-			{
-				if (m_LastLogicWriteTime != fs::file_time_type{})
-				{
-					b_ReloadGameLogic();
-				}
-				m_LastLogicWriteTime = now_write;
-			}
-		}
+	const bool b_Threaded = b_IsPlaying && SimulationThread::b_IsEnabled();
+	if (b_Threaded && !m_Simulation.b_IsRunning())
+	{
+		m_Simulation.Start(m_GameEngine);
+	}
+	else if (!b_Threaded && m_Simulation.b_IsRunning())
+	{
+		m_Simulation.Stop();
+	}
 
-		float delta_time = GetFrameTime();
-		if (b_IsPlaying)
+	float delta_time = GetFrameTime();
+	if (b_IsPlaying && !b_Threaded)
+	{
+		m_GameEngine.UpdateMap(delta_time);
+	}
+	else if (b_Threaded)
+	{
+		// Every frame, drawn or not, so the next step sees each press once
+		m_GameEngine.CaptureInput();
+	}
+	BeginDrawing();
+
+	// On the simulation thread the map is only drawn once a step has
+	// completed and it is between steps; until then the scene keeps
+	// showing the last completed frame
+	std::unique_lock<std::mutex> world;
+	bool b_DrawScene = true;
+	if (b_Threaded)
+	{
+		world = m_Simulation.TryLockNewFrame();
+		b_DrawScene = world.owns_lock();
+		if (b_DrawScene)
 		{
-			m_GameEngine.UpdateMap(delta_time);
+			m_GameEngine.BeginMapFrame();
 		}
-		BeginDrawing();
+	}
 
+	if (b_DrawScene)
+	{
 		BeginTextureMode(m_RaylibTexture);
 		ClearBackground(RAYWHITE);
 
 		m_GameEngine.DrawMap();
 		EndTextureMode();
+	}
+	if (world.owns_lock())
+	{
+		// EndFrame cannot read the map while the simulation may be stepping
+		m_GameEngine.ReportMemoryUsage();
+		world.unlock();
+	}
 
-		m_SourceTexture = m_RaylibTexture.texture;
+	m_SourceTexture = m_RaylibTexture.texture;
 
-		// Opaque pass to strip alpha before presenting via ImGui
-		if (m_bUseOpaquePass)
+	// Opaque pass to strip alpha before presenting via ImGui
+	if (m_bUseOpaquePass)
+	{
+		BeginTextureMode(m_DisplayTexture);
+		ClearBackground(BLANK);
+		BeginShaderMode(m_OpaqueShader);
+		Rectangle src = 
 		{
-			BeginTextureMode(m_DisplayTexture);
-			ClearBackground(BLANK);
-			BeginShaderMode(m_OpaqueShader);
-			Rectangle src = 
-			{
-				0, 
-				0, 
-				static_cast<float>(m_SourceTexture.width),
-				-static_cast<float>(m_SourceTexture.height)
-			};
-			DrawTextureRec(m_SourceTexture, src, { 0.0f, 0.0f }, WHITE);
-			EndShaderMode();
-			EndTextureMode();
-			m_SourceTexture = m_DisplayTexture.texture;
-		}
+			0, 
+			0, 
+			static_cast<float>(m_SourceTexture.width),
+			-static_cast<float>(m_SourceTexture.height)
+		};
+		DrawTextureRec(m_SourceTexture, src, { 0.0f, 0.0f }, WHITE);
+		EndShaderMode();
+		EndTextureMode();
+		m_SourceTexture = m_DisplayTexture.texture;
+	}
 
-		rlImGuiBegin();
+	rlImGuiBegin();
 
-		ImGui::DockSpaceOverViewport(0, m_Viewport);
+	ImGui::DockSpaceOverViewport(0, m_Viewport);
 
-		DrawMapSelectionUI();
+	DrawMapSelectionUI();
         DrawExportPanel();
-		DrawSceneSettingsPanel();
-		DrawSceneWindow();
-
-		rlImGuiEnd();
+	DrawSceneSettingsPanel();
+	DrawBuildPanel();
+	DrawLogPanel();
+	DrawCVarsPanel();
+	DrawPerformancePanel();
+	DrawSceneWindow();
+
+	rlImGuiEnd();
+	{
+		StartupProfiler::Scope phase(&m_GameEngine.GetStartupProfiler(), "First EndDrawing");
 		EndDrawing();
 	}
+	m_GameEngine.EndFrame(!m_Simulation.b_IsRunning());
 
-	Close();
+	// No-op after the first frame
+	m_GameEngine.GetStartupProfiler().Finish("startup_report.txt", "main (editor)");
+
+	// The reload is only done once its first frame is on screen
+	if (m_bReloadFramePending)
+	{
+		const auto NOW = Clock::now();
+		m_LastReloadTimings.first_frame_ms = 
+			std::chrono::duration<double, std::milli>(NOW - m_ReloadEndTime).count();
+		m_LastReloadTimings.total_ms = 
+			std::chrono::duration<double, std::milli>(NOW - m_ReloadStartTime).count();
+		m_bReloadFramePending = false;
+
+		const t_ReloadTimings& T = m_LastReloadTimings;
+		RW_LOG_INFO
+		(
+			"GameEditor",
+			"{} load timeline (ms): copy {:.2f} | load {:.2f} | symbol {:.2f} | create {:.2f} | "
+			"initialize {:.2f} | restore {:.2f} | first frame {:.2f} | total {:.2f}",
+			m_ReloadedLibrary,
+			T.copy_ms,
+			T.load_ms,
+			T.symbol_ms,
+			T.create_ms,
+			T.initialize_ms,
+			T.restore_ms,
+			T.first_frame_ms,
+			T.total_ms
+		);
+	}
+}
+
+void GameEditor::ProcessFileChanges()
+{
+	const std::string LOGIC_PATH = fs::path(m_GameLogicPath).generic_string();
+	bool b_LogicChanged = false;
+	std::vector<t_LogicModule*> changed_modules;
+
+	for (const std::string& PATH : m_FileWatcher.TakeChanges())
+	{
+		if (!LOGIC_PATH.empty() && PATH == LOGIC_PATH)
+		{
+			b_LogicChanged = true;
+			continue;
+		}
+
+		auto module = std::find_if
+		(
+			m_LogicModules.begin(),
+			m_LogicModules.end(),
+			[&](const t_LogicModule& candidate) { return fs::path(candidate.path).generic_string() == PATH; }
+		);
+		if (module != m_LogicModules.end())
+		{
+			changed_modules.push_back(&*module);
+			continue;
+		}
+
+		const auto START = Clock::now();
+		int updated = m_GameEngine.GetAssetManager().ReloadTexture(PATH);
+		if (updated == 0)
+		{
+			continue;
+		}
+
+		auto elapsed_ms = std::chrono::duration<float, std::milli>
+		(
+			Clock::now() - START
+		).count();
+
+		RW_LOG_INFO("HotReload", "{} -> {} texture(s) updated in {:.2f} ms", PATH, updated, elapsed_ms);
+	}
+
+	// The linker has closed the file by the time it is reported. A module
+	// goes first: a GameLogic reload re-registers whatever is loaded then.
+	for (t_LogicModule* module : changed_modules)
+	{
+		b_ReloadLogicModule(*module);
+	}
+	if (b_LogicChanged)
+	{
+		b_ReloadGameLogic(true);
+	}
 }
 
 void GameEditor::Close() const
 {
-	auto& config = GameConfig::GetInstance().GetWindowConfig();
+	t_WindowConfig config = GameConfig::GetInstance().GetWindowConfig();
 	config.scene_width = m_SceneSettings.m_SceneWidth;
 	config.scene_height = m_SceneSettings.m_SceneHeight;
 	config.scene_fps = m_SceneSettings.m_TargetFPS;
+	GameConfig::GetInstance().SetWindowConfig(config);
 	GameConfig::GetInstance().m_bSaveToFile("config.ini");
 
 	if (m_bIconsLoaded)
@@ -515,10 +671,19 @@ void GameEditor::DrawSceneWindow()
 			"restart_btn",
 			(ImTextureID)(intptr_t)m_RestartIcon.id,
 			ImVec2(28, 28)
-		) || IsWindowResized()
+		)
 	)
 	{
+		// Restores the state saved after Initialize; assets stay loaded
 		b_IsPlaying = false;
+		m_Simulation.Stop();
+		m_MapManager->b_RestartCurrentMap();
+	}
+	else if (IsWindowResized())
+	{
+		// The map lays itself out for the new viewport in Initialize
+		b_IsPlaying = false;
+		m_Simulation.Stop();
 		m_MapManager->b_ReloadCurrentMap();
 	}
 
@@ -539,7 +704,16 @@ void GameEditor::DrawSceneWindow()
 		ImGui::GetCursorPosY() - vertical_offset + text_y_offset
 	);
 
-	if (b_IsPlaying)
+	if (b_IsPlaying && m_Simulation.b_IsRunning())
+	{
+		ImGui::TextColored
+		(
+			ImVec4(0.2f, 0.8f, 0.2f, 1.0f),
+			"PLAYING (sim thread, %.0f steps/s)",
+			m_Simulation.GetSnapshot().steps_per_second
+		);
+	}
+	else if (b_IsPlaying)
 	{
 		ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), "PLAYING");
 	}
@@ -562,6 +736,7 @@ void GameEditor::DrawSceneWindow()
 	)
 	{
 		b_IsPlaying = false;
+		m_Simulation.Stop();
 		// Attempt hot reload of GameLogic.dll, 
 		// fallback to reset if it fails
 		if (!b_ReloadGameLogic())
@@ -600,6 +775,7 @@ void GameEditor::DrawSceneWindow()
 	// Compile Button & Status
 	float button_sz = 28.0f + ImGui::GetStyle().FramePadding.x * 2.0f;
 	float status_sz = 0.0f;
+	const bool b_IsCompiling = m_LogicBuilder.b_IsRunning();
 	if (b_IsCompiling)
 	{
 		status_sz = 20.0f + 
@@ -640,64 +816,626 @@ void GameEditor::DrawSceneWindow()
 		) / 2.0f;
 		ImGui::SetCursorPosY
 		(
-			ImGui::GetCursorPosY() - vertical_offset + text_compile_y_offset
+			ImGui::GetCursorPosY() - vertical_offset + text_compile_y_offset
+		);
+		ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), "Compiling...");
+		ImGui::SameLine();
+	}
+
+	bool b_Disabled = b_IsCompiling;
+	if (b_Disabled)
+	{
+		ImGui::PushStyleVar(ImGuiStyleVar_Alpha, 0.5f);
+	}
+
+	if
+	(
+		ImGui::ImageButton
+		(
+			"compile_btn",
+			(ImTextureID)(intptr_t)m_CompileIcon.id,
+			ImVec2(28, 28)
+		)
+	)
+	{
+		if (!b_Disabled)
+		{
+			StartGameLogicBuild();
+		}
+	}
+
+	if (ImGui::IsItemHovered())
+	{
+		ImGui::BeginTooltip(); 
+		ImGui::TextColored(ImVec4(0, 1, 0, 1), "Recompile"); 
+		ImGui::EndTooltip();
+	}
+
+	if (b_Disabled)
+	{
+		ImGui::PopStyleVar();
+	}
+
+	ImGui::PopStyleVar(3);
+
+	rlImGuiImageRenderTextureFit
+	(
+		m_bUseOpaquePass ? 
+		&m_DisplayTexture : &m_RaylibTexture, true
+	);
+
+	ImGui::End();
+}
+
+void GameEditor::StartGameLogicBuild()
+{
+	if (!m_LogicBuilder.b_Start())
+	{
+		return;
+	}
+
+	b_IsPlaying = false;
+	if (!b_ReloadGameLogic()) m_GameEngine.ResetMap(); // Restore
+	ImGui::SetWindowFocus("Build");
+}
+
+void GameEditor::DrawBuildPanel()
+{
+	ImGui::Begin("Build", nullptr, ImGuiWindowFlags_NoCollapse);
+
+	const GameLogicBuilder::t_Progress PROGRESS = m_LogicBuilder.GetProgress();
+	m_LogicBuilder.CopyOutput(m_BuildLog, m_BuildDiagnostics);
+
+	// Status line
+	if (PROGRESS.state == GameLogicBuilder::State::Running)
+	{
+		if (ImGui::Button("Cancel"))
+		{
+			m_LogicBuilder.Cancel();
+		}
+		ImGui::SameLine();
+		s_fDrawSpinner
+		(
+			8.0f, 
+			2.0f, 
+			ImGui::GetColorU32(ImVec4(0.2f, 0.8f, 0.2f, 1.0f))
+		);
+		ImGui::SameLine();
+
+		if (PROGRESS.b_Incremental)
+		{
+			ImGui::Text
+			(
+				"Compiling %d/%d...  %.1f s", 
+				PROGRESS.compiled, 
+				PROGRESS.total, 
+				PROGRESS.elapsed_ms / 1000.0
+			);
+		}
+		else
+		{
+			ImGui::Text("Running CMake build...  %.1f s", PROGRESS.elapsed_ms / 1000.0);
+		}
+	}
+	else
+	{
+		if (ImGui::Button("Build"))
+		{
+			StartGameLogicBuild();
+		}
+		ImGui::SameLine();
+
+		switch (PROGRESS.state)
+		{
+			case GameLogicBuilder::State::Succeeded:
+				ImGui::TextColored
+				(
+					ImVec4(0.2f, 0.8f, 0.2f, 1.0f), 
+					"Build succeeded in %.0f ms (%d compiled)", 
+					PROGRESS.elapsed_ms, 
+					PROGRESS.compiled
+				);
+				break;
+			case GameLogicBuilder::State::Failed:
+				ImGui::TextColored(ImVec4(0.8f, 0.2f, 0.2f, 1.0f), "Build failed");
+				break;
+			case GameLogicBuilder::State::Cancelled:
+				ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "Build cancelled");
+				break;
+			default:
+				ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "No build yet");
+				break;
+		}
+	}
+
+	int error_count = 0;
+	int warning_count = 0;
+	for (const auto& DIAGNOSTIC : m_BuildDiagnostics)
+	{
+		error_count += DIAGNOSTIC.severity == GameLogicBuilder::Severity::Error;
+		warning_count += DIAGNOSTIC.severity == GameLogicBuilder::Severity::Warning;
+	}
+	ImGui::SameLine();
+	ImGui::TextDisabled("|  %d error(s), %d warning(s)", error_count, warning_count);
+
+	ImGui::Separator();
+
+	// Diagnostics on the left, raw compiler output on the right
+	const float AVAILABLE_WIDTH = ImGui::GetContentRegionAvail().x;
+	const float DIAGNOSTICS_WIDTH = AVAILABLE_WIDTH * 0.5f;
+
+	ImGui::PushStyleColor(ImGuiCol_ChildBg, ImVec4(0.1f, 0.1f, 0.1f, 0.8f));
+
+	if (ImGui::BeginChild("build_diagnostics", ImVec2(DIAGNOSTICS_WIDTH, 0), true))
+	{
+		for (const auto& DIAGNOSTIC : m_BuildDiagnostics)
+		{
+			ImVec4 text_color = ImVec4(0.6f, 0.8f, 1.0f, 1.0f);
+			if (DIAGNOSTIC.severity == GameLogicBuilder::Severity::Error)
+			{
+				text_color = ImVec4(1.0f, 0.3f, 0.3f, 1.0f);
+			}
+			else if (DIAGNOSTIC.severity == GameLogicBuilder::Severity::Warning)
+			{
+				text_color = ImVec4(1.0f, 0.8f, 0.3f, 1.0f);
+			}
+
+			ImGui::PushStyleColor(ImGuiCol_Text, text_color);
+			if (DIAGNOSTIC.file.empty())
+			{
+				ImGui::TextWrapped("%s", DIAGNOSTIC.message.c_str());
+			}
+			else
+			{
+				ImGui::TextWrapped
+				(
+					"%s:%d:%d: %s",
+					fs::path(DIAGNOSTIC.file).filename().string().c_str(),
+					DIAGNOSTIC.line,
+					DIAGNOSTIC.column,
+					DIAGNOSTIC.message.c_str()
+				);
+			}
+			ImGui::PopStyleColor();
+
+			if (!DIAGNOSTIC.file.empty() && ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("%s", DIAGNOSTIC.file.c_str());
+			}
+		}
+	}
+	ImGui::EndChild();
+
+	ImGui::SameLine();
+
+	if (ImGui::BeginChild("build_output", ImVec2(0, 0), true, ImGuiWindowFlags_HorizontalScrollbar))
+	{
+		for (const std::string& LINE : m_BuildLog)
+		{
+			ImGui::TextUnformatted(LINE.c_str());
+		}
+
+		// Follow the output while building
+		if (PROGRESS.state == GameLogicBuilder::State::Running)
+		{
+			ImGui::SetScrollHereY(1.0f);
+		}
+	}
+	ImGui::EndChild();
+
+	ImGui::PopStyleColor();
+
+	ImGui::End();
+}
+
+void GameEditor::DrawLogPanel()
+{
+	ImGui::Begin("Log", nullptr, ImGuiWindowFlags_NoCollapse);
+
+	// Same cap as the sink, so the panel never holds more than it keeps
+	constexpr size_t MAX_RECORDS = 2000;
+	m_LogSink->CopyNewRecords(m_LogRecords, m_LogReadCount);
+	if (m_LogRecords.size() > MAX_RECORDS)
+	{
+		m_LogRecords.erase
+		(
+			m_LogRecords.begin(), 
+			m_LogRecords.end() - static_cast<ptrdiff_t>(MAX_RECORDS)
+		);
+	}
+
+	if (ImGui::Button("Clear"))
+	{
+		m_LogRecords.clear();
+		m_LogSink->Clear();
+	}
+	ImGui::SameLine();
+
+	constexpr const char* LEVELS[] = { "Trace", "Debug", "Info", "Warning", "Error" };
+	ImGui::SetNextItemWidth(120.0f);
+	ImGui::Combo("Level", &m_LogLevelFilter, LEVELS, IM_ARRAYSIZE(LEVELS));
+
+	const uint64_t DROPPED = Logger::Get().GetDroppedCount();
+	if (DROPPED > 0)
+	{
+		ImGui::SameLine();
+		ImGui::TextDisabled("|  %llu dropped (queue full)", static_cast<unsigned long long>(DROPPED));
+	}
+
+	ImGui::Separator();
+
+	ImGui::PushStyleColor(ImGuiCol_ChildBg, ImVec4(0.1f, 0.1f, 0.1f, 0.8f));
+	if (ImGui::BeginChild("log_output", ImVec2(0, 0), true, ImGuiWindowFlags_HorizontalScrollbar))
+	{
+		// Stick to the bottom unless the user scrolled up
+		const bool b_AtBottom = ImGui::GetScrollY() >= ImGui::GetScrollMaxY();
+
+		for (const t_LogRecord& RECORD : m_LogRecords)
+		{
+			if (static_cast<int>(RECORD.level) < m_LogLevelFilter)
+			{
+				continue;
+			}
+
+			ImVec4 text_color = ImVec4(0.85f, 0.85f, 0.85f, 1.0f);
+			if (RECORD.level == LogLevel::Error)
+			{
+				text_color = ImVec4(1.0f, 0.3f, 0.3f, 1.0f);
+			}
+			else if (RECORD.level == LogLevel::Warning)
+			{
+				text_color = ImVec4(1.0f, 0.8f, 0.3f, 1.0f);
+			}
+			else if (RECORD.level <= LogLevel::Debug)
+			{
+				text_color = ImVec4(0.6f, 0.6f, 0.6f, 1.0f);
+			}
+
+			const std::string_view TAG = RECORD.GetTag();
+			const std::string_view TEXT = RECORD.GetText();
+			ImGui::PushStyleColor(ImGuiCol_Text, text_color);
+			ImGui::Text
+			(
+				"%9.3f  [%.*s] %.*s", 
+				RECORD.time, 
+				static_cast<int>(TAG.size()), 
+				TAG.data(), 
+				static_cast<int>(TEXT.size()), 
+				TEXT.data()
+			);
+			ImGui::PopStyleColor();
+		}
+
+		if (b_AtBottom)
+		{
+			ImGui::SetScrollHereY(1.0f);
+		}
+	}
+	ImGui::EndChild();
+	ImGui::PopStyleColor();
+
+	ImGui::End();
+}
+
+void GameEditor::DrawCVarsPanel()
+{
+	ImGui::Begin("CVars", nullptr, ImGuiWindowFlags_NoCollapse);
+
+	ImGui::SetNextItemWidth(-60.0f);
+	ImGui::InputTextWithHint("##cvar_filter", "Filter", m_CVarFilter, sizeof(m_CVarFilter));
+	ImGui::SameLine();
+	if (ImGui::Button("Save"))
+	{
+		GameConfig::GetInstance().m_bSaveToFile("config.ini");
+	}
+	if (ImGui::IsItemHovered())
+	{
+		ImGui::SetTooltip("Write changed and archived CVars to config.ini");
+	}
+
+	ImGui::Separator();
+
+	CVarRegistry& registry = CVarRegistry::Get();
+	const ImGuiTableFlags TABLE_FLAGS = 
+		ImGuiTableFlags_RowBg | 
+		ImGuiTableFlags_Resizable | 
+		ImGuiTableFlags_ScrollY;
+
+	if (ImGui::BeginTable("cvars", 2, TABLE_FLAGS))
+	{
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Name");
+		ImGui::TableSetupColumn("Value");
+		ImGui::TableHeadersRow();
+
+		for (const CVarRegistry::t_CVarInfo& INFO : registry.GetAll())
+		{
+			if (m_CVarFilter[0] != '\0' && INFO.name.find(m_CVarFilter) == std::string::npos)
+			{
+				continue;
+			}
+
+			ImGui::PushID(INFO.name.c_str());
+			ImGui::TableNextRow();
+
+			// Name, highlighted when changed from the default
+			ImGui::TableNextColumn();
+			const bool b_Changed = INFO.b_Declared && INFO.value != INFO.default_value;
+			if (!INFO.b_Declared)
+			{
+				ImGui::TextDisabled("%s", INFO.name.c_str());
+			}
+			else if (b_Changed)
+			{
+				ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "%s", INFO.name.c_str());
+			}
+			else
+			{
+				ImGui::TextUnformatted(INFO.name.c_str());
+			}
+
+			if (ImGui::IsItemHovered())
+			{
+				if (INFO.b_Declared)
+				{
+					ImGui::SetTooltip
+					(
+						"%s\nDefault: %s%s%s", 
+						INFO.description.c_str(), 
+						INFO.default_value.c_str(),
+						b_HasFlag(INFO.flags, CVarFlags::RestartRequired) ? "\nApplies on the next start" : "",
+						b_Changed ? "\nRight-click to reset" : ""
+					);
+				}
+				else
+				{
+					ImGui::SetTooltip("Set from config.ini or the command line; nothing loaded declares it");
+				}
+			}
+			if (b_Changed && ImGui::BeginPopupContextItem("reset"))
+			{
+				if (ImGui::MenuItem("Reset to default"))
+				{
+					registry.b_ResetToDefault(INFO.name);
+				}
+				ImGui::EndPopup();
+			}
+
+			// Value
+			ImGui::TableNextColumn();
+			ImGui::SetNextItemWidth(-1.0f);
+			std::string new_value;
+			bool b_Edited = false;
+
+			if (!INFO.b_Declared)
+			{
+				ImGui::TextDisabled("%s", INFO.value.c_str());
+			}
+			else if (INFO.type == CVarType::Bool)
+			{
+				bool value = false;
+				b_ParseCVarValue(INFO.value, value);
+				if (ImGui::Checkbox("##value", &value))
+				{
+					new_value = FormatCVarValue(value);
+					b_Edited = true;
+				}
+			}
+			else if (INFO.type == CVarType::Int)
+			{
+				int32_t value = 0;
+				b_ParseCVarValue(INFO.value, value);
+				const bool b_Moved = INFO.b_HasRange ? 
+					ImGui::SliderInt("##value", &value, static_cast<int>(INFO.min), static_cast<int>(INFO.max)) : 
+					ImGui::DragInt("##value", &value);
+				if (b_Moved)
+				{
+					new_value = FormatCVarValue(value);
+					b_Edited = true;
+				}
+			}
+			else if (INFO.type == CVarType::Float)
+			{
+				float value = 0.0f;
+				b_ParseCVarValue(INFO.value, value);
+				float default_value = 0.0f;
+				b_ParseCVarValue(INFO.default_value, default_value);
+
+				const bool b_Moved = INFO.b_HasRange ? 
+					ImGui::SliderFloat("##value", &value, static_cast<float>(INFO.min), static_cast<float>(INFO.max)) : 
+					ImGui::DragFloat("##value", &value, (std::max)(std::fabs(default_value) * 0.01f, 0.01f));
+				if (b_Moved)
+				{
+					new_value = FormatCVarValue(value);
+					b_Edited = true;
+				}
+			}
+			else
+			{
+				char buffer[256] = {};
+				INFO.value.copy(buffer, sizeof(buffer) - 1);
+				if (ImGui::InputText("##value", buffer, sizeof(buffer), ImGuiInputTextFlags_EnterReturnsTrue))
+				{
+					new_value = buffer;
+					b_Edited = true;
+				}
+			}
+
+			if (b_Edited)
+			{
+				registry.b_Set(INFO.name, new_value);
+			}
+
+			ImGui::PopID();
+		}
+		ImGui::EndTable();
+	}
+
+	ImGui::End();
+}
+
+void GameEditor::DrawPerformancePanel()
+{
+	ImGui::Begin("Performance", nullptr, ImGuiWindowFlags_NoCollapse);
+
+	const EngineStats& stats = EngineStats::Get();
+	const t_FrameStats& LAST = stats.GetLastFrame();
+	const std::vector<t_FrameStats> HISTORY = stats.GetHistory();
+
+	ImGui::Text
+	(
+		"%.2f ms (%.0f FPS)   update %.2f ms   draw %.2f ms",
+		LAST.frame_ms,
+		LAST.frame_ms > 0.0f ? 1000.0f / LAST.frame_ms : 0.0f,
+		LAST.update_ms,
+		LAST.draw_ms
+	);
+
+	// Frame-time graph: each bar is one frame, update (green) and draw
+	// (blue) stacked at the bottom, the rest (UI, present, vsync) grey
+	const float GRAPH_HEIGHT = 80.0f;
+	const ImVec2 GRAPH_POS = ImGui::GetCursorScreenPos();
+	const ImVec2 GRAPH_SIZE = ImVec2(ImGui::GetContentRegionAvail().x, GRAPH_HEIGHT);
+	ImDrawList* draw_list = ImGui::GetWindowDrawList();
+
+	float scale_ms = 1000.0f / static_cast<float>((std::max)(m_SceneSettings.m_TargetFPS, 1)) * 2.0f;
+	for (const t_FrameStats& FRAME : HISTORY)
+	{
+		scale_ms = (std::max)(scale_ms, FRAME.frame_ms);
+	}
+
+	draw_list->AddRectFilled
+	(
+		GRAPH_POS,
+		ImVec2(GRAPH_POS.x + GRAPH_SIZE.x, GRAPH_POS.y + GRAPH_SIZE.y),
+		IM_COL32(25, 25, 28, 255)
+	);
+
+	const float BAR_WIDTH = GRAPH_SIZE.x / static_cast<float>(c_FRAME_HISTORY_SIZE);
+	const float BOTTOM = GRAPH_POS.y + GRAPH_SIZE.y;
+	auto bar_height = [&](float ms)
+	{
+		return (std::min)(ms / scale_ms, 1.0f) * GRAPH_SIZE.y;
+	};
+
+	// Newest frame at the right edge
+	const float FIRST_X = GRAPH_POS.x + GRAPH_SIZE.x - BAR_WIDTH * static_cast<float>(HISTORY.size());
+	for (size_t i = 0; i < HISTORY.size(); ++i)
+	{
+		const t_FrameStats& FRAME = HISTORY[i];
+		const float X0 = FIRST_X + BAR_WIDTH * static_cast<float>(i);
+		const float X1 = X0 + (std::max)(BAR_WIDTH - 1.0f, 1.0f);
+
+		const float UPDATE_TOP = BOTTOM - bar_height(FRAME.update_ms);
+		const float DRAW_TOP = UPDATE_TOP - bar_height(FRAME.draw_ms);
+		const float FRAME_TOP = (std::min)(BOTTOM - bar_height(FRAME.frame_ms), DRAW_TOP);
+
+		draw_list->AddRectFilled(ImVec2(X0, FRAME_TOP), ImVec2(X1, DRAW_TOP), IM_COL32(110, 110, 120, 255));
+		draw_list->AddRectFilled(ImVec2(X0, DRAW_TOP), ImVec2(X1, UPDATE_TOP), IM_COL32(70, 130, 220, 255));
+		draw_list->AddRectFilled(ImVec2(X0, UPDATE_TOP), ImVec2(X1, BOTTOM), IM_COL32(90, 190, 100, 255));
+	}
+
+	// Frame budget at the target FPS
+	const float BUDGET_MS = 1000.0f / static_cast<float>((std::max)(m_SceneSettings.m_TargetFPS, 1));
+	const float BUDGET_Y = BOTTOM - bar_height(BUDGET_MS);
+	draw_list->AddLine
+	(
+		ImVec2(GRAPH_POS.x, BUDGET_Y),
+		ImVec2(GRAPH_POS.x + GRAPH_SIZE.x, BUDGET_Y),
+		IM_COL32(230, 180, 60, 200)
+	);
+
+	ImGui::Dummy(GRAPH_SIZE);
+	if (ImGui::IsItemHovered())
+	{
+		ImGui::SetTooltip
+		(
+			"Green: update, blue: draw, grey: rest of the frame\nLine: %.1f ms budget (%d FPS)\nTop: %.1f ms",
+			BUDGET_MS,
+			m_SceneSettings.m_TargetFPS,
+			scale_ms
 		);
-		ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), "Compiling...");
-		ImGui::SameLine();
 	}
 
-	bool b_Disabled = b_IsCompiling.load();
-	if (b_Disabled)
+	// Rendering
+	ImGui::SeparatorText("Rendering");
+	ImGui::Text("Draw calls: %u", LAST.draw_calls);
+	ImGui::Text("Texture binds: %u", LAST.texture_binds);
+	ImGui::Text("Sprites: %u", LAST.quads);
+	if (ImGui::IsItemHovered())
 	{
-		ImGui::PushStyleVar(ImGuiStyleVar_Alpha, 0.5f);
+		ImGui::SetTooltip("Counted texture draws of the map; shapes, text and the editor UI are not included");
 	}
 
-	if
-	(
-		ImGui::ImageButton
+	// Entities
+	ImGui::SeparatorText("Entities");
+	if (m_Simulation.b_IsRunning())
+	{
+		// The map belongs to the simulation thread; show its last step
+		const SimulationThread::t_Snapshot SNAPSHOT = m_Simulation.GetSnapshot();
+		ImGui::Text
 		(
-			"compile_btn",
-			(ImTextureID)(intptr_t)m_CompileIcon.id,
-			ImVec2(28, 28)
-		)
-	)
+			"Simulation thread: step %llu, %.2f ms, %.0f steps/s",
+			static_cast<unsigned long long>(SNAPSHOT.frame),
+			SNAPSHOT.step_ms,
+			SNAPSHOT.steps_per_second
+		);
+
+		size_t total = 0;
+		for (const t_MapEntityCount& ENTRY : SNAPSHOT.entity_counts)
+		{
+			ImGui::Text("%s%s: %zu", ENTRY.map_id.c_str(), ENTRY.b_Layer ? " (layer)" : "", ENTRY.count);
+			total += ENTRY.count;
+		}
+		ImGui::Text("Total: %zu", total);
+	}
+	else if (m_MapManager)
 	{
-		if (!b_Disabled)
+		size_t total = 0;
+		for (const t_MapEntityCount& ENTRY : m_MapManager->GetEntityCounts())
 		{
-			b_IsCompiling = true;
-			b_IsPlaying = false;
-			if (!b_ReloadGameLogic()) m_GameEngine.ResetMap(); // Restore
-
-			std::thread
-			(
-				[this]()
-				{
-					std::system("build_gamelogic.bat nopause");
-					b_IsCompiling = false;
-				}
-			).detach();
+			ImGui::Text("%s%s: %zu", ENTRY.map_id.c_str(), ENTRY.b_Layer ? " (layer)" : "", ENTRY.count);
+			total += ENTRY.count;
 		}
+		ImGui::Text("Total: %zu", total);
 	}
-
-	if (ImGui::IsItemHovered())
+	else
 	{
-		ImGui::BeginTooltip(); 
-		ImGui::TextColored(ImVec4(0, 1, 0, 1), "Recompile"); 
-		ImGui::EndTooltip();
+		ImGui::TextDisabled("No map loaded");
 	}
 
-	if (b_Disabled)
+	// Background workers, busy share of the last frame
+	ImGui::SeparatorText("Workers");
+	for (const t_WorkerLoad& LOAD : stats.GetWorkerLoads())
 	{
-		ImGui::PopStyleVar();
+		std::array<char, 128> overlay{};
+		std::snprintf(overlay.data(), overlay.size(), "%s  %.0f%%", LOAD.name.c_str(), LOAD.utilization * 100.0f);
+		ImGui::ProgressBar(LOAD.utilization, ImVec2(-1.0f, 0.0f), overlay.data());
 	}
 
-	ImGui::PopStyleVar(3);
+	// Memory by subsystem
+	ImGui::SeparatorText("Memory");
+	const ImGuiTableFlags TABLE_FLAGS = ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+	if (ImGui::BeginTable("memory", 2, TABLE_FLAGS))
+	{
+		size_t total = 0;
+		for (const t_MemoryUsage& USAGE : stats.GetMemoryUsage())
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(USAGE.subsystem.c_str());
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2f MB", USAGE.bytes / (1024.0 * 1024.0));
+			total += USAGE.bytes;
+		}
 
-	rlImGuiImageRenderTextureFit
-	(
-		m_bUseOpaquePass ? 
-		&m_DisplayTexture : &m_RaylibTexture, true
-	);
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextDisabled("Total");
+		ImGui::TableNextColumn();
+		ImGui::TextDisabled("%.2f MB", total / (1024.0 * 1024.0));
+		ImGui::EndTable();
+	}
 
 	ImGui::End();
 }
@@ -937,14 +1675,14 @@ void GameEditor::DrawExportPanel()
 		m_ExportState.m_ExportPath.empty() ? 
 		"export" : m_ExportState.m_ExportPath;
 
-	strncpy_s
+	// Truncates long paths and always null-terminates
+	std::snprintf
 	(
-		export_path_buffer.data(),        // destination
-		export_path_buffer.size(),        // buffer size
-		current_path.c_str(),             // source
-		_TRUNCATE                         // auto null-terminate
+		export_path_buffer.data(),
+		export_path_buffer.size(),
+		"%s",
+		current_path.c_str()
 	);
-    export_path_buffer[export_path_buffer.size() - 1] = '\0';
 
     ImGui::PushItemWidth(300.0f);
     if 
@@ -980,6 +1718,70 @@ void GameEditor::DrawExportPanel()
 		m_ExportState.m_ExportPath = parent_path.string();
     }
 
+    ImGui::Spacing();
+
+    ImGui::AlignTextToFramePadding();
+    ImGui::Text("Assets:");
+    ImGui::SameLine();
+    ImGui::SetCursorPosX(120.0f);
+    ImGui::Checkbox("Pack into Assets.pak", &m_ExportState.m_bPackAssets);
+    if (ImGui::IsItemHovered())
+    {
+        ImGui::SetTooltip
+		(
+			"Single memory-mapped archive: faster cold start, one open file"
+		);
+    }
+
+    ImGui::SameLine();
+    ImGui::SetCursorPosX(330.0f);
+    if (!m_ExportState.m_bPackAssets)
+    {
+        ImGui::BeginDisabled();
+    }
+    ImGui::Checkbox("Compress (LZ)", &m_ExportState.m_bCompressAssets);
+    if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+    {
+        ImGui::SetTooltip
+		(
+			"Smaller download; entries that do not shrink are stored as-is"
+		);
+    }
+
+    ImGui::SetCursorPosX(120.0f);
+    ImGui::Checkbox("Pre-decode textures", &m_ExportState.m_bPreDecodeTextures);
+    if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+    {
+        ImGui::SetTooltip
+		(
+			"Store images as raw pixels: no PNG decode at load, larger pack"
+		);
+    }
+
+    ImGui::SameLine();
+    ImGui::SetCursorPosX(330.0f);
+    if (!m_ExportState.m_bPreDecodeTextures)
+    {
+        ImGui::BeginDisabled();
+    }
+    ImGui::Checkbox("Premultiply alpha", &m_ExportState.m_bPremultiplyAlpha);
+    if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+    {
+        ImGui::SetTooltip
+		(
+			"Only if the game draws with BLEND_ALPHA_PREMULTIPLY"
+		);
+    }
+    if (!m_ExportState.m_bPreDecodeTextures)
+    {
+        ImGui::EndDisabled();
+    }
+
+    if (!m_ExportState.m_bPackAssets)
+    {
+        ImGui::EndDisabled();
+    }
+
     ImGui::Spacing();
     ImGui::Spacing();
     
@@ -1114,6 +1916,10 @@ void GameEditor::DrawExportPanel()
 							current_path / m_ExportState.m_ExportPath;
 
                         fs::create_directories(export_dir);
+
+                        // Outputs whose sources did not change since the
+                        // last export into this folder are left alone
+                        ExportPipeline pipeline(export_dir);
                         
                         // Use custom game name for the executable
                         std::string game_exe_name = 
@@ -1122,123 +1928,62 @@ void GameEditor::DrawExportPanel()
 						(
 							m_ExportState.m_ExportLogs,
 							m_ExportState.m_ExportLogMutex, 
-							"Creating game executable: " + game_exe_name
-						);
-                        fs::copy_file
-						(
-							app_exe, 
-							export_dir / game_exe_name, 
-							fs::copy_options::overwrite_existing
-						);
-                        
-                        // Create game configuration file
-                        s_fAppendLogLine
-						(
-							m_ExportState.m_ExportLogs,
-							m_ExportState.m_ExportLogMutex, 
-							"Creating game configuration..."
-						);
-                        
-                        fs::path config_path = export_dir / "config.ini";
-                        std::ofstream config_file(config_path.string());
-						if (config_file.is_open())
-						{
-							GameConfig::GetInstance().ApplyExportSettings
-							(
-								m_ExportState.m_WindowWidth,
-								m_ExportState.m_WindowHeight,
-								m_ExportState.m_bFullscreen,
-								m_ExportState.m_bResizable,
-								m_ExportState.m_bVSync,
-								m_ExportState.m_TargetFPS
-							);
-
-							config_file << GameConfig::GetInstance().GenerateConfigString();
-							config_file.close();
-						}
-                        
-                        s_fAppendLogLine
-						(
-							m_ExportState.m_ExportLogs,
-							m_ExportState.m_ExportLogMutex, 
-							"Copying GameLogic.dll..."
-						);
-                        fs::copy_file
-						(
-							game_logic_dll, 
-							export_dir / "GameLogic.dll", 
-							fs::copy_options::overwrite_existing
+							"Game executable: " + game_exe_name
 						);
+                        pipeline.AddCopy(app_exe, game_exe_name);
                         
-                        s_fAppendLogLine
-						(
-							m_ExportState.m_ExportLogs,
-							m_ExportState.m_ExportLogMutex, 
-							"Copying raylib.dll..."
-						);
-                        fs::copy_file
-						(
-							raylib_dll, 
-							export_dir / "raylib.dll", 
-							fs::copy_options::overwrite_existing
-						);
+                        GameConfig::GetInstance().ApplyExportSettings
+                        (
+                            m_ExportState.m_WindowWidth,
+                            m_ExportState.m_WindowHeight,
+                            m_ExportState.m_bFullscreen,
+                            m_ExportState.m_bResizable,
+                            m_ExportState.m_bVSync,
+                            m_ExportState.m_TargetFPS
+                        );
+                        pipeline.AddGenerated
+                        (
+                            "config.ini",
+                            GameConfig::GetInstance().GenerateConfigString()
+                        );
+
+                        pipeline.AddCopy(game_logic_dll, "GameLogic.dll");
+                        for (const t_LogicModule& MODULE : FindLogicModules(game_logic_dll))
+                        {
+                            const fs::path MODULE_FILE = fs::path(MODULE.path).filename();
+                            pipeline.AddCopy(MODULE.path, MODULE_FILE.string());
+                        }
+                        pipeline.AddCopy(raylib_dll, "raylib.dll");
                         
-                        // Copy game assets (excluding EngineContent)
+                        // Collect game assets (excluding EngineContent)
                         fs::path assets_dir = current_path / "Assets";
-                        if (fs::exists(assets_dir)) 
+                        std::vector<fs::path> asset_files;
+                        if (fs::exists(assets_dir))
                         {
-                            s_fAppendLogLine
-                            (
-                                m_ExportState.m_ExportLogs,
-                                m_ExportState.m_ExportLogMutex, 
-                                "Copying game assets..."
-                            );
-                            
-                            fs::path export_assets_dir = export_dir / "Assets";
-                            fs::create_directories(export_assets_dir);
-                            
                             for 
 							(
-								const auto& entry : fs::directory_iterator(assets_dir)
+								auto it = fs::recursive_directory_iterator(assets_dir);
+								it != fs::recursive_directory_iterator();
+								++it
 							)
                             {
-                                if (entry.is_directory() && 
-									entry.path().filename()!="EngineContent")
+                                if (it->is_directory() && 
+									it->path().filename() == "EngineContent")
                                 {
-                                    fs::path dest = export_assets_dir / entry.path().filename();
-                                    fs::copy
-									(
-										entry.path(), 
-										dest, 
-                                        fs::copy_options::recursive | 
-                                        fs::copy_options::overwrite_existing
-									);
-                                    
-                                    s_fAppendLogLine
-                                    (
-                                        m_ExportState.m_ExportLogs,
-                                        m_ExportState.m_ExportLogMutex, 
-                                        "Copied asset folder: " + 
-										entry.path().filename().string()
-                                    );
+                                    it.disable_recursion_pending();
+                                    continue;
                                 }
-                                else if (entry.is_regular_file())
+
+                                if (it->is_regular_file())
                                 {
-                                    fs::path dest = export_assets_dir / entry.path().filename();
-                                    fs::copy_file(entry.path(), dest, 
-                                        fs::copy_options::overwrite_existing);
-                                    
-                                    s_fAppendLogLine
-                                    (
-                                        m_ExportState.m_ExportLogs,
-                                        m_ExportState.m_ExportLogMutex, 
-                                        "Copied asset file: " + 
-										entry.path().filename().string()
-                                    );
+                                    asset_files.push_back(it->path());
                                 }
                             }
                         }
-                        else 
+
+                        t_PackWriteStats pack_stats;
+                        bool b_PackBuilt = false;
+                        if (!fs::exists(assets_dir))
                         {
                             s_fAppendLogLine
                             (
@@ -1247,6 +1992,153 @@ void GameEditor::DrawExportPanel()
                                 "No Assets folder found - skipping asset copy"
                             );
                         }
+                        else if (m_ExportState.m_bPackAssets)
+                        {
+                            s_fAppendLogLine
+                            (
+                                m_ExportState.m_ExportLogs,
+                                m_ExportState.m_ExportLogMutex, 
+                                "Packing " + std::to_string(asset_files.size()) + 
+								" game assets into Assets.pak..."
+                            );
+
+                            const bool COMPRESS = m_ExportState.m_bCompressAssets;
+                            const bool PRE_DECODE = m_ExportState.m_bPreDecodeTextures;
+                            const bool PREMULTIPLY = m_ExportState.m_bPremultiplyAlpha;
+
+                            // The pack is rebuilt as a whole when an asset or
+                            // one of these options changes
+                            std::string options_key =
+                                std::string("lz=") + (COMPRESS ? "true" : "false") +
+                                " decode=" + (PRE_DECODE ? "true" : "false") +
+                                " premultiply=" + (PREMULTIPLY ? "true" : "false");
+
+                            pipeline.AddDerived
+                            (
+                                "Assets.pak",
+                                asset_files,
+                                std::move(options_key),
+                                [&, COMPRESS, PRE_DECODE, PREMULTIPLY]
+								(
+									const fs::path& out_path, 
+									std::string& out_error
+								)
+                                {
+                                    AssetPackWriter writer;
+                                    writer.SetCompression(COMPRESS);
+                                    writer.SetTextureConversion(PRE_DECODE, PREMULTIPLY);
+                                    writer.SetThreadCount(ExportPipeline::GetThreadCount());
+                                    for (const fs::path& FILE : asset_files)
+                                    {
+                                        // Key by the path the game loads, e.g. "Assets/slime.png"
+                                        writer.AddFile
+                                        (
+                                            FILE, 
+                                            "Assets/" + fs::relative(FILE, assets_dir).generic_string()
+                                        );
+                                    }
+                                    b_PackBuilt = writer.b_Write(out_path, out_error, &pack_stats);
+                                    return b_PackBuilt;
+                                }
+                            );
+                        }
+                        else 
+                        {
+                            s_fAppendLogLine
+                            (
+                                m_ExportState.m_ExportLogs,
+                                m_ExportState.m_ExportLogMutex, 
+                                "Copying " + std::to_string(asset_files.size()) + 
+								" game assets..."
+                            );
+                            
+                            for (const fs::path& FILE : asset_files)
+                            {
+                                pipeline.AddCopy
+                                (
+                                    FILE, 
+                                    "Assets/" + fs::relative(FILE, assets_dir).generic_string()
+                                );
+                            }
+                        }
+
+                        std::string export_error;
+                        t_ExportStats stats;
+                        const bool b_Exported = pipeline.b_Run
+                        (
+                            export_error, 
+                            &stats, 
+                            &m_ExportState.m_bCancelExport
+                        );
+
+                        if (b_PackBuilt)
+                        {
+                            s_fAppendLogLine
+                            (
+                                m_ExportState.m_ExportLogs,
+                                m_ExportState.m_ExportLogMutex, 
+                                "Packed " + std::to_string(pack_stats.file_count) + 
+								" assets into Assets.pak (" + 
+								std::to_string(pack_stats.source_bytes / 1024) + " KB -> " +
+								std::to_string(pack_stats.stored_bytes / 1024) + " KB, " +
+								std::to_string(pack_stats.compressed_count) + " compressed, " +
+								std::to_string(pack_stats.texture_count) + " textures pre-decoded)"
+                            );
+                        }
+                        else if (b_Exported && fs::exists(assets_dir) && m_ExportState.m_bPackAssets)
+                        {
+                            s_fAppendLogLine
+                            (
+                                m_ExportState.m_ExportLogs,
+                                m_ExportState.m_ExportLogMutex, 
+                                "Assets.pak is up to date"
+                            );
+                        }
+
+                        // Throughput, so slow exports can be told apart: hashing
+                        // (changed sources) versus writing (stale outputs)
+                        const double SECONDS = (std::max)(stats.seconds, 1e-6);
+                        std::array<char, 256> line{};
+                        std::snprintf
+                        (
+                            line.data(),
+                            line.size(),
+                            "Hashed %zu changed files (%.1f MB), copied %zu, built %zu, %zu up to date, %zu stale removed",
+                            stats.hashed_count,
+                            stats.hashed_bytes / (1024.0 * 1024.0),
+                            stats.copied_count,
+                            stats.built_count,
+                            stats.skipped_count,
+                            stats.removed_count
+                        );
+                        s_fAppendLogLine
+                        (
+                            m_ExportState.m_ExportLogs,
+                            m_ExportState.m_ExportLogMutex, 
+                            line.data()
+                        );
+                        std::snprintf
+                        (
+                            line.data(),
+                            line.size(),
+                            "Wrote %.1f MB in %.2f s (%.1f MB/s, %.0f files/s) on %zu threads",
+                            stats.written_bytes / (1024.0 * 1024.0),
+                            stats.seconds,
+                            stats.written_bytes / (1024.0 * 1024.0) / SECONDS,
+                            (stats.copied_count + stats.built_count) / SECONDS,
+                            stats.thread_count
+                        );
+                        s_fAppendLogLine
+                        (
+                            m_ExportState.m_ExportLogs,
+                            m_ExportState.m_ExportLogMutex, 
+                            line.data()
+                        );
+
+                        if (!b_Exported)
+                        {
+                            throw std::runtime_error(export_error);
+                        }
                         
                         s_fAppendLogLine
 						(
@@ -1271,6 +2163,7 @@ void GameEditor::DrawExportPanel()
                     return;
                 }
                 
+#ifdef _WIN32
                 // Source environment - check for running processes and build
                 s_fAppendLogLine
 				(
@@ -1279,7 +2172,7 @@ void GameEditor::DrawExportPanel()
 					"Source environment detected - checking for m_bIsExporting processes..."
 				);
                 
-                // Check for running main.exe process
+                // Check for running main.exe process (powershell is Windows only)
                 std::stringstream check_cmd;
                 check_cmd << "powershell -Command \"Get-Process -Name 'main' -ErrorAction SilentlyContinue | Select-Object -ExpandProperty Path\"";
                 
@@ -1324,6 +2217,7 @@ void GameEditor::DrawExportPanel()
 						);
                     }
                 }
+#endif
                 
                 // Use simple export script that builds from source
                 s_fAppendLogLine
@@ -1644,6 +2538,7 @@ void GameEditor::DrawSceneSettingsPanel()
         SetTextureFilter(m_DisplayTexture.texture, TEXTURE_FILTER_BILINEAR);
 
         // Update scene bounds for game map/manager
+        m_Simulation.Stop();
         if (m_MapManager)
         {
             m_MapManager->SetSceneBounds
@@ -1701,6 +2596,7 @@ void GameEditor::DrawSceneSettingsPanel()
 
 	if (b_FPSChanged)
 	{
+		m_Simulation.Stop();
 		if (m_MapManager)
 		{
 			m_MapManager->SetTargetFPS(m_SceneSettings.m_TargetFPS);
@@ -1712,6 +2608,36 @@ void GameEditor::DrawSceneSettingsPanel()
 		s_PrevTargetFPS = m_SceneSettings.m_TargetFPS;
 	}
 
+	ImGui::Spacing();
+
+	// Simulation thread (editor.sim_thread / editor.sim_rate)
+	bool b_SimThread = SimulationThread::b_IsEnabled();
+	if (ImGui::Checkbox("Simulate on its own thread", &b_SimThread))
+	{
+		CVarRegistry::Get().b_Set("editor.sim_thread", FormatCVarValue(b_SimThread));
+	}
+	if (ImGui::IsItemHovered())
+	{
+		ImGui::SetTooltip
+		(
+			"While playing, the map updates at a fixed rate on a separate thread;\n"
+			"the scene shows its latest completed frame"
+		);
+	}
+
+	ImGui::BeginDisabled(!b_SimThread);
+	ImGui::AlignTextToFramePadding();
+	ImGui::Text("Steps per second:");
+	ImGui::SameLine();
+	ImGui::PushItemWidth(100.0f);
+	int32_t sim_rate = SimulationThread::GetRate();
+	if (ImGui::InputInt("##sim_rate", &sim_rate, 0, 0, ImGuiInputTextFlags_EnterReturnsTrue))
+	{
+		CVarRegistry::Get().b_Set("editor.sim_rate", FormatCVarValue(sim_rate));
+	}
+	ImGui::PopItemWidth();
+	ImGui::EndDisabled();
+
     ImGui::Spacing();
     ImGui::Separator();
     ImGui::Spacing();
@@ -1738,6 +2664,7 @@ void GameEditor::DrawSceneSettingsPanel()
 
 void GameEditor::LoadMap(std::unique_ptr<GameMap>& game_map)
 {
+    m_Simulation.Stop();
     if (game_map)
     {
         // Check if the loaded map is a MapManager
@@ -1769,44 +2696,102 @@ void GameEditor::LoadMap(std::unique_ptr<GameMap>& game_map)
     }
 }
 
-bool GameEditor::b_LoadGameLogic(std::string_view dll_path)
+bool GameEditor::b_LoadGameLogic(std::string_view dll_path, bool b_PreserveState)
 {
+	const auto START = Clock::now();
 	m_GameLogicPath = dll_path.data() ? dll_path.data() : "";
 
-	DllHandle new_dll = LoadDll(dll_path.data());
+	// The simulation thread runs code from the library being replaced;
+	// RunFrame restarts it
+	m_Simulation.Stop();
+
+	StartupProfiler& startup = m_GameEngine.GetStartupProfiler();
+	t_ReloadTimings timings;
+	auto elapsed_ms = [](Clock::time_point since)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+	};
+
+	DllHandle new_dll{};
+	{
+		StartupProfiler::Scope phase(&startup, "LoadDll");
+		new_dll = LoadDll(dll_path.data());
+	}
 	if (!new_dll.handle)
 	{
-		std::cerr << "Failed to load GameLogic DLL: "
-				  << dll_path
-				  << "\n";
+		RW_LOG_ERROR("GameEditor", "Failed to load GameLogic DLL: {}", dll_path);
 
 		return false;
 	}
+	timings.copy_ms = new_dll.timings.copy_ms;
+	timings.load_ms = new_dll.timings.load_ms;
 
 	// 2) Get factory
+	auto phase_start = Clock::now();
 	CreateGameMapFunc new_factory =
 	reinterpret_cast<CreateGameMapFunc>
 	(
 		GetDllSymbol(new_dll, "CreateGameMap")
 	);
+	timings.symbol_ms = elapsed_ms(phase_start);
 
 	if (!new_factory)
 	{
-		std::cerr << "Failed to get CreateGameMap from DLL" << "\n";
+		RW_LOG_ERROR("GameEditor", "Failed to get CreateGameMap from DLL");
 		UnloadDll(new_dll);
 		return false;
 	}
+	AttachEngineServices(new_dll);
 
 	// 3) Create the new map before disturbing current state
-	std::unique_ptr<GameMap> new_map(new_factory());
+	std::unique_ptr<GameMap> new_map;
+	{
+		StartupProfiler::Scope phase(&startup, "CreateGameMap");
+		phase_start = Clock::now();
+		new_map.reset(new_factory());
+		timings.create_ms = elapsed_ms(phase_start);
+	}
 	if (!new_map)
 	{
-		std::cerr << "CreateGameMap returned null" << "\n";
+		RW_LOG_ERROR("GameEditor", "CreateGameMap returned null");
 		UnloadDll(new_dll);
 		return false;
 	}
 
-	// 4) Destroy current map to release old DLL code before unloading
+	// Modules stay loaded across GameLogic reloads and register their maps
+	// into each new manager; ones built since the last load are picked up
+	phase_start = Clock::now();
+	for (t_LogicModule& found : FindLogicModules(m_GameLogicPath))
+	{
+		const bool b_Known = std::any_of
+		(
+			m_LogicModules.begin(),
+			m_LogicModules.end(),
+			[&](const t_LogicModule& module) { return module.name == found.name; }
+		);
+		if (!b_Known && b_LoadLogicModule(found))
+		{
+			m_LogicModules.push_back(std::move(found));
+		}
+	}
+	for (const t_LogicModule& MODULE : m_LogicModules)
+	{
+		RegisterLogicModule(MODULE, static_cast<MapManager&>(*new_map));
+	}
+	timings.create_ms += elapsed_ms(phase_start);
+
+	// 4) Destroy current map to release old DLL code before unloading.
+	// To keep the session, the old maps first write their state, and the
+	// assets they unload on the way out are parked for the new module.
+	MapSnapshot reload_state;
+	AssetManager& assets = m_GameEngine.GetAssetManager();
+	const bool b_HandOff = b_PreserveState && m_MapManager;
+	if (b_HandOff)
+	{
+		m_MapManager->SaveReloadState(reload_state);
+		assets.BeginHandoff();
+	}
+
 	m_GameEngine.SetMap(nullptr);
 	m_GameEngine.SetMapManager(nullptr);
 
@@ -1823,6 +2808,7 @@ bool GameEditor::b_LoadGameLogic(std::string_view dll_path)
 	m_CreateGameMap = new_factory;
 	
 	// Check if the loaded map is a MapManager
+	phase_start = Clock::now();
 	MapManager* map_manager = static_cast<MapManager*>(new_map.get());
 	if (map_manager)
 	{
@@ -1842,22 +2828,41 @@ bool GameEditor::b_LoadGameLogic(std::string_view dll_path)
 		m_GameEngine.SetMap(std::move(new_map));
 		m_MapManager = nullptr; // No MapManager available
 	}
+	timings.initialize_ms = elapsed_ms(phase_start);
 
-	// Update watched timestamp 
-	// (watch the original DLL path, not the shadow)
-	std::error_code ec;
+	// 7) Rebuild the old session in the new module
+	if (b_HandOff)
+	{
+		phase_start = Clock::now();
+		if (m_MapManager)
+		{
+			m_MapManager->b_RestoreReloadState(reload_state);
+		}
+		const t_HandoffStats HANDOFF = assets.EndHandoff();
+		timings.restore_ms = elapsed_ms(phase_start);
 
-	m_LastLogicWriteTime =
-	fs::last_write_time
-	(
-		fs::path(m_GameLogicPath),	
-		ec
-	);
+		RW_LOG_INFO
+		(
+			"GameEditor",
+			"Hot reload kept the session: {} of {} assets handed off, {} freed, {:.2f} ms total",
+			HANDOFF.reused,
+			HANDOFF.parked,
+			HANDOFF.freed,
+			std::chrono::duration<double, std::milli>(Clock::now() - START).count()
+		);
+	}
+
+	// RunFrame() adds the first frame and logs the timeline
+	m_LastReloadTimings = timings;
+	m_ReloadedLibrary = "GameLogic";
+	m_ReloadStartTime = START;
+	m_ReloadEndTime = Clock::now();
+	m_bReloadFramePending = true;
 
 	return true;
 }
 
-bool GameEditor::b_ReloadGameLogic()
+bool GameEditor::b_ReloadGameLogic(bool b_PreserveState)
 {
 	if (m_GameLogicPath.empty())
 	{
@@ -1867,12 +2872,76 @@ bool GameEditor::b_ReloadGameLogic()
 	bool b_WasPlaying = b_IsPlaying;
 	b_IsPlaying = false;
 
-	bool b_Ok = b_LoadGameLogic(m_GameLogicPath.c_str());
+	bool b_Ok = b_LoadGameLogic(m_GameLogicPath.c_str(), b_PreserveState);
 	b_IsPlaying = b_WasPlaying;
 
 	return b_Ok;
 }
 
+bool GameEditor::b_ReloadLogicModule(t_LogicModule& module)
+{
+	const auto START = Clock::now();
+	auto elapsed_ms = [](Clock::time_point since)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+	};
+
+	// Load the rebuilt copy first; if it is broken the old one keeps running
+	t_LogicModule incoming{ module.name, module.path };
+	if (!b_LoadLogicModule(incoming))
+	{
+		return false;
+	}
+
+	t_ReloadTimings timings;
+	timings.copy_ms = incoming.dll.timings.copy_ms;
+	timings.load_ms = incoming.dll.timings.load_ms;
+	m_Simulation.Stop();
+
+	// Only this module's maps go away; the rest of the session keeps running
+	MapSnapshot reload_state;
+	AssetManager& assets = m_GameEngine.GetAssetManager();
+	if (m_MapManager)
+	{
+		assets.BeginHandoff();
+		m_MapManager->DetachModule(module.name, reload_state);
+	}
+
+	UnloadLogicModule(module);
+	module = std::move(incoming);
+
+	if (m_MapManager)
+	{
+		auto phase_start = Clock::now();
+		RegisterLogicModule(module, *m_MapManager);
+		timings.create_ms = elapsed_ms(phase_start);
+
+		phase_start = Clock::now();
+		m_MapManager->b_RestoreReloadState(reload_state);
+		const t_HandoffStats HANDOFF = assets.EndHandoff();
+		timings.restore_ms = elapsed_ms(phase_start);
+
+		RW_LOG_INFO
+		(
+			"GameEditor",
+			"Reloaded module {}: {} maps, {} of {} assets handed off, {:.2f} ms total",
+			module.name,
+			m_MapManager->GetModuleMaps(module.name).size(),
+			HANDOFF.reused,
+			HANDOFF.parked,
+			elapsed_ms(START)
+		);
+	}
+
+	m_LastReloadTimings = timings;
+	m_ReloadedLibrary = module.name;
+	m_ReloadStartTime = START;
+	m_ReloadEndTime = Clock::now();
+	m_bReloadFramePending = true;
+
+	return true;
+}
+
 static void s_fAppendLogLine
 (
 	std::vector<std::string>& logs, 
@@ -1969,7 +3038,11 @@ static bool s_bfValidateExportFolder
 	
 	// Check for Assets folder (optional - may not exist if no game assets)
 	fs::path assets_path = fs::path(out_dir) / "Assets";
-	if (fs::exists(assets_path)) 
+	if (fs::exists(fs::path(out_dir) / "Assets.pak")) 
+	{
+		s_fAppendLogLine(logs, mtx, "Found Assets.pak in export");
+	}
+	else if (fs::exists(assets_path)) 
 	{
 		s_fAppendLogLine(logs, mtx, "Found Assets folder in export");
 	}
@@ -2079,6 +3152,7 @@ void GameEditor::DrawMapSelectionUI()
 					// Switch to selected map
 					if (m_SelectedMapId != curr_map_id)
 					{
+						m_Simulation.Stop();
 						m_MapManager->b_GotoMap(m_SelectedMapId);
 					}
 				}
@@ -2165,6 +3239,7 @@ void GameEditor::DrawMapSelectionUI()
 			{
 				if (MAP_ID != curr_map_id)
 				{
+					m_Simulation.Stop();
 					m_MapManager->b_GotoMap(MAP_ID);
 				}
 			}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <system_error>
 #include <imgui.h>
@@ -17,10 +18,16 @@
 #include <fstream>
 #include <string>
 
+#include "FileWatcher.h"
+#include "GameLogicBuilder.h"
+#include "SimulationThread.h"
 #include "DllLoader.h"
+#include "LogicModules.h"
 #include "GameEditorLayout.h"
 #include "GameEditorTheme.h"
 #include "GameEngine.h"
+#include "Logger.h"
+#include "CVar.h"
 namespace fs = std::filesystem;
 
 class GameEditor
@@ -30,17 +37,38 @@ public:
     ~GameEditor();
 
     bool b_IsPlaying;
-    std::atomic<bool> b_IsCompiling;
     void Init(int width, int height, std::string_view title);
     void LoadMap(std::unique_ptr<GameMap>& game_map);
 
-    // Load the game logic DLL and create/set a new GameMap from it
-    bool b_LoadGameLogic(std::string_view dll_path);
+    // Load the game logic DLL and create/set a new GameMap from it. With
+    // b_PreserveState the running maps' state and loaded assets carry over
+    // into the new module instead of starting over.
+    bool b_LoadGameLogic(std::string_view dll_path, bool b_PreserveState = false);
 
     // Unload and reload the DLL, then recreate the GameMap
-    bool b_ReloadGameLogic();
+    bool b_ReloadGameLogic(bool b_PreserveState = false);
+
+    // Phase durations of the last b_LoadGameLogic in ms. first_frame_ms and
+    // total_ms are filled in once the next frame has been presented.
+    struct t_ReloadTimings
+    {
+        double copy_ms = 0.0;           // shadow file in LoadDll
+        double load_ms = 0.0;           // LoadLibrary / dlopen
+        double symbol_ms = 0.0;         // GetDllSymbol("CreateGameMap")
+        double create_ms = 0.0;         // CreateGameMap() / RegisterGameMaps()
+        double initialize_ms = 0.0;     // SetMapManager / SetMap -> Initialize
+        double restore_ms = 0.0;        // reload state and asset handoff
+        double first_frame_ms = 0.0;    // end of the load to the frame presented
+        double total_ms = 0.0;          // start of the load to the frame presented
+    };
+    const t_ReloadTimings& GetLastReloadTimings() const { return m_LastReloadTimings; }
+    bool b_IsReloadFramePending() const { return m_bReloadFramePending; }
 
     void Run();
+
+    // One editor frame: file changes, map update, scene and UI. Run() loops
+    // over it until the window closes.
+    void RunFrame();
 private:
     void Close() const;
 
@@ -55,6 +83,10 @@ private:
     void DrawMapSelectionUI();
     void DrawExportPanel();
     void DrawSceneSettingsPanel();
+    void DrawBuildPanel();
+    void DrawLogPanel();
+    void DrawCVarsPanel();
+    void DrawPerformancePanel();
 
     // New icon texture members
     Texture2D m_PlayIcon;
@@ -74,9 +106,49 @@ private:
     CreateGameMapFunc m_CreateGameMap = nullptr;
 
     std::string m_GameLogicPath;
-    fs::file_time_type m_LastLogicWriteTime{};
 
-    float m_ReloadCheckAccum = 0.0f;
+    // GameLogic/<Name>/ modules found next to GameLogic. They register
+    // their maps into its MapManager, survive its reloads, and a rebuilt
+    // module only replaces its own maps.
+    std::vector<t_LogicModule> m_LogicModules;
+    bool b_ReloadLogicModule(t_LogicModule& module);
+
+    t_ReloadTimings m_LastReloadTimings;
+    std::string m_ReloadedLibrary;      // for the timeline log
+    std::chrono::steady_clock::time_point m_ReloadStartTime;
+    std::chrono::steady_clock::time_point m_ReloadEndTime;
+    bool m_bReloadFramePending = false;
+
+    // Reports the rebuilt DLL and edited assets from a background thread;
+    // edited textures are swapped in place, a new DLL is hot-reloaded
+    FileWatcher m_FileWatcher;
+    void ProcessFileChanges();
+
+    // Compile button / Build panel; the rebuilt DLL is picked up by
+    // m_FileWatcher like any other rebuild
+    GameLogicBuilder m_LogicBuilder;
+    std::vector<std::string> m_BuildLog;
+    std::vector<GameLogicBuilder::t_Diagnostic> m_BuildDiagnostics;
+    void StartGameLogicBuild();
+
+    // Log panel: the Engine logger's output, GameLogic libraries included
+    // (they are attached to the editor's logger when loaded). editor.log
+    // gets the same lines.
+    std::shared_ptr<MemoryLogSink> m_LogSink;
+    std::shared_ptr<FileLogSink> m_LogFileSink;
+    std::vector<t_LogRecord> m_LogRecords;
+    uint64_t m_LogReadCount = 0;
+    int m_LogLevelFilter = static_cast<int>(LogLevel::Trace);
+
+    // While playing with editor.sim_thread on, the map updates on this
+    // thread and RunFrame draws its latest completed step. Anything else
+    // that changes the map stops it first; RunFrame starts it again.
+    SimulationThread m_Simulation;
+
+    // CVars panel: every CVar of the editor and the loaded GameLogic
+    // libraries, edited live; Save writes them to config.ini
+    char m_CVarFilter[64] = {};
+
     Shader m_OpaqueShader;
     bool m_bUseOpaquePass = true;
 
@@ -110,6 +182,12 @@ private:
         bool m_bResizable = true;
         bool m_bVSync = true;
 
+        // Ship Assets/ as a single memory-mapped Assets.pak
+        bool m_bPackAssets = true;
+        bool m_bCompressAssets = true;
+        bool m_bPreDecodeTextures = true;
+        bool m_bPremultiplyAlpha = false;
+
         std::vector<std::string> m_ExportLogs;
         std::mutex m_ExportLogMutex;
         std::thread m_ExportThread;
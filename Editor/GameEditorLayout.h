@@ -29,6 +29,12 @@ Size=306,720
 Collapsed=0
 DockId=0x00000002,0
 
+[Window][CVars]
+Pos=974,0
+Size=306,720
+Collapsed=0
+DockId=0x00000002,1
+
 [Window][Export]
 Pos=0,0
 Size=972,720
@@ -41,6 +47,24 @@ Size=972,720
 Collapsed=0
 DockId=0x00000001,1
 
+[Window][Build]
+Pos=0,522
+Size=1280,198
+Collapsed=0
+DockId=0x00000004,0
+
+[Window][Log]
+Pos=0,522
+Size=1280,198
+Collapsed=0
+DockId=0x00000004,1
+
+[Window][Performance]
+Pos=974,0
+Size=306,720
+Collapsed=0
+DockId=0x00000002,2
+
 [Docking][Data]
 DockSpace     ID=0x08BD597D Window=0x1BBC0F80 Pos=0,0 Size=1280,720 Split=Y Selected=0xE601B12F
   DockNode    ID=0x00000003 Parent=0x08BD597D SizeRef=1280,520 Split=X Selected=0xE601B12F
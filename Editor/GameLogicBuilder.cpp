@@ -0,0 +1,1256 @@
+#include "GameLogicBuilder.h"
+#include "CVar.h"
+#include "Logger.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+static constexpr std::string_view c_LOGIC_TARGET = "GameLogic";
+
+// Logic modules are the targets GameLogic_<Name>, built from GameLogic/<Name>/
+static constexpr std::string_view c_LOGIC_MODULE_PREFIX = "GameLogic_";
+
+// Read when a build starts
+static CVar<int32_t> s_BuildJobs
+(
+    "build.jobs",
+    0,
+    0,
+    256,
+    "Compilers run in parallel by in-editor builds (0 = one per core)",
+    CVarFlags::Archive
+);
+
+/*
++--------------------------------------------------------+
+|                   PROCESS EXECUTION                    |
++--------------------------------------------------------+
+*/
+
+using LineCallback = std::function<void(const std::string&)>;
+
+// Child processes inherit every inheritable pipe that exists while they
+// are created, so a parallel worker's compiler would hold our pipe open and
+// we would never see EOF. Creating pipe + process under one lock avoids it.
+static std::mutex s_SpawnMutex;
+
+static void s_fSplitLines(std::string& pending, std::string_view chunk, const LineCallback& on_line)
+{
+    pending.append(chunk);
+
+    size_t start = 0;
+    for (size_t end = pending.find('\n'); end != std::string::npos; end = pending.find('\n', start))
+    {
+        std::string line = pending.substr(start, end - start);
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        on_line(line);
+        start = end + 1;
+    }
+    pending.erase(0, start);
+}
+
+#ifdef _WIN32
+
+// Runs command through cmd.exe; returns the exit code, -1 if it could not
+// start or was cancelled
+static int s_fRunProcess
+(
+    const std::string& command,
+    const fs::path& directory,
+    const std::atomic<bool>& b_Cancel,
+    const LineCallback& on_line
+)
+{
+    HANDLE read_pipe = nullptr;
+    HANDLE write_pipe = nullptr;
+    PROCESS_INFORMATION process{};
+
+    // The job takes the compiler down with cmd.exe on cancel
+    HANDLE job = CreateJobObjectA(nullptr, nullptr);
+    JOBOBJECT_EXTENDED_LIMIT_INFORMATION limits{};
+    limits.BasicLimitInformation.LimitFlags = JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
+    SetInformationJobObject(job, JobObjectExtendedLimitInformation, &limits, sizeof(limits));
+
+    {
+        std::scoped_lock lock(s_SpawnMutex);
+
+        SECURITY_ATTRIBUTES attributes{ static_cast<DWORD>(sizeof(SECURITY_ATTRIBUTES)), nullptr, TRUE };
+        if (!CreatePipe(&read_pipe, &write_pipe, &attributes, 0))
+        {
+            CloseHandle(job);
+            return -1;
+        }
+        SetHandleInformation(read_pipe, HANDLE_FLAG_INHERIT, 0);
+
+        STARTUPINFOA startup{};
+        startup.cb = sizeof(startup);
+        startup.dwFlags = STARTF_USESTDHANDLES;
+        startup.hStdOutput = write_pipe;
+        startup.hStdError = write_pipe;
+
+        std::string command_line = "cmd.exe /S /C \"" + command + "\"";
+        const std::string DIRECTORY = directory.string();
+
+        const BOOL b_Created = CreateProcessA
+        (
+            nullptr,
+            command_line.data(),
+            nullptr,
+            nullptr,
+            TRUE,
+            CREATE_NO_WINDOW | CREATE_SUSPENDED,
+            nullptr,
+            DIRECTORY.empty() ? nullptr : DIRECTORY.c_str(),
+            &startup,
+            &process
+        );
+        CloseHandle(write_pipe);
+
+        if (!b_Created)
+        {
+            CloseHandle(read_pipe);
+            CloseHandle(job);
+            return -1;
+        }
+    }
+
+    AssignProcessToJobObject(job, process.hProcess);
+    ResumeThread(process.hThread);
+    CloseHandle(process.hThread);
+
+    std::string pending;
+    std::array<char, 4096> buffer{};
+    bool b_Killed = false;
+
+    for (;;)
+    {
+        if (b_Cancel && !b_Killed)
+        {
+            TerminateJobObject(job, 1);
+            b_Killed = true;
+        }
+
+        DWORD available = 0;
+        if (!PeekNamedPipe(read_pipe, nullptr, 0, nullptr, &available, nullptr))
+        {
+            break;  // every writer exited
+        }
+        if (available == 0)
+        {
+            Sleep(5);
+            continue;
+        }
+
+        DWORD bytes_read = 0;
+        const DWORD TO_READ = (std::min)(available, static_cast<DWORD>(buffer.size()));
+        if (!ReadFile(read_pipe, buffer.data(), TO_READ, &bytes_read, nullptr) || bytes_read == 0)
+        {
+            break;
+        }
+        s_fSplitLines(pending, std::string_view(buffer.data(), bytes_read), on_line);
+    }
+
+    if (!pending.empty())
+    {
+        on_line(pending);
+    }
+
+    WaitForSingleObject(process.hProcess, INFINITE);
+    DWORD exit_code = 1;
+    GetExitCodeProcess(process.hProcess, &exit_code);
+
+    CloseHandle(process.hProcess);
+    CloseHandle(read_pipe);
+    CloseHandle(job);
+    return b_Killed ? -1 : static_cast<int>(exit_code);
+}
+
+#else
+
+// Runs command through /bin/sh; returns the exit code, -1 if it could not
+// start or was cancelled
+static int s_fRunProcess
+(
+    const std::string& command,
+    const fs::path& directory,
+    const std::atomic<bool>& b_Cancel,
+    const LineCallback& on_line
+)
+{
+    const std::string DIRECTORY = directory.string();
+    std::array<int, 2> pipe_fds{ -1, -1 };
+    pid_t pid = -1;
+
+    {
+        std::scoped_lock lock(s_SpawnMutex);
+
+        if (pipe(pipe_fds.data()) != 0)
+        {
+            return -1;
+        }
+        fcntl(pipe_fds[0], F_SETFD, FD_CLOEXEC);
+
+        pid = fork();
+        if (pid == 0)
+        {
+            // Own process group, so cancel also reaches the compiler the
+            // shell started
+            setpgid(0, 0);
+            dup2(pipe_fds[1], STDOUT_FILENO);
+            dup2(pipe_fds[1], STDERR_FILENO);
+            close(pipe_fds[1]);
+
+            if (!DIRECTORY.empty() && chdir(DIRECTORY.c_str()) != 0)
+            {
+                _exit(127);
+            }
+            execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+            _exit(127);
+        }
+        close(pipe_fds[1]);
+    }
+
+    if (pid < 0)
+    {
+        close(pipe_fds[0]);
+        return -1;
+    }
+    setpgid(pid, pid);
+
+    std::string pending;
+    std::array<char, 4096> buffer{};
+    bool b_Killed = false;
+
+    for (;;)
+    {
+        if (b_Cancel && !b_Killed)
+        {
+            kill(-pid, SIGKILL);
+            b_Killed = true;
+        }
+
+        pollfd poll_fd{ pipe_fds[0], POLLIN, 0 };
+        const int READY = poll(&poll_fd, 1, 50);
+        if (READY < 0 && errno != EINTR)
+        {
+            break;
+        }
+        if (READY <= 0)
+        {
+            continue;
+        }
+
+        const ssize_t BYTES_READ = read(pipe_fds[0], buffer.data(), buffer.size());
+        if (BYTES_READ <= 0)
+        {
+            break;  // every writer exited
+        }
+        s_fSplitLines(pending, std::string_view(buffer.data(), static_cast<size_t>(BYTES_READ)), on_line);
+    }
+
+    if (!pending.empty())
+    {
+        on_line(pending);
+    }
+    close(pipe_fds[0]);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+    {
+    }
+
+    if (b_Killed || !WIFEXITED(status))
+    {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+#endif
+
+/*
++--------------------------------------------------------+
+|                  BUILD SYSTEM FILES                    |
++--------------------------------------------------------+
+*/
+
+static std::string s_fReadFile(const fs::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// pos is on the opening quote; leaves it after the closing one
+static bool s_bfReadJsonString(const std::string& text, size_t& pos, std::string& out)
+{
+    out.clear();
+    ++pos;
+
+    while (pos < text.size())
+    {
+        const char C = text[pos++];
+        if (C == '"')
+        {
+            return true;
+        }
+        if (C != '\\')
+        {
+            out += C;
+            continue;
+        }
+        if (pos >= text.size())
+        {
+            return false;
+        }
+
+        const char ESCAPED = text[pos++];
+        switch (ESCAPED)
+        {
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'r': out += '\r'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'u':
+            {
+                if (pos + 4 > text.size())
+                {
+                    return false;
+                }
+                const unsigned long CODE = std::strtoul(text.substr(pos, 4).c_str(), nullptr, 16);
+                out += CODE < 0x80 ? static_cast<char>(CODE) : '?';
+                pos += 4;
+                break;
+            }
+            default: out += ESCAPED; break;
+        }
+    }
+    return false;
+}
+
+/*
+    Just enough JSON for compile_commands.json: an array of flat objects
+    whose values are strings, or (the "arguments" form) arrays of strings,
+    which are joined back into a command line.
+*/
+static std::vector<std::unordered_map<std::string, std::string>> s_fReadCompileCommands(const fs::path& path)
+{
+    const std::string TEXT = s_fReadFile(path);
+
+    std::vector<std::unordered_map<std::string, std::string>> entries;
+    std::unordered_map<std::string, std::string> entry;
+    std::string key;
+    std::string value;
+    size_t pos = 0;
+
+    auto skip_space = [&]()
+    {
+        while (pos < TEXT.size() && (std::isspace(static_cast<unsigned char>(TEXT[pos])) || TEXT[pos] == ':'))
+        {
+            ++pos;
+        }
+    };
+
+    while (pos < TEXT.size())
+    {
+        const char C = TEXT[pos];
+        if (C == '{')
+        {
+            entry.clear();
+            ++pos;
+        }
+        else if (C == '}')
+        {
+            entries.push_back(std::move(entry));
+            entry.clear();
+            ++pos;
+        }
+        else if (C == '"')
+        {
+            if (!s_bfReadJsonString(TEXT, pos, key))
+            {
+                break;
+            }
+            skip_space();
+
+            if (pos < TEXT.size() && TEXT[pos] == '"')
+            {
+                if (!s_bfReadJsonString(TEXT, pos, value))
+                {
+                    break;
+                }
+                entry[key] = value;
+            }
+            else if (pos < TEXT.size() && TEXT[pos] == '[')
+            {
+                std::string joined;
+                while (++pos < TEXT.size() && TEXT[pos] != ']')
+                {
+                    if (TEXT[pos] != '"' || !s_bfReadJsonString(TEXT, pos, value))
+                    {
+                        continue;
+                    }
+                    --pos;  // the loop advances past the closing quote again
+
+                    if (!joined.empty())
+                    {
+                        joined += ' ';
+                    }
+                    joined += value.find(' ') != std::string::npos ? "\"" + value + "\"" : value;
+                }
+                entry[key] = joined;
+            }
+        }
+        else
+        {
+            ++pos;
+        }
+    }
+    return entries;
+}
+
+// Splits a command line on whitespace, honouring double quotes
+static std::vector<std::string> s_fSplitCommand(const std::string& command)
+{
+    std::vector<std::string> tokens;
+    std::string token;
+    bool b_InQuotes = false;
+    bool b_HasToken = false;
+
+    for (size_t i = 0; i < command.size(); ++i)
+    {
+        const char C = command[i];
+        if (C == '\\' && i + 1 < command.size() && command[i + 1] == '"')
+        {
+            token += '"';
+            b_HasToken = true;
+            ++i;
+        }
+        else if (C == '"')
+        {
+            b_InQuotes = !b_InQuotes;
+            b_HasToken = true;
+        }
+        else if (!b_InQuotes && std::isspace(static_cast<unsigned char>(C)))
+        {
+            if (b_HasToken)
+            {
+                tokens.push_back(std::move(token));
+                token.clear();
+                b_HasToken = false;
+            }
+        }
+        else
+        {
+            token += C;
+            b_HasToken = true;
+        }
+    }
+
+    if (b_HasToken)
+    {
+        tokens.push_back(std::move(token));
+    }
+    return tokens;
+}
+
+static bool s_bfStartsWithNoCase(std::string_view text, std::string_view prefix)
+{
+    return text.size() >= prefix.size() && std::equal
+    (
+        prefix.begin(),
+        prefix.end(),
+        text.begin(),
+        [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b)); }
+    );
+}
+
+// Value of the first "-o X" / "/FoX" / "/out:X" style argument
+static std::string s_fFindOutputArgument(const std::vector<std::string>& tokens)
+{
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        if (tokens[i] == "-o" && i + 1 < tokens.size())
+        {
+            return tokens[i + 1];
+        }
+        for (std::string_view prefix : { "/Fo", "-Fo", "/out:", "-out:" })
+        {
+            if (tokens[i].size() > prefix.size() && s_bfStartsWithNoCase(tokens[i], prefix))
+            {
+                return tokens[i].substr(prefix.size());
+            }
+        }
+    }
+    return {};
+}
+
+// Prerequisites listed in a Makefile-style depfile (GCC/Clang -MD)
+static std::vector<fs::path> s_fReadDepfile(const fs::path& path)
+{
+    const std::string TEXT = s_fReadFile(path);
+
+    // Skip the target; a ':' inside a drive letter is not followed by space
+    size_t pos = 0;
+    while (pos < TEXT.size())
+    {
+        if (TEXT[pos] == ':' && (pos + 1 == TEXT.size() || std::isspace(static_cast<unsigned char>(TEXT[pos + 1]))))
+        {
+            ++pos;
+            break;
+        }
+        ++pos;
+    }
+
+    std::vector<fs::path> dependencies;
+    std::string current;
+    for (; pos < TEXT.size(); ++pos)
+    {
+        const char C = TEXT[pos];
+        if (C == '\\' && pos + 1 < TEXT.size())
+        {
+            const char NEXT = TEXT[pos + 1];
+            if (NEXT == ' ' || NEXT == '#')
+            {
+                current += NEXT;
+                ++pos;
+                continue;
+            }
+            if (NEXT == '\n' || NEXT == '\r')
+            {
+                continue;  // line continuation
+            }
+        }
+
+        if (std::isspace(static_cast<unsigned char>(C)))
+        {
+            if (!current.empty())
+            {
+                dependencies.emplace_back(current);
+                current.clear();
+            }
+            continue;
+        }
+        current += C;
+    }
+
+    if (!current.empty())
+    {
+        dependencies.emplace_back(current);
+    }
+    return dependencies;
+}
+
+// The build directory is the working directory for an editor started from
+// its build output, or build/ in an exported project
+static fs::path s_fFindBuildDirectory()
+{
+    std::error_code ec;
+    for (const char* CANDIDATE : { ".", "build" })
+    {
+        if (fs::exists(fs::path(CANDIDATE) / "CMakeCache.txt", ec))
+        {
+            return fs::path(CANDIDATE);
+        }
+    }
+    return {};
+}
+
+static std::string s_fReadCacheValue(const fs::path& build_dir, std::string_view name)
+{
+    std::ifstream cache(build_dir / "CMakeCache.txt");
+    std::string line;
+    while (std::getline(cache, line))
+    {
+        if (line.starts_with(name) && line.size() > name.size() && line[name.size()] == ':')
+        {
+            const size_t EQUALS = line.find('=');
+            if (EQUALS != std::string::npos)
+            {
+                std::string value = line.substr(EQUALS + 1);
+                if (!value.empty() && value.back() == '\r')
+                {
+                    value.pop_back();
+                }
+                return value;
+            }
+        }
+    }
+    return {};
+}
+
+static fs::file_time_type s_fNewestHeader(const fs::path& directory)
+{
+    // file_time_type{} is not "oldest": libstdc++ counts from 2174
+    fs::file_time_type newest = fs::file_time_type::min();
+    std::error_code ec;
+
+    for (const fs::directory_entry& ENTRY : fs::directory_iterator(directory, ec))
+    {
+        const fs::path EXTENSION = ENTRY.path().extension();
+        if (EXTENSION == ".h" || EXTENSION == ".hpp" || EXTENSION == ".inl")
+        {
+            std::error_code time_ec;
+            newest = (std::max)(newest, fs::last_write_time(ENTRY.path(), time_ec));
+        }
+    }
+    return newest;
+}
+
+/*
++--------------------------------------------------------+
+|                      DIAGNOSTICS                       |
++--------------------------------------------------------+
+*/
+
+static GameLogicBuilder::Severity s_fParseSeverity(const std::string& text)
+{
+    if (text == "warning")
+    {
+        return GameLogicBuilder::Severity::Warning;
+    }
+    if (text == "note")
+    {
+        return GameLogicBuilder::Severity::Note;
+    }
+    return GameLogicBuilder::Severity::Error;
+}
+
+static bool s_bfParseDiagnostic(const std::string& line, GameLogicBuilder::t_Diagnostic& out)
+{
+    // GCC/Clang: file:line:column: error: message
+    static const std::regex c_GCC_PATTERN
+    (
+        R"(^(.+?):(\d+):(?:(\d+):)? (fatal error|error|warning|note): (.*)$)"
+    );
+    // MSVC: file(line,column): error C2065: message
+    static const std::regex c_MSVC_PATTERN
+    (
+        R"(^\s*(.+?)\((\d+)(?:,(\d+))?\)\s?: (fatal error|error|warning|note) ?([A-Z]+\d+)?: (.*)$)"
+    );
+
+    std::smatch match;
+    if (std::regex_match(line, match, c_GCC_PATTERN))
+    {
+        out.severity = s_fParseSeverity(match[4].str());
+        out.file = match[1].str();
+        out.line = std::stoi(match[2].str());
+        out.column = match[3].matched ? std::stoi(match[3].str()) : 0;
+        out.message = match[5].str();
+        return true;
+    }
+
+    if (std::regex_match(line, match, c_MSVC_PATTERN))
+    {
+        out.severity = s_fParseSeverity(match[4].str());
+        out.file = match[1].str();
+        out.line = std::stoi(match[2].str());
+        out.column = match[3].matched ? std::stoi(match[3].str()) : 0;
+        out.message = match[5].matched ? match[5].str() + ": " + match[6].str() : match[6].str();
+        return true;
+    }
+
+    // Linker and driver errors carry no source location
+    if
+    (
+        line.find(": error") != std::string::npos ||
+        line.find(": fatal error") != std::string::npos ||
+        line.find("undefined reference") != std::string::npos
+    )
+    {
+        out.severity = GameLogicBuilder::Severity::Error;
+        out.file.clear();
+        out.line = 0;
+        out.column = 0;
+        out.message = line;
+        return true;
+    }
+    return false;
+}
+
+/*
++--------------------------------------------------------+
+|                        BUILDER                         |
++--------------------------------------------------------+
+*/
+
+GameLogicBuilder::~GameLogicBuilder()
+{
+    Cancel();
+    if (m_Thread.joinable())
+    {
+        m_Thread.join();
+    }
+}
+
+bool GameLogicBuilder::b_Start()
+{
+    if (m_bRunning)
+    {
+        return false;
+    }
+    if (m_Thread.joinable())
+    {
+        m_Thread.join();
+    }
+
+    {
+        std::scoped_lock lock(m_OutputMutex);
+        m_Log.clear();
+        m_Diagnostics.clear();
+    }
+
+    m_bCancel = false;
+    m_Compiled = 0;
+    m_Total = 0;
+    m_bIncremental = false;
+    m_ElapsedMs = 0.0;
+    m_State = State::Running;
+    m_StartTime = Clock::now();
+    m_bRunning = true;
+
+    m_Thread = std::thread(&GameLogicBuilder::Run, this);
+    return true;
+}
+
+void GameLogicBuilder::Cancel()
+{
+    if (m_bRunning)
+    {
+        m_bCancel = true;
+    }
+}
+
+GameLogicBuilder::t_Progress GameLogicBuilder::GetProgress() const
+{
+    t_Progress progress;
+    progress.state = m_State;
+    progress.compiled = m_Compiled;
+    progress.total = m_Total;
+    progress.b_Incremental = m_bIncremental;
+    progress.elapsed_ms = m_bRunning
+        ? std::chrono::duration<double, std::milli>(Clock::now() - m_StartTime).count()
+        : m_ElapsedMs.load();
+    return progress;
+}
+
+void GameLogicBuilder::CopyOutput(std::vector<std::string>& log, std::vector<t_Diagnostic>& diagnostics) const
+{
+    std::scoped_lock lock(m_OutputMutex);
+    log = m_Log;
+    diagnostics = m_Diagnostics;
+}
+
+void GameLogicBuilder::AppendLog(std::vector<std::string> lines)
+{
+    std::scoped_lock lock(m_OutputMutex);
+    for (std::string& line : lines)
+    {
+        m_Log.push_back(std::move(line));
+    }
+}
+
+void GameLogicBuilder::Run()
+{
+    const fs::path BUILD_DIR = s_fFindBuildDirectory();
+
+    bool b_Success = false;
+    if (!BUILD_DIR.empty() && b_LoadUnits(BUILD_DIR))
+    {
+        m_bIncremental = true;
+        b_Success = b_RunIncremental(BUILD_DIR);
+    }
+    else if (!m_bCancel)
+    {
+        b_Success = b_RunFallback(BUILD_DIR);
+    }
+
+    const double ELAPSED_MS = std::chrono::duration<double, std::milli>(Clock::now() - m_StartTime).count();
+    m_ElapsedMs = ELAPSED_MS;
+
+    State result = b_Success ? State::Succeeded : State::Failed;
+    if (m_bCancel)
+    {
+        result = State::Cancelled;
+    }
+
+    std::ostringstream summary;
+    summary << c_LOGIC_TARGET
+            << (result == State::Succeeded ? " built" : result == State::Cancelled ? " build cancelled" : " build failed")
+            << " in " << static_cast<int>(ELAPSED_MS) << " ms";
+    if (m_bIncremental)
+    {
+        summary << " (" << m_Compiled << " of " << m_Units.size() << " translation units compiled)";
+    }
+    AppendLog({ "[Build] " + summary.str() });
+    if (result == State::Failed)
+    {
+        RW_LOG_ERROR("Build", "{}", summary.str());
+    }
+    else
+    {
+        RW_LOG_INFO("Build", "{}", summary.str());
+    }
+
+    m_State = result;
+    m_bRunning = false;
+}
+
+bool GameLogicBuilder::b_LoadUnits(const fs::path& build_dir)
+{
+    m_Targets.clear();
+    m_Units.clear();
+
+    std::error_code ec;
+    const fs::path COMMANDS_PATH = build_dir / "compile_commands.json";
+    if (!fs::exists(COMMANDS_PATH, ec))
+    {
+        return false;
+    }
+
+    // Objects live under CMakeFiles/<target>.dir/
+    auto logic_target_index = [&](const std::string& part) -> std::optional<size_t>
+    {
+        if (!part.ends_with(".dir"))
+        {
+            return std::nullopt;
+        }
+
+        const std::string NAME = part.substr(0, part.size() - 4);
+        if (NAME != c_LOGIC_TARGET && !(NAME.starts_with(c_LOGIC_MODULE_PREFIX) && NAME.size() > c_LOGIC_MODULE_PREFIX.size()))
+        {
+            return std::nullopt;
+        }
+
+        for (size_t i = 0; i < m_Targets.size(); ++i)
+        {
+            if (m_Targets[i].name == NAME)
+            {
+                return i;
+            }
+        }
+        m_Targets.push_back({ NAME, {}, {} });
+        return m_Targets.size() - 1;
+    };
+    std::vector<t_Unit> engine_units;
+
+    for (auto& entry : s_fReadCompileCommands(COMMANDS_PATH))
+    {
+        t_Unit unit;
+        unit.directory = entry["directory"];
+        unit.command = !entry["command"].empty() ? entry["command"] : entry["arguments"];
+        unit.source = fs::path(entry["file"]);
+        if (unit.source.is_relative())
+        {
+            unit.source = unit.directory / unit.source;
+        }
+
+        const std::vector<std::string> TOKENS = s_fSplitCommand(unit.command);
+        const std::string OUTPUT = !entry["output"].empty() ? entry["output"] : s_fFindOutputArgument(TOKENS);
+        if (OUTPUT.empty())
+        {
+            continue;
+        }
+        unit.object = fs::path(OUTPUT).is_relative() ? unit.directory / OUTPUT : fs::path(OUTPUT);
+
+        for (size_t i = 0; i + 1 < TOKENS.size(); ++i)
+        {
+            if (TOKENS[i] == "-MF")
+            {
+                const fs::path DEPFILE(TOKENS[i + 1]);
+                unit.depfile = DEPFILE.is_relative() ? unit.directory / DEPFILE : DEPFILE;
+            }
+        }
+
+        for (const fs::path& PART : unit.object)
+        {
+            if (const std::optional<size_t> TARGET = logic_target_index(PART.string()))
+            {
+                unit.target = *TARGET;
+                m_Units.push_back(unit);
+                break;
+            }
+            if (PART == "Engine.dir")
+            {
+                engine_units.push_back(unit);
+                break;
+            }
+        }
+    }
+
+    if (m_Units.empty())
+    {
+        return false;
+    }
+
+    // Headers are only trusted from depfiles; without one, any header in
+    // the sources' directories counts (GameLogic includes Engine, not the
+    // other way round)
+    std::unordered_set<std::string> logic_dirs;
+    std::unordered_set<std::string> engine_dirs;
+    for (const t_Unit& UNIT : m_Units)
+    {
+        logic_dirs.insert(UNIT.source.parent_path().string());
+    }
+    for (const t_Unit& UNIT : engine_units)
+    {
+        engine_dirs.insert(UNIT.source.parent_path().string());
+    }
+
+    fs::file_time_type engine_header = fs::file_time_type::min();
+    for (const std::string& DIRECTORY : engine_dirs)
+    {
+        engine_header = (std::max)(engine_header, s_fNewestHeader(DIRECTORY));
+    }
+    m_NewestHeader = engine_header;
+    for (const std::string& DIRECTORY : logic_dirs)
+    {
+        m_NewestHeader = (std::max)(m_NewestHeader, s_fNewestHeader(DIRECTORY));
+    }
+
+    // The engine library is linked into GameLogic; rebuilding it is left
+    // to CMake
+    for (const t_Unit& UNIT : engine_units)
+    {
+        if (b_IsUnitDirty(UNIT, engine_header))
+        {
+            AppendLog({ "Engine sources changed, running a full CMake build" });
+            return false;
+        }
+    }
+
+    // A source added or removed needs CMake to regenerate the commands
+    std::unordered_set<std::string> known_sources;
+    for (const t_Unit& UNIT : m_Units)
+    {
+        known_sources.insert(fs::weakly_canonical(UNIT.source, ec).string());
+        if (!fs::exists(UNIT.source, ec))
+        {
+            AppendLog({ "Source removed: " + UNIT.source.filename().string() + ", running a full CMake build" });
+            return false;
+        }
+    }
+    for (const std::string& DIRECTORY : logic_dirs)
+    {
+        for (const fs::directory_entry& ENTRY : fs::directory_iterator(DIRECTORY, ec))
+        {
+            if (ENTRY.path().extension() == ".cpp" && !known_sources.contains(fs::weakly_canonical(ENTRY.path(), ec).string()))
+            {
+                AppendLog({ "New source: " + ENTRY.path().filename().string() + ", running a full CMake build" });
+                return false;
+            }
+        }
+    }
+
+    // A new GameLogic/<Name>/ folder is a module CMake has no target for yet
+    auto b_HasSources = [&](const fs::path& directory)
+    {
+        for (const fs::directory_entry& ENTRY : fs::directory_iterator(directory, ec))
+        {
+            if (ENTRY.path().extension() == ".cpp")
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    for (const t_Unit& UNIT : m_Units)
+    {
+        if (m_Targets[UNIT.target].name != c_LOGIC_TARGET)
+        {
+            continue;
+        }
+
+        for (const fs::directory_entry& ENTRY : fs::directory_iterator(UNIT.source.parent_path(), ec))
+        {
+            const std::string MODULE = std::string(c_LOGIC_MODULE_PREFIX) + ENTRY.path().filename().string();
+            const bool b_Known = std::any_of
+            (
+                m_Targets.begin(),
+                m_Targets.end(),
+                [&](const t_Target& target) { return target.name == MODULE; }
+            );
+            if (ENTRY.is_directory(ec) && !b_Known && b_HasSources(ENTRY.path()))
+            {
+                AppendLog({ "New module: " + ENTRY.path().filename().string() + ", running a full CMake build" });
+                return false;
+            }
+        }
+        break;
+    }
+
+    for (t_Target& target : m_Targets)
+    {
+        if (!b_LoadLinkCommand(build_dir, target))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool GameLogicBuilder::b_LoadLinkCommand(const fs::path& build_dir, t_Target& target)
+{
+    std::error_code ec;
+
+    // Makefile generators keep the link command in link.txt, Ninja prints it
+    const fs::path LINK_SCRIPT = build_dir / "CMakeFiles" / (target.name + ".dir") / "link.txt";
+    if (fs::exists(LINK_SCRIPT, ec))
+    {
+        std::ifstream script(LINK_SCRIPT);
+        std::string line;
+        while (std::getline(script, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            if (!line.empty())
+            {
+                target.link_command += target.link_command.empty() ? line : " && " + line;
+            }
+        }
+    }
+    else if (fs::exists(build_dir / "build.ninja", ec))
+    {
+        std::string ninja = s_fReadCacheValue(build_dir, "CMAKE_MAKE_PROGRAM");
+        if (ninja.empty())
+        {
+            ninja = "ninja";
+        }
+
+        std::string last_line;
+        s_fRunProcess
+        (
+            "\"" + ninja + "\" -t commands -s " + target.name,
+            build_dir,
+            m_bCancel,
+            [&](const std::string& line) { if (!line.empty()) last_line = line; }
+        );
+        target.link_command = last_line;
+    }
+
+    if (target.link_command.empty())
+    {
+        return false;
+    }
+
+    const std::string LINK_OUTPUT = s_fFindOutputArgument(s_fSplitCommand(target.link_command));
+    if (!LINK_OUTPUT.empty())
+    {
+        target.link_output = fs::path(LINK_OUTPUT).is_relative() ? build_dir / LINK_OUTPUT : fs::path(LINK_OUTPUT);
+    }
+    return true;
+}
+
+bool GameLogicBuilder::b_IsUnitDirty(const t_Unit& unit, fs::file_time_type newest_header)
+{
+    std::error_code ec;
+    const fs::file_time_type OBJECT_TIME = fs::last_write_time(unit.object, ec);
+    if (ec)
+    {
+        return true;
+    }
+
+    const fs::file_time_type SOURCE_TIME = fs::last_write_time(unit.source, ec);
+    if (ec || SOURCE_TIME > OBJECT_TIME)
+    {
+        return true;
+    }
+
+    if (unit.depfile.empty() || !fs::exists(unit.depfile, ec))
+    {
+        return newest_header > OBJECT_TIME;
+    }
+
+    for (const fs::path& DEPENDENCY : s_fReadDepfile(unit.depfile))
+    {
+        const fs::path FULL_PATH = DEPENDENCY.is_relative() ? unit.directory / DEPENDENCY : DEPENDENCY;
+        const fs::file_time_type DEPENDENCY_TIME = fs::last_write_time(FULL_PATH, ec);
+        if (ec || DEPENDENCY_TIME > OBJECT_TIME)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GameLogicBuilder::b_RunIncremental(const fs::path& build_dir)
+{
+    std::vector<const t_Unit*> dirty_units;
+    std::vector<bool> needs_link(m_Targets.size(), false);
+    for (const t_Unit& UNIT : m_Units)
+    {
+        if (b_IsUnitDirty(UNIT, m_NewestHeader))
+        {
+            dirty_units.push_back(&UNIT);
+            needs_link[UNIT.target] = true;
+        }
+    }
+    m_Total = static_cast<int>(dirty_units.size());
+
+    // Relink after a failed link, or when the library is missing
+    std::error_code ec;
+    for (size_t i = 0; i < m_Targets.size(); ++i)
+    {
+        if (needs_link[i] || m_Targets[i].link_output.empty())
+        {
+            needs_link[i] = true;
+            continue;
+        }
+
+        const fs::file_time_type LIBRARY_TIME = fs::last_write_time(m_Targets[i].link_output, ec);
+        needs_link[i] = static_cast<bool>(ec);
+        for (const t_Unit& UNIT : m_Units)
+        {
+            if (needs_link[i])
+            {
+                break;
+            }
+            needs_link[i] = UNIT.target == i && fs::last_write_time(UNIT.object, ec) > LIBRARY_TIME;
+        }
+    }
+
+    if (std::none_of(needs_link.begin(), needs_link.end(), [](bool b_Needed) { return b_Needed; }))
+    {
+        AppendLog({ std::string(c_LOGIC_TARGET) + " is up to date" });
+        return true;
+    }
+
+    std::atomic<size_t> next_unit{ 0 };
+    std::atomic<bool> b_CompileFailed{ false };
+
+    auto compile_worker = [&]()
+    {
+        for (size_t index = next_unit++; index < dirty_units.size() && !m_bCancel; index = next_unit++)
+        {
+            const t_Unit& UNIT = *dirty_units[index];
+
+            std::error_code dir_ec;
+            fs::create_directories(UNIT.object.parent_path(), dir_ec);
+
+            if (!b_RunCommand(UNIT.command, UNIT.directory, "Compiling " + UNIT.source.filename().string()))
+            {
+                b_CompileFailed = true;
+            }
+            ++m_Compiled;
+        }
+    };
+
+    const int32_t JOBS = s_BuildJobs.Get();
+    const size_t WORKER_COUNT = (std::min)
+    (
+        dirty_units.size(),
+        JOBS > 0 ? static_cast<size_t>(JOBS) : static_cast<size_t>((std::max)(1u, std::thread::hardware_concurrency()))
+    );
+
+    // Every unit is compiled even after an error, so the panel lists all
+    // of them at once
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < WORKER_COUNT; ++i)
+    {
+        workers.emplace_back(compile_worker);
+    }
+    compile_worker();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (b_CompileFailed || m_bCancel)
+    {
+        return false;
+    }
+
+    // Libraries whose objects did not change keep their file, so the
+    // editor only reloads what was actually rebuilt
+    bool b_Linked = true;
+    for (size_t i = 0; i < m_Targets.size() && !m_bCancel; ++i)
+    {
+        if (needs_link[i])
+        {
+            const t_Target& TARGET = m_Targets[i];
+            b_Linked = b_RunCommand(TARGET.link_command, build_dir, "Linking " + TARGET.link_output.filename().string()) && b_Linked;
+        }
+    }
+    return b_Linked && !m_bCancel;
+}
+
+bool GameLogicBuilder::b_RunFallback(const fs::path& build_dir)
+{
+    std::string command;
+    if (!build_dir.empty())
+    {
+        command = "cmake --build \"" + build_dir.string() + "\" --target " + std::string(c_LOGIC_TARGET) + " --config Release";
+    }
+    else
+    {
+#ifdef _WIN32
+        command = "build_gamelogic.bat nopause";
+#else
+        command = "cmake -S . -B build && cmake --build build --target " + std::string(c_LOGIC_TARGET) + " --config Release";
+#endif
+    }
+    return b_RunCommand(command, fs::path(), "Running " + command);
+}
+
+bool GameLogicBuilder::b_RunCommand(const std::string& command, const fs::path& directory, const std::string& title)
+{
+    std::vector<std::string> lines{ title };
+
+    const int EXIT_CODE = s_fRunProcess
+    (
+        command,
+        directory,
+        m_bCancel,
+        [&](const std::string& line)
+        {
+            // MSVC dependency scanning for Ninja
+            if (line.starts_with("Note: including file:"))
+            {
+                return;
+            }
+
+            t_Diagnostic diagnostic;
+            if (s_bfParseDiagnostic(line, diagnostic))
+            {
+                std::scoped_lock lock(m_OutputMutex);
+                m_Diagnostics.push_back(std::move(diagnostic));
+            }
+            lines.push_back(line);
+        }
+    );
+
+    if (EXIT_CODE != 0 && !m_bCancel)
+    {
+        lines.push_back("ERROR: exited with code " + std::to_string(EXIT_CODE));
+    }
+
+    // Output of one command stays together even with parallel compiles
+    AppendLog(std::move(lines));
+    return EXIT_CODE == 0;
+}
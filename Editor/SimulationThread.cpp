@@ -0,0 +1,196 @@
+#include "SimulationThread.h"
+#include "CVar.h"
+#include "GameEngine.h"
+#include "Logger.h"
+#include <algorithm>
+
+static CVar<bool> s_SimThread
+(
+    "editor.sim_thread",
+    false,
+    "Run the map's Update on its own thread while playing, so a slow editor UI and a slow map do not stall each other",
+    CVarFlags::Archive
+);
+
+static CVar<int32_t> s_SimRate
+(
+    "editor.sim_rate",
+    60,
+    1,
+    1000,
+    "Fixed update rate of the simulation thread (steps per second)",
+    CVarFlags::Archive
+);
+
+// Behind by more than this, the simulation drops the time instead of
+// running a burst of steps to catch up
+static constexpr std::chrono::milliseconds c_MAX_CATCH_UP{ 250 };
+
+SimulationThread::~SimulationThread()
+{
+    Stop();
+}
+
+bool SimulationThread::b_IsEnabled()
+{
+    return s_SimThread.Get();
+}
+
+int32_t SimulationThread::GetRate()
+{
+    return s_SimRate.Get();
+}
+
+void SimulationThread::Start(GameEngine& engine)
+{
+    if (b_IsRunning())
+    {
+        return;
+    }
+
+    m_Engine = &engine;
+    m_Engine->GetAssetManager().GetRenderTasks().SetRenderThread(std::this_thread::get_id());
+
+    m_bStop = false;
+    m_bExited = false;
+    m_bDrawWanted = false;
+    m_Frame = 0;
+    m_DrawnFrame = 0;
+    m_RecentSteps.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_SnapshotMutex);
+        m_Snapshot = {};
+    }
+
+    m_Thread = std::thread(&SimulationThread::Run, this);
+    RW_LOG_INFO("Simulation", "Simulation thread started at {} steps/s", GetRate());
+}
+
+void SimulationThread::Stop()
+{
+    if (!b_IsRunning())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_bStop = true;
+    }
+    m_Wake.notify_all();
+
+    // The last step may be waiting on an asset load queued for this thread
+    RenderTaskQueue& tasks = m_Engine->GetAssetManager().GetRenderTasks();
+    while (!m_bExited)
+    {
+        if (tasks.Pump() == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    m_Thread.join();
+    tasks.Pump();
+    tasks.SetRenderThread({});
+
+    RW_LOG_INFO("Simulation", "Simulation thread stopped after {} steps", m_Frame.load());
+}
+
+std::unique_lock<std::mutex> SimulationThread::TryLockNewFrame()
+{
+    const uint64_t FRAME = m_Frame.load(std::memory_order_acquire);
+    if (!b_IsRunning() || FRAME == m_DrawnFrame)
+    {
+        return {};
+    }
+
+    std::unique_lock<std::mutex> world(m_WorldMutex, std::try_to_lock);
+    if (!world.owns_lock())
+    {
+        m_bDrawWanted = true;
+        return world;
+    }
+
+    m_DrawnFrame = m_Frame.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_bDrawWanted = false;
+    }
+    m_Wake.notify_all();
+    return world;
+}
+
+SimulationThread::t_Snapshot SimulationThread::GetSnapshot() const
+{
+    std::lock_guard<std::mutex> lock(m_SnapshotMutex);
+    return m_Snapshot;
+}
+
+void SimulationThread::Run()
+{
+    Clock::time_point next_step = Clock::now();
+    double sim_time = 0.0;
+
+    while (!m_bStop)
+    {
+        const auto STEP = std::chrono::duration<double>(1.0 / (std::max)(GetRate(), 1));
+        {
+            std::lock_guard<std::mutex> world(m_WorldMutex);
+            WorkerMeter::Scope busy(m_Meter);
+
+            const Clock::time_point START = Clock::now();
+            m_Engine->StepMap(static_cast<float>(STEP.count()));
+            sim_time += STEP.count();
+
+            PublishSnapshot
+            (
+                std::chrono::duration<float, std::milli>(Clock::now() - START).count(),
+                sim_time
+            );
+            m_Frame.fetch_add(1, std::memory_order_release);
+        }
+
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+
+        // The render thread missed the last frame: give it up to one step
+        // to take this one before the world is locked again
+        if (m_bDrawWanted)
+        {
+            m_Wake.wait_for(lock, STEP, [this]() { return !m_bDrawWanted || m_bStop; });
+        }
+
+        next_step += std::chrono::duration_cast<Clock::duration>(STEP);
+        const Clock::time_point NOW = Clock::now();
+        if (NOW - next_step > c_MAX_CATCH_UP)
+        {
+            next_step = NOW;
+        }
+        m_Wake.wait_until(lock, next_step, [this]() { return m_bStop.load(); });
+    }
+
+    m_bExited = true;
+}
+
+void SimulationThread::PublishSnapshot(float step_ms, double sim_time)
+{
+    const Clock::time_point NOW = Clock::now();
+    m_RecentSteps.push_back(NOW);
+    while (NOW - m_RecentSteps.front() > std::chrono::seconds(1))
+    {
+        m_RecentSteps.pop_front();
+    }
+
+    // Read under the world lock, so the map cannot change underneath
+    t_Snapshot snapshot;
+    snapshot.frame = m_Frame.load(std::memory_order_relaxed) + 1;
+    snapshot.sim_time = sim_time;
+    snapshot.step_ms = step_ms;
+    snapshot.steps_per_second = static_cast<float>(m_RecentSteps.size());
+    if (MapManager* map_manager = m_Engine->GetMapManager())
+    {
+        snapshot.map_id = map_manager->GetCurrentMapId();
+        snapshot.entity_counts = map_manager->GetEntityCounts();
+    }
+
+    std::lock_guard<std::mutex> lock(m_SnapshotMutex);
+    m_Snapshot = std::move(snapshot);
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EngineStats.h"
+#include "MapManager.h"
+
+class GameEngine;
+
+/**
+ * @brief Steps the editor's map on its own thread at a fixed rate
+ *
+ * The thread calls GameEngine::StepMap at editor.sim_rate steps per second,
+ * independent of how long the editor UI takes to build and present a
+ * frame. The map is only touched by one side at a time: the simulation
+ * holds the world lock for a step, and the render thread takes it (without
+ * waiting) when a step has completed since its last draw, to apply staged
+ * map transitions and draw that frame into the scene texture. If it cannot
+ * get in, the scene keeps showing the last completed frame.
+ *
+ * GL work stays on the render thread. Asset loads the map makes during a
+ * step are queued on the AssetManager's RenderTaskQueue and wait for the
+ * render thread's next Pump(), and BeginMapFrame (prefetch uploads and
+ * map transitions) runs with the world lock held by the render thread.
+ * raylib input is polled on the render thread too: it calls
+ * GameEngine::CaptureInput every frame, without the world lock, and each
+ * step takes what was captured since the previous one.
+ *
+ * Panels read the published snapshot rather than the live map.
+ *
+ * Example Usage:
+ * @code
+ * m_Simulation.Start(m_GameEngine);
+ * ...
+ * m_GameEngine.CaptureInput();
+ * if (auto world = m_Simulation.TryLockNewFrame(); world.owns_lock())
+ * {
+ *     m_GameEngine.BeginMapFrame();
+ *     m_GameEngine.DrawMap();
+ * }
+ * ...
+ * m_Simulation.Stop();    // before anything else touches the map
+ * @endcode
+ */
+class SimulationThread
+{
+public:
+    // State of the last completed step
+    struct t_Snapshot
+    {
+        uint64_t frame = 0;             // steps since Start
+        double sim_time = 0.0;          // simulated seconds since Start
+        float step_ms = 0.0f;           // cost of the last step
+        float steps_per_second = 0.0f;  // achieved rate over the last second
+        std::string map_id;
+        std::vector<t_MapEntityCount> entity_counts;
+    };
+
+    SimulationThread() = default;
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // Render thread. Makes it the AssetManager's render thread until Stop.
+    void Start(GameEngine& engine);
+
+    // Render thread. Finishes the running step (serving its asset loads)
+    // and joins; a no-op when not running.
+    void Stop();
+
+    bool b_IsRunning() const { return m_Thread.joinable(); }
+
+    // Render thread: owns the world lock only if a step completed since
+    // the last successful call and the simulation is between steps
+    std::unique_lock<std::mutex> TryLockNewFrame();
+
+    t_Snapshot GetSnapshot() const;
+
+    // editor.sim_thread: the editor simulates on this thread while playing
+    static bool b_IsEnabled();
+
+    // editor.sim_rate steps per second; read before every step
+    static int32_t GetRate();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void Run();
+    void PublishSnapshot(float step_ms, double sim_time);
+
+    GameEngine* m_Engine = nullptr;
+    std::thread m_Thread;
+    std::atomic<bool> m_bStop{ false };
+    std::atomic<bool> m_bExited{ false };
+
+    std::mutex m_WorldMutex;
+    std::atomic<uint64_t> m_Frame{ 0 };
+    uint64_t m_DrawnFrame = 0;                  // render thread
+
+    // Set when the render thread found the world locked; the simulation
+    // then lets it in after the step instead of starting the next one
+    std::atomic<bool> m_bDrawWanted{ false };
+    std::mutex m_WakeMutex;
+    std::condition_variable m_Wake;
+
+    mutable std::mutex m_SnapshotMutex;
+    t_Snapshot m_Snapshot;
+    std::deque<Clock::time_point> m_RecentSteps;    // simulation thread
+
+    WorkerMeter m_Meter{ "Simulation" };
+};
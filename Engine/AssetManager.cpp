@@ -0,0 +1,1176 @@
+#include "AssetManager.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+
+// Pack consulted by raylib's LoadFileData callback (one per process)
+static const AssetPack* s_pCallbackPack = nullptr;
+
+// Rebuilds a canonical 44-byte WAV header in front of pre-decoded PCM
+static void s_fWriteWavHeader
+(
+    unsigned char* dst,
+    const t_PackWaveHeader& wave,
+    uint32_t data_size
+)
+{
+    auto put16 = [&](size_t at, uint32_t v)
+    {
+        dst[at] = static_cast<unsigned char>(v & 0xFF);
+        dst[at + 1] = static_cast<unsigned char>((v >> 8) & 0xFF);
+    };
+    auto put32 = [&](size_t at, uint32_t v)
+    {
+        put16(at, v & 0xFFFF);
+        put16(at + 2, v >> 16);
+    };
+
+    const uint32_t BLOCK_ALIGN = wave.channels * (wave.sample_size / 8);
+    std::memcpy(dst, "RIFF", 4);
+    put32(4, 36 + data_size);
+    std::memcpy(dst + 8, "WAVEfmt ", 8);
+    put32(16, 16);
+    put16(20, 1);
+    put16(22, wave.channels);
+    put32(24, wave.sample_rate);
+    put32(28, wave.sample_rate * BLOCK_ALIGN);
+    put16(32, BLOCK_ALIGN);
+    put16(34, wave.sample_size);
+    std::memcpy(dst + 36, "data", 4);
+    put32(40, data_size);
+}
+
+// Header of a pre-decoded wave entry. False when it is cut short or its
+// sample layout does not add up to the entry's decoded body (raw_size).
+static bool s_bfWaveHeader(const AssetPack& pack, const t_PackEntry& entry, t_PackWaveHeader& header)
+{
+    header = t_PackWaveHeader{};
+
+    const std::span<const unsigned char> HEADER_BYTES = pack.GetEntryHeader(entry);
+    if (HEADER_BYTES.size() < sizeof(t_PackWaveHeader))
+    {
+        return false;
+    }
+    std::memcpy(&header, HEADER_BYTES.data(), sizeof(header));
+
+    const bool b_LayoutOk =
+        header.channels > 0 &&
+        (header.sample_size == 8 || header.sample_size == 16 || header.sample_size == 32);
+    const uint64_t EXPECTED_SIZE =
+        static_cast<uint64_t>(header.frame_count) * header.channels * (header.sample_size / 8);
+
+    return b_LayoutOk && EXPECTED_SIZE == entry.raw_size;
+}
+
+// Image description for a pre-decoded texture entry; pixels left unset.
+// False when the header is cut short or describes a different number of
+// pixel bytes than the entry decodes to, since those bytes are uploaded.
+static bool s_bfTextureImageDesc(const AssetPack& pack, const t_PackEntry& entry, Image& image)
+{
+    image = Image{};
+
+    const std::span<const unsigned char> HEADER_BYTES = pack.GetEntryHeader(entry);
+    if (HEADER_BYTES.size() < sizeof(t_PackTextureHeader))
+    {
+        return false;
+    }
+
+    t_PackTextureHeader header{};
+    std::memcpy(&header, HEADER_BYTES.data(), sizeof(header));
+
+    // GetPixelDataSize works in int (at most 16 bytes per pixel)
+    const uint64_t PIXELS = static_cast<uint64_t>(header.width) * header.height;
+    if (PIXELS == 0 || PIXELS > INT_MAX / 16 || header.mipmaps == 0 || header.mipmaps > 32 ||
+        header.format > INT_MAX)
+    {
+        return false;
+    }
+
+    // Mip chain as raylib uploads it: halved per level, at least 1x1
+    uint64_t expected_size = 0;
+    int mip_width = static_cast<int>(header.width);
+    int mip_height = static_cast<int>(header.height);
+    for (uint32_t level = 0; level < header.mipmaps; ++level)
+    {
+        const int MIP_SIZE = GetPixelDataSize(mip_width, mip_height, static_cast<int>(header.format));
+        if (MIP_SIZE <= 0)
+        {
+            return false;
+        }
+        expected_size += static_cast<uint64_t>(MIP_SIZE);
+        mip_width = (std::max)(mip_width / 2, 1);
+        mip_height = (std::max)(mip_height / 2, 1);
+    }
+    if (expected_size != entry.raw_size)
+    {
+        return false;
+    }
+
+    image.width = static_cast<int>(header.width);
+    image.height = static_cast<int>(header.height);
+    image.format = static_cast<int>(header.format);
+    image.mipmaps = static_cast<int>(header.mipmaps);
+    return true;
+}
+
+// Plain raylib loads of a pre-decoded texture still expect an image file,
+// so the pixels are re-encoded. Slow path: use AssetManager::LoadTexture.
+static unsigned char* s_fEncodeTextureEntry
+(
+    const AssetPack& pack,
+    const t_PackEntry& entry,
+    const char* file_name,
+    int* data_size
+)
+{
+    unsigned char* data = nullptr;
+    *data_size = 0;
+
+    Image image{};
+    if (!s_bfTextureImageDesc(pack, entry, image))
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", file_name);
+        return nullptr;
+    }
+    image.data = MemAlloc(static_cast<unsigned int>(entry.raw_size));
+
+    if (pack.b_DecodeBody(entry, image.data, static_cast<size_t>(entry.raw_size)))
+    {
+        // Allocated by raylib, so the caller's UnloadFileData frees it
+        data = ExportImageToMemory(image, ".png", data_size);
+        RW_LOG_INFO("AssetManager", "Re-encoded pre-decoded texture for a direct raylib load: {}", file_name);
+    }
+    else
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", file_name);
+    }
+
+    MemFree(image.data);
+    return data;
+}
+
+static unsigned char* s_fLoadFileDataFromPack
+(
+    const char* file_name,
+    int* data_size
+)
+{
+    const t_PackEntry* entry =
+        s_pCallbackPack ? s_pCallbackPack->FindEntry(file_name) : nullptr;
+
+    if (entry && entry->kind == c_PACK_KIND_TEXTURE)
+    {
+        return s_fEncodeTextureEntry(*s_pCallbackPack, *entry, file_name, data_size);
+    }
+
+    t_PackWaveHeader wave{};
+    if (entry && entry->kind == c_PACK_KIND_WAVE && !s_bfWaveHeader(*s_pCallbackPack, *entry, wave))
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", file_name);
+        *data_size = 0;
+        return nullptr;
+    }
+
+    if (entry)
+    {
+        // raylib frees this buffer itself, so it must come from MemAlloc
+        const size_t PREFIX = entry->kind == c_PACK_KIND_WAVE ? 44 : 0;
+        const size_t TOTAL = PREFIX + static_cast<size_t>(entry->raw_size);
+        auto* data = static_cast<unsigned char*>
+        (
+            MemAlloc(static_cast<unsigned int>(TOTAL))
+        );
+
+        if (PREFIX > 0)
+        {
+            s_fWriteWavHeader(data, wave, static_cast<uint32_t>(entry->raw_size));
+        }
+
+        if (s_pCallbackPack->b_DecodeBody(*entry, data + PREFIX, TOTAL - PREFIX))
+        {
+            *data_size = static_cast<int>(TOTAL);
+            return data;
+        }
+
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", file_name);
+        MemFree(data);
+        *data_size = 0;
+        return nullptr;
+    }
+
+    // Not packed - temporarily drop the callback and read from disk
+    SetLoadFileDataCallback(nullptr);
+    unsigned char* data = LoadFileData(file_name, data_size);
+    SetLoadFileDataCallback(s_fLoadFileDataFromPack);
+    return data;
+}
+
+// Lower-case extension with the dot; raylib's own helpers use a static buffer
+static std::string s_fLowerExtension(const std::string& path)
+{
+    std::string ext = std::filesystem::path(path).extension().string();
+    std::transform
+    (
+        ext.begin(),
+        ext.end(),
+        ext.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); }
+    );
+    return ext;
+}
+
+// Takes one asset parked under path by a hot reload handoff
+template<typename T>
+static bool s_bfTakeParked
+(
+    std::unordered_map<std::string, std::vector<T>>& parked,
+    const char* path,
+    T& out
+)
+{
+    if (parked.empty())
+    {
+        return false;
+    }
+
+    auto it = parked.find(AssetPack::NormalizePath(path));
+    if (it == parked.end() || it->second.empty())
+    {
+        return false;
+    }
+
+    out = it->second.back();
+    it->second.pop_back();
+    if (it->second.empty())
+    {
+        parked.erase(it);
+    }
+    return true;
+}
+
+static bool s_bfReadFile(const std::string& path, std::vector<unsigned char>& out)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    out.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(out.data()), out.size()));
+}
+
+AssetManager::~AssetManager()
+{
+    EndHandoff();
+    UnmountPack();
+}
+
+bool AssetManager::b_MountPack(const std::string& pack_path)
+{
+    UnmountPack();
+
+    if (!m_Pack.b_Open(pack_path))
+    {
+        return false;
+    }
+
+    s_pCallbackPack = &m_Pack;
+    SetLoadFileDataCallback(s_fLoadFileDataFromPack);
+    return true;
+}
+
+void AssetManager::UnmountPack()
+{
+    // The decoder reads from the mapping
+    ClearPrefetch();
+
+    if (s_pCallbackPack == &m_Pack)
+    {
+        SetLoadFileDataCallback(nullptr);
+        s_pCallbackPack = nullptr;
+    }
+    m_Pack.Close();
+}
+
+std::span<const unsigned char> AssetManager::GetFileBytes
+(
+    const char* path,
+    std::vector<unsigned char>& scratch
+) const
+{
+    const t_PackEntry* entry = m_Pack.FindEntry(path);
+    if (!entry || entry->kind != c_PACK_KIND_FILE)
+    {
+        return {};
+    }
+
+    // Uncompressed entries are handed out straight from the mapping
+    if (entry->flags == 0)
+    {
+        return m_Pack.Find(path);
+    }
+
+    scratch.resize(static_cast<size_t>(entry->raw_size));
+    if (!m_Pack.b_DecodeBody(*entry, scratch.data(), scratch.size()))
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", path);
+        return {};
+    }
+    return scratch;
+}
+
+Image AssetManager::DecodePackedImage(const t_PackEntry& entry, const char* path) const
+{
+    Image image{};
+    if (!s_bfTextureImageDesc(m_Pack, entry, image))
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", path);
+        return Image{};
+    }
+    image.data = MemAlloc(static_cast<unsigned int>(entry.raw_size));
+
+    if (!m_Pack.b_DecodeBody(entry, image.data, static_cast<size_t>(entry.raw_size)))
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", path);
+        MemFree(image.data);
+        return Image{};
+    }
+    return image;
+}
+
+Wave AssetManager::DecodePackedWave(const t_PackEntry& entry, const char* path) const
+{
+    t_PackWaveHeader header{};
+    if (!s_bfWaveHeader(m_Pack, entry, header))
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", path);
+        return Wave{};
+    }
+
+    // Samples are inflated chunk by chunk directly into the Wave buffer
+    Wave wave{};
+    wave.frameCount = header.frame_count;
+    wave.sampleRate = header.sample_rate;
+    wave.sampleSize = header.sample_size;
+    wave.channels = header.channels;
+    wave.data = MemAlloc(static_cast<unsigned int>(entry.raw_size));
+
+    if (!m_Pack.b_DecodeBody(entry, wave.data, static_cast<size_t>(entry.raw_size)))
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", path);
+        MemFree(wave.data);
+        return Wave{};
+    }
+    return wave;
+}
+
+Image AssetManager::LoadImage(const char* path) const
+{
+    StartupProfiler::Scope phase(m_pStartupProfiler, "Load", path);
+
+    t_PrefetchEntry prefetched;
+    if (b_TakePrefetched(path, prefetched) && prefetched.image.data)
+    {
+        Image image = prefetched.image;
+        prefetched.image = Image{};
+        return image;
+    }
+    ReleasePrefetched(prefetched);
+
+    const t_PackEntry* entry = m_Pack.FindEntry(path);
+    if (entry && entry->kind == c_PACK_KIND_TEXTURE)
+    {
+        return DecodePackedImage(*entry, path);
+    }
+
+    std::vector<unsigned char> scratch;
+    auto bytes = GetFileBytes(path, scratch);
+    if (bytes.empty())
+    {
+        return ::LoadImage(path);
+    }
+
+    return LoadImageFromMemory
+    (
+        GetFileExtension(path),
+        bytes.data(),
+        static_cast<int>(bytes.size())
+    );
+}
+
+Texture2D AssetManager::LoadTexture(const char* path) const
+{
+    // The upload and the texture bookkeeping belong to the render thread
+    if (!m_RenderTasks.b_IsRenderThread())
+    {
+        return m_RenderTasks.Run([&]() { return LoadTexture(path); });
+    }
+
+    StartupProfiler::Scope phase(m_pStartupProfiler, "Load", path);
+
+    Texture2D texture{};
+    t_PrefetchEntry prefetched;
+    const t_PackEntry* entry = m_Pack.FindEntry(path);
+
+    if (s_bfTakeParked(m_HandoffTextures, path, texture))
+    {
+        ++m_HandoffStats.reused;
+    }
+    else if (b_TakePrefetched(path, prefetched) && (prefetched.texture.id != 0 || prefetched.image.data))
+    {
+        // Uploaded by UpdatePrefetch, or decoded and still waiting for it
+        texture = prefetched.texture.id != 0
+            ? prefetched.texture
+            : LoadTextureFromImage(prefetched.image);
+        prefetched.texture = Texture2D{};
+    }
+    else if (!entry)
+    {
+        texture = ::LoadTexture(path);
+    }
+    else if (entry->kind == c_PACK_KIND_TEXTURE && (entry->flags & c_PACK_FLAG_LZ) == 0)
+    {
+        // Stored pre-decoded pixels upload straight from the mapping, once
+        // the header is known to describe exactly the bytes that are there
+        Image image{};
+        const std::span<const unsigned char> BODY = m_Pack.GetEntryBody(*entry);
+        if (s_bfTextureImageDesc(m_Pack, *entry, image) && BODY.size() == entry->raw_size)
+        {
+            image.data = const_cast<unsigned char*>(BODY.data());
+            texture = LoadTextureFromImage(image);
+        }
+        else
+        {
+            RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", path);
+        }
+    }
+    else
+    {
+        Image image = LoadImage(path);
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    ReleasePrefetched(prefetched);
+    TrackTexture(path, texture);
+    return texture;
+}
+
+void AssetManager::UnloadTexture(const Texture2D& texture) const
+{
+    if (!m_RenderTasks.b_IsRenderThread())
+    {
+        m_RenderTasks.Run([&]() { UnloadTexture(texture); });
+        return;
+    }
+
+    if (m_bHandingOff && texture.id != 0)
+    {
+        for (const auto& [PATH, TEXTURES] : m_LoadedTextures)
+        {
+            const bool b_Tracked = std::any_of
+            (
+                TEXTURES.begin(),
+                TEXTURES.end(),
+                [&](const Texture2D& tracked) { return tracked.id == texture.id; }
+            );
+            if (b_Tracked)
+            {
+                m_HandoffTextures[PATH].push_back(texture);
+                ++m_HandoffStats.parked;
+                TrackTexture(nullptr, texture);
+                return;
+            }
+        }
+    }
+
+    TrackTexture(nullptr, texture);
+    ::UnloadTexture(texture);
+}
+
+static size_t s_fSoundBytes(const Sound& sound)
+{
+    return static_cast<size_t>(sound.frameCount) * sound.stream.channels * sound.stream.sampleSize / 8;
+}
+
+static size_t s_fTextureBytes(const Texture2D& texture)
+{
+    size_t bytes = 0;
+    for (int level = 0; level < (std::max)(texture.mipmaps, 1); ++level)
+    {
+        bytes += static_cast<size_t>(GetPixelDataSize
+        (
+            (std::max)(texture.width >> level, 1),
+            (std::max)(texture.height >> level, 1),
+            texture.format
+        ));
+    }
+    return bytes;
+}
+
+void AssetManager::TrackSound(const char* path, const Sound& sound) const
+{
+    if (sound.stream.buffer &&
+        m_LoadedSounds.insert_or_assign(sound.stream.buffer, AssetPack::NormalizePath(path)).second)
+    {
+        m_LoadedSoundBytes += s_fSoundBytes(sound);
+    }
+}
+
+bool AssetManager::b_ReleaseSound(const Sound& sound) const
+{
+    auto it = m_LoadedSounds.find(sound.stream.buffer);
+    if (it == m_LoadedSounds.end())
+    {
+        return false;
+    }
+
+    std::string path = std::move(it->second);
+    m_LoadedSounds.erase(it);
+    m_LoadedSoundBytes -= (std::min)(m_LoadedSoundBytes, s_fSoundBytes(sound));
+    if (!m_bHandingOff)
+    {
+        return false;
+    }
+
+    m_HandoffSounds[path].push_back(sound);
+    ++m_HandoffStats.parked;
+    return true;
+}
+
+void AssetManager::BeginHandoff()
+{
+    m_bHandingOff = true;
+    m_HandoffStats = {};
+}
+
+t_HandoffStats AssetManager::EndHandoff()
+{
+    for (auto& [PATH, textures] : m_HandoffTextures)
+    {
+        for (const Texture2D& TEXTURE : textures)
+        {
+            ::UnloadTexture(TEXTURE);
+            ++m_HandoffStats.freed;
+        }
+    }
+    for (auto& [PATH, sounds] : m_HandoffSounds)
+    {
+        for (const Sound& SOUND : sounds)
+        {
+            ::UnloadSound(SOUND);
+            ++m_HandoffStats.freed;
+        }
+    }
+    m_HandoffTextures.clear();
+    m_HandoffSounds.clear();
+    m_bHandingOff = false;
+
+    const t_HandoffStats STATS = m_HandoffStats;
+    m_HandoffStats = {};
+    return STATS;
+}
+
+void AssetManager::TrackTexture(const char* path, const Texture2D& texture) const
+{
+    if (texture.id == 0)
+    {
+        return;
+    }
+
+    // GL ids are recycled, so an id seen again means the old owner is gone
+    for (auto it = m_LoadedTextures.begin(); it != m_LoadedTextures.end();)
+    {
+        std::erase_if
+        (
+            it->second,
+            [&](const Texture2D& tracked) { return tracked.id == texture.id; }
+        );
+        it = it->second.empty() ? m_LoadedTextures.erase(it) : std::next(it);
+    }
+
+    if (path)
+    {
+        m_LoadedTextures[AssetPack::NormalizePath(path)].push_back(texture);
+    }
+}
+
+int AssetManager::ReloadTexture(const std::string& path)
+{
+    auto it = m_LoadedTextures.find(AssetPack::NormalizePath(path));
+    if (it == m_LoadedTextures.end())
+    {
+        return 0;
+    }
+
+    // Always the loose file: hot reload is an editor feature
+    Image image = ::LoadImage(path.c_str());
+    if (!image.data)
+    {
+        RW_LOG_ERROR("AssetManager", "Failed to reload: {}", path);
+        return 0;
+    }
+
+    int updated = 0;
+    for (const Texture2D& TEXTURE : it->second)
+    {
+        if (image.width != TEXTURE.width || image.height != TEXTURE.height)
+        {
+            RW_LOG_WARNING
+            (
+                "AssetManager",
+                "{} changed size ({}x{} -> {}x{}), restart the map to apply",
+                path,
+                TEXTURE.width,
+                TEXTURE.height,
+                image.width,
+                image.height
+            );
+            continue;
+        }
+
+        if (image.format != TEXTURE.format)
+        {
+            ImageFormat(&image, TEXTURE.format);
+        }
+        UpdateTexture(TEXTURE, image.data);
+        ++updated;
+    }
+
+    UnloadImage(image);
+    return updated;
+}
+
+Wave AssetManager::LoadWave(const char* path) const
+{
+    StartupProfiler::Scope phase(m_pStartupProfiler, "Load", path);
+
+    t_PrefetchEntry prefetched;
+    if (b_TakePrefetched(path, prefetched) && prefetched.wave.data)
+    {
+        Wave wave = prefetched.wave;
+        prefetched.wave = Wave{};
+        return wave;
+    }
+    ReleasePrefetched(prefetched);
+
+    const t_PackEntry* entry = m_Pack.FindEntry(path);
+    if (entry && entry->kind == c_PACK_KIND_WAVE)
+    {
+        return DecodePackedWave(*entry, path);
+    }
+
+    std::vector<unsigned char> scratch;
+    auto bytes = GetFileBytes(path, scratch);
+    if (bytes.empty())
+    {
+        return ::LoadWave(path);
+    }
+
+    return LoadWaveFromMemory
+    (
+        GetFileExtension(path),
+        bytes.data(),
+        static_cast<int>(bytes.size())
+    );
+}
+
+Sound AssetManager::LoadSound(const char* path) const
+{
+    // Not a GL call, but the sound bookkeeping is shared with the loads above
+    if (!m_RenderTasks.b_IsRenderThread())
+    {
+        return m_RenderTasks.Run([&]() { return LoadSound(path); });
+    }
+
+    StartupProfiler::Scope phase(m_pStartupProfiler, "Load", path);
+
+    Sound sound{};
+    t_PrefetchEntry prefetched;
+    if (s_bfTakeParked(m_HandoffSounds, path, sound))
+    {
+        ++m_HandoffStats.reused;
+    }
+    else if (b_TakePrefetched(path, prefetched))
+    {
+        sound = prefetched.sound;
+        if (!sound.stream.buffer && prefetched.wave.data)
+        {
+            sound = LoadSoundFromWave(prefetched.wave);
+        }
+        prefetched.sound = Sound{};
+        ReleasePrefetched(prefetched);
+    }
+
+    if (!sound.stream.buffer)
+    {
+        if (!m_Pack.b_Contains(path))
+        {
+            sound = ::LoadSound(path);
+        }
+        else
+        {
+            Wave wave = LoadWave(path);
+            sound = LoadSoundFromWave(wave);
+            UnloadWave(wave);
+        }
+    }
+
+    TrackSound(path, sound);
+    return sound;
+}
+
+Font AssetManager::LoadFont(const char* path, int font_size) const
+{
+    if (!m_RenderTasks.b_IsRenderThread())
+    {
+        return m_RenderTasks.Run([&]() { return LoadFont(path, font_size); });
+    }
+
+    StartupProfiler::Scope phase(m_pStartupProfiler, "Load", path);
+
+    // Glyph rasterizing needs the GL context, so only the file read is prefetched
+    std::vector<unsigned char> scratch;
+    t_PrefetchEntry prefetched;
+    std::span<const unsigned char> bytes;
+    if (b_TakePrefetched(path, prefetched) && !prefetched.bytes.empty())
+    {
+        scratch = std::move(prefetched.bytes);
+        bytes = scratch;
+    }
+    else
+    {
+        ReleasePrefetched(prefetched);
+        bytes = GetFileBytes(path, scratch);
+    }
+
+    if (bytes.empty())
+    {
+        return LoadFontEx(path, font_size, nullptr, 0);
+    }
+
+    return LoadFontFromMemory
+    (
+        GetFileExtension(path),
+        bytes.data(),
+        static_cast<int>(bytes.size()),
+        font_size,
+        nullptr,
+        0
+    );
+}
+
+bool AssetManager::b_LoadLevel(const char* path, LevelFile& out) const
+{
+    StartupProfiler::Scope phase(m_pStartupProfiler, "Load", path);
+
+    const t_PackEntry* entry = m_Pack.FindEntry(path);
+    if (!entry || entry->kind != c_PACK_KIND_FILE)
+    {
+        return out.b_Open(path);
+    }
+
+    // Stored entries are used in place inside the pack's own mapping
+    if (entry->flags == 0)
+    {
+        return out.b_OpenMemory(m_Pack.Find(path), path);
+    }
+
+    std::vector<unsigned char> bytes(static_cast<size_t>(entry->raw_size));
+    if (!m_Pack.b_DecodeBody(*entry, bytes.data(), bytes.size()))
+    {
+        RW_LOG_ERROR("AssetManager", "Corrupt pack entry: {}", path);
+        return false;
+    }
+    return out.b_OpenBuffer(std::move(bytes), path);
+}
+
+/*
++--------------------------------------------------------+
+|                        PREFETCH                        |
++--------------------------------------------------------+
+*/
+
+void AssetManager::SetPrefetchSet
+(
+    const std::vector<std::string>& paths, 
+    const std::string& owner
+)
+{
+    // Released entries may hold uploaded textures
+    if (!m_RenderTasks.b_IsRenderThread())
+    {
+        m_RenderTasks.Run([&]() { SetPrefetchSet(paths, owner); });
+        return;
+    }
+
+    std::vector<t_PrefetchEntry> released;
+    size_t queued = 0;
+    {
+        std::lock_guard lock(m_PrefetchMutex);
+
+        m_PrefetchOwners.erase(owner);
+        for (const std::string& PATH : paths)
+        {
+            m_PrefetchOwners[owner].insert(AssetPack::NormalizePath(PATH));
+        }
+
+        std::unordered_set<std::string> wanted;
+        for (const auto& [name, keys] : m_PrefetchOwners)
+        {
+            wanted.insert(keys.begin(), keys.end());
+        }
+
+        for (auto it = m_Prefetch.begin(); it != m_Prefetch.end();)
+        {
+            t_PrefetchEntry& entry = it->second;
+            if (wanted.contains(it->first))
+            {
+                entry.b_Cancelled = false;
+                ++it;
+            }
+            else if (entry.state == PrefetchState::Decoding)
+            {
+                // The decoder drops it when it finishes
+                entry.b_Cancelled = true;
+                ++it;
+            }
+            else
+            {
+                released.push_back(std::move(entry));
+                it = m_Prefetch.erase(it);
+            }
+        }
+
+        std::erase_if
+        (
+            m_PrefetchQueue,
+            [this](const std::string& key) { return !m_Prefetch.contains(key); }
+        );
+
+        for (const std::string& KEY : wanted)
+        {
+            if (m_Prefetch.try_emplace(KEY).second)
+            {
+                m_PrefetchQueue.push_back(KEY);
+                ++queued;
+            }
+        }
+
+        if (queued > 0 && !m_PrefetchThread.joinable())
+        {
+            m_bStopPrefetch = false;
+            m_PrefetchThread = std::thread(&AssetManager::PrefetchWorker, this);
+        }
+    }
+    m_PrefetchCv.notify_all();
+
+    for (t_PrefetchEntry& entry : released)
+    {
+        ReleasePrefetched(entry);
+    }
+
+    if (queued > 0 || !released.empty())
+    {
+        RW_LOG_INFO("AssetManager", "Prefetching {} new asset(s), released {}", queued, released.size());
+    }
+}
+
+void AssetManager::PrefetchWorker()
+{
+    std::unique_lock lock(m_PrefetchMutex);
+    while (true)
+    {
+        m_PrefetchCv.wait(lock, [this] { return m_bStopPrefetch || !m_PrefetchQueue.empty(); });
+        if (m_bStopPrefetch)
+        {
+            return;
+        }
+
+        const std::string KEY = std::move(m_PrefetchQueue.front());
+        m_PrefetchQueue.pop_front();
+
+        auto it = m_Prefetch.find(KEY);
+        if (it == m_Prefetch.end())
+        {
+            continue;
+        }
+        it->second.state = PrefetchState::Decoding;
+
+        lock.unlock();
+        t_PrefetchEntry decoded;
+        {
+            WorkerMeter::Scope busy(m_PrefetchMeter);
+            DecodePrefetch(KEY, decoded);
+        }
+        decoded.state = PrefetchState::Decoded;
+        lock.lock();
+
+        // Entries being decoded are never erased by the main thread
+        it = m_Prefetch.find(KEY);
+        if (it->second.b_Cancelled)
+        {
+            m_Prefetch.erase(it);
+            ReleasePrefetched(decoded);
+        }
+        else
+        {
+            it->second = std::move(decoded);
+        }
+        m_PrefetchCv.notify_all();
+    }
+}
+
+void AssetManager::DecodePrefetch(const std::string& path, t_PrefetchEntry& out) const
+{
+    const t_PackEntry* entry = m_Pack.FindEntry(path);
+    if (entry && entry->kind == c_PACK_KIND_TEXTURE)
+    {
+        out.image = DecodePackedImage(*entry, path.c_str());
+        return;
+    }
+    if (entry && entry->kind == c_PACK_KIND_WAVE)
+    {
+        out.wave = DecodePackedWave(*entry, path.c_str());
+        return;
+    }
+
+    std::vector<unsigned char> scratch;
+    auto bytes = GetFileBytes(path.c_str(), scratch);
+    if (bytes.empty())
+    {
+        if (!s_bfReadFile(path, scratch))
+        {
+            RW_LOG_WARNING("AssetManager", "Prefetch could not read: {}", path);
+            return;
+        }
+        bytes = scratch;
+    }
+
+    static const std::unordered_set<std::string> IMAGE_TYPES =
+    {
+        ".png", ".bmp", ".tga", ".jpg", ".jpeg", ".gif", ".qoi", ".psd", ".hdr"
+    };
+    static const std::unordered_set<std::string> WAVE_TYPES =
+    {
+        ".wav", ".ogg", ".mp3", ".flac", ".qoa"
+    };
+
+    const std::string EXT = s_fLowerExtension(path);
+    if (IMAGE_TYPES.contains(EXT))
+    {
+        out.image = LoadImageFromMemory(EXT.c_str(), bytes.data(), static_cast<int>(bytes.size()));
+    }
+    else if (WAVE_TYPES.contains(EXT))
+    {
+        out.wave = LoadWaveFromMemory(EXT.c_str(), bytes.data(), static_cast<int>(bytes.size()));
+    }
+    else
+    {
+        out.bytes.assign(bytes.begin(), bytes.end());
+    }
+}
+
+void AssetManager::UpdatePrefetch(double budget_ms)
+{
+    const auto START = std::chrono::steady_clock::now();
+    auto elapsed_ms = [&START]()
+    {
+        return std::chrono::duration<double, std::milli>
+        (
+            std::chrono::steady_clock::now() - START
+        ).count();
+    };
+
+    std::lock_guard lock(m_PrefetchMutex);
+    for (auto& [key, entry] : m_Prefetch)
+    {
+        if (entry.state != PrefetchState::Decoded)
+        {
+            continue;
+        }
+        if (elapsed_ms() > budget_ms)
+        {
+            break;
+        }
+
+        if (entry.image.data)
+        {
+            entry.texture = LoadTextureFromImage(entry.image);
+            UnloadImage(entry.image);
+            entry.image = Image{};
+        }
+        else if (entry.wave.data && IsAudioDeviceReady())
+        {
+            entry.sound = LoadSoundFromWave(entry.wave);
+            UnloadWave(entry.wave);
+            entry.wave = Wave{};
+        }
+        entry.state = PrefetchState::Resident;
+    }
+}
+
+bool AssetManager::b_TakePrefetched(const char* path, t_PrefetchEntry& out) const
+{
+    std::unique_lock lock(m_PrefetchMutex);
+    if (m_Prefetch.empty())
+    {
+        return false;
+    }
+
+    const std::string KEY = AssetPack::NormalizePath(path);
+    auto it = m_Prefetch.find(KEY);
+    if (it == m_Prefetch.end())
+    {
+        return false;
+    }
+
+    // The request is fulfilled either way; don't decode it again
+    for (auto& [name, keys] : m_PrefetchOwners)
+    {
+        keys.erase(KEY);
+    }
+
+    // Not started yet: loading it here is no slower than waiting
+    if (it->second.state == PrefetchState::Queued)
+    {
+        m_Prefetch.erase(it);
+        return false;
+    }
+
+    m_PrefetchCv.wait
+    (
+        lock,
+        [&]
+        {
+            auto found = m_Prefetch.find(KEY);
+            return found == m_Prefetch.end() || found->second.state != PrefetchState::Decoding;
+        }
+    );
+
+    it = m_Prefetch.find(KEY);
+    if (it == m_Prefetch.end())
+    {
+        return false;
+    }
+
+    out = std::move(it->second);
+    m_Prefetch.erase(it);
+    return true;
+}
+
+void AssetManager::ReleasePrefetched(t_PrefetchEntry& entry)
+{
+    if (entry.image.data)
+    {
+        UnloadImage(entry.image);
+    }
+    if (entry.wave.data)
+    {
+        UnloadWave(entry.wave);
+    }
+    if (entry.texture.id != 0)
+    {
+        ::UnloadTexture(entry.texture);
+    }
+    if (entry.sound.stream.buffer)
+    {
+        ::UnloadSound(entry.sound);
+    }
+    entry = t_PrefetchEntry{};
+}
+
+void AssetManager::ClearPrefetch()
+{
+    {
+        std::lock_guard lock(m_PrefetchMutex);
+        m_bStopPrefetch = true;
+    }
+    m_PrefetchCv.notify_all();
+
+    if (m_PrefetchThread.joinable())
+    {
+        m_PrefetchThread.join();
+    }
+
+    std::lock_guard lock(m_PrefetchMutex);
+    for (auto& [key, entry] : m_Prefetch)
+    {
+        ReleasePrefetched(entry);
+    }
+    m_Prefetch.clear();
+    m_PrefetchOwners.clear();
+    m_PrefetchQueue.clear();
+    m_bStopPrefetch = false;
+}
+
+t_AssetMemoryStats AssetManager::GetMemoryStats() const
+{
+    t_AssetMemoryStats stats;
+    for (const auto& [PATH, TEXTURES] : m_LoadedTextures)
+    {
+        for (const Texture2D& TEXTURE : TEXTURES)
+        {
+            stats.texture_bytes += s_fTextureBytes(TEXTURE);
+        }
+    }
+    stats.sound_bytes = m_LoadedSoundBytes;
+    stats.pack_bytes = m_Pack.GetMappedSize();
+
+    std::lock_guard lock(m_PrefetchMutex);
+    for (const auto& [KEY, ENTRY] : m_Prefetch)
+    {
+        if (ENTRY.image.data)
+        {
+            stats.prefetch_bytes += static_cast<size_t>(GetPixelDataSize(ENTRY.image.width, ENTRY.image.height, ENTRY.image.format));
+        }
+        if (ENTRY.wave.data)
+        {
+            stats.prefetch_bytes += static_cast<size_t>(ENTRY.wave.frameCount) * ENTRY.wave.channels * ENTRY.wave.sampleSize / 8;
+        }
+        stats.prefetch_bytes += ENTRY.texture.id != 0 ? s_fTextureBytes(ENTRY.texture) : 0;
+        stats.prefetch_bytes += ENTRY.sound.stream.buffer ? s_fSoundBytes(ENTRY.sound) : 0;
+        stats.prefetch_bytes += ENTRY.bytes.size();
+    }
+    return stats;
+}
+
+size_t AssetManager::GetPrefetchCount() const
+{
+    std::lock_guard lock(m_PrefetchMutex);
+    return m_Prefetch.size();
+}
+
+size_t AssetManager::GetPrefetchPendingCount() const
+{
+    std::lock_guard lock(m_PrefetchMutex);
+    return static_cast<size_t>(std::count_if
+    (
+        m_Prefetch.begin(),
+        m_Prefetch.end(),
+        [](const auto& pair) { return pair.second.state != PrefetchState::Resident; }
+    ));
+}
+
+size_t AssetManager::GetPrefetchPendingCount(const std::vector<std::string>& paths) const
+{
+    std::lock_guard lock(m_PrefetchMutex);
+    return static_cast<size_t>(std::count_if
+    (
+        paths.begin(),
+        paths.end(),
+        [this](const std::string& path)
+        {
+            const auto IT = m_Prefetch.find(AssetPack::NormalizePath(path));
+            return IT != m_Prefetch.end() && IT->second.state != PrefetchState::Resident;
+        }
+    ));
+}
@@ -0,0 +1,219 @@
+#pragma once
+#include "AssetPack.h"
+#include "EngineStats.h"
+#include "LevelFile.h"
+#include "RenderTaskQueue.h"
+#include "StartupProfiler.h"
+#include <raylib.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Resolves asset loads against a mounted .pak or the loose Assets/ tree
+ *
+ * Maps receive the engine's AssetManager through GameMap::GetAssets(), so
+ * the same call works in the editor (loose files) and in an exported game
+ * (Assets.pak). Packed assets are decoded straight out of the mapped
+ * archive; compressed entries are inflated chunk by chunk, pre-decoded
+ * sounds land directly in the final Wave buffer, and pre-decoded textures
+ * are uploaded from the mapping without any image decode.
+ *
+ * Textures are remembered by path so ReloadTexture() can push edited
+ * pixels into the existing GPU texture; maps keep their handles.
+ *
+ * SetPrefetchSet() decodes assets on a background thread ahead of time;
+ * UpdatePrefetch() uploads them on the main thread within a small budget,
+ * and the next Load* call for that path takes the resident result.
+ *
+ * BeginHandoff() / EndHandoff() bracket a GameLogic hot reload: textures
+ * and sounds the outgoing maps unload are parked by path instead of
+ * freed, and the incoming maps' Load* calls take them back untouched.
+ *
+ * Example Usage:
+ * @code
+ * m_Tileset = GetAssets().LoadTexture("Assets/tileset.png");
+ * m_Jump    = GetAssets().LoadSound("Assets/Sounds/jump.wav");
+ * @endcode
+ */
+// Outcome of one BeginHandoff() / EndHandoff() window
+struct t_HandoffStats
+{
+    int parked = 0;     // unloaded by the outgoing maps and kept alive
+    int reused = 0;     // taken back by a Load* call
+    int freed = 0;      // never claimed, unloaded by EndHandoff()
+};
+
+// Memory held by the AssetManager, for the editor's Performance panel
+struct t_AssetMemoryStats
+{
+    size_t texture_bytes = 0;   // GPU memory of live textures, mipmaps included
+    size_t sound_bytes = 0;     // decoded samples of live sounds
+    size_t prefetch_bytes = 0;  // decoded ahead of time and not claimed yet
+    size_t pack_bytes = 0;      // size of the mapped pack (paged in on demand)
+};
+
+class AssetManager
+{
+public:
+    AssetManager() = default;
+    ~AssetManager();
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    // Mounting also routes plain raylib file loads (LoadTexture etc.)
+    // through the pack, so code that bypasses AssetManager keeps working
+    bool b_MountPack(const std::string& pack_path);
+    void UnmountPack();
+    bool b_HasPack() const { return m_Pack.b_IsOpen(); }
+    const AssetPack& GetPack() const { return m_Pack; }
+
+    // Loads are timed as "Load <path>" phases until the first frame
+    void SetStartupProfiler(StartupProfiler* profiler) { m_pStartupProfiler = profiler; }
+
+    Image LoadImage(const char* path) const;
+    Texture2D LoadTexture(const char* path) const;
+    Wave LoadWave(const char* path) const;
+    Sound LoadSound(const char* path) const;
+    Font LoadFont(const char* path, int font_size) const;
+
+    // Opens a .rwl level without copying it: loose files are mapped, and
+    // stored pack entries are read from the pack's mapping, so the level
+    // must be closed before UnmountPack(). Compressed entries are decoded
+    // into a buffer the LevelFile owns.
+    bool b_LoadLevel(const char* path, LevelFile& out) const;
+
+    // Unloads and stops tracking a texture returned by LoadTexture()
+    void UnloadTexture(const Texture2D& texture) const;
+
+    // Stops tracking a sound returned by LoadSound(). Returns true if it
+    // was parked for a handoff instead, in which case the caller must not
+    // unload it (AudioMixer::UnloadSound does this).
+    bool b_ReleaseSound(const Sound& sound) const;
+
+    // Parks unloaded textures and sounds until EndHandoff(), which frees
+    // the ones no Load* call took back
+    void BeginHandoff();
+    t_HandoffStats EndHandoff();
+    bool b_IsHandingOff() const { return m_bHandingOff; }
+
+    // Re-decodes an edited image from disk and updates every live texture
+    // loaded from that path in place. Returns how many were updated; a
+    // texture whose size changed is skipped, since its handle stores the
+    // old dimensions, and still needs a map restart.
+    int ReloadTexture(const std::string& path);
+
+    // Replaces the owner's set of paths to keep decoded ahead of time; the
+    // decoder works on the union of all owners. New paths are queued,
+    // resident assets no owner wants are freed. Load* calls consume
+    // entries as they hit, which also fulfils the request.
+    void SetPrefetchSet
+    (
+        const std::vector<std::string>& paths, 
+        const std::string& owner = ""
+    );
+
+    // Main thread, once per frame: uploads decoded images/waves to the
+    // GPU/audio device until budget_ms is spent
+    void UpdatePrefetch(double budget_ms = 2.0);
+
+    // Stops the decoder and frees every unclaimed prefetched asset
+    void ClearPrefetch();
+
+    size_t GetPrefetchCount() const;
+
+    // Prefetched assets not yet ready to hand out (queued, decoding or
+    // waiting for their upload)
+    size_t GetPrefetchPendingCount() const;
+
+    // The same, counting only these paths; other owners' requests (a
+    // WorldStreamer's chunks) do not hold it up
+    size_t GetPrefetchPendingCount(const std::vector<std::string>& paths) const;
+
+    t_AssetMemoryStats GetMemoryStats() const;
+
+    // LoadTexture, UnloadTexture, LoadSound, LoadFont and SetPrefetchSet
+    // called off the render thread run through this queue, so a map can
+    // load from its Update while the editor simulates on its own thread
+    RenderTaskQueue& GetRenderTasks() const { return m_RenderTasks; }
+
+private:
+    enum class PrefetchState
+    {
+        Queued,
+        Decoding,
+        Decoded,
+        Resident
+    };
+
+    // Exactly one payload is set once decoded, depending on the file type
+    struct t_PrefetchEntry
+    {
+        PrefetchState state = PrefetchState::Queued;
+        bool b_Cancelled = false;
+        Image image{};
+        Wave wave{};
+        Texture2D texture{};
+        Sound sound{};
+        std::vector<unsigned char> bytes;
+    };
+
+    // Takes the prefetched entry for path, waiting if it is mid-decode.
+    // Returns false if nothing usable was prefetched.
+    bool b_TakePrefetched(const char* path, t_PrefetchEntry& out) const;
+    static void ReleasePrefetched(t_PrefetchEntry& entry);
+
+    void PrefetchWorker();
+
+    // Background decode; reads through the pack or std::ifstream only,
+    // since raylib's file callback is not safe to swap off the main thread
+    void DecodePrefetch(const std::string& path, t_PrefetchEntry& out) const;
+
+    Image DecodePackedImage(const t_PackEntry& entry, const char* path) const;
+    Wave DecodePackedWave(const t_PackEntry& entry, const char* path) const;
+
+    // Raw file bytes for a packed FILE entry: zero-copy when stored,
+    // otherwise decoded into scratch. Empty if the path is not packed.
+    std::span<const unsigned char> GetFileBytes
+    (
+        const char* path,
+        std::vector<unsigned char>& scratch
+    ) const;
+
+    void TrackTexture(const char* path, const Texture2D& texture) const;
+    void TrackSound(const char* path, const Sound& sound) const;
+
+    AssetPack m_Pack;
+    StartupProfiler* m_pStartupProfiler = nullptr;
+
+    // Live textures by normalized path, for in-place hot reload
+    mutable std::unordered_map<std::string, std::vector<Texture2D>> m_LoadedTextures;
+
+    // Live sounds by audio buffer, so a handoff knows their paths
+    mutable std::unordered_map<const rAudioBuffer*, std::string> m_LoadedSounds;
+    mutable size_t m_LoadedSoundBytes = 0;
+
+    // Assets parked during a hot reload, by normalized path
+    bool m_bHandingOff = false;
+    mutable t_HandoffStats m_HandoffStats;
+    mutable std::unordered_map<std::string, std::vector<Texture2D>> m_HandoffTextures;
+    mutable std::unordered_map<std::string, std::vector<Sound>> m_HandoffSounds;
+
+    // Prefetch cache by normalized path, shared with the decoder thread
+    mutable std::mutex m_PrefetchMutex;
+    mutable std::condition_variable m_PrefetchCv;
+    mutable std::unordered_map<std::string, t_PrefetchEntry> m_Prefetch;
+    mutable std::unordered_map<std::string, std::unordered_set<std::string>> m_PrefetchOwners;
+    std::deque<std::string> m_PrefetchQueue;
+    std::thread m_PrefetchThread;
+    bool m_bStopPrefetch = false;
+    WorkerMeter m_PrefetchMeter{ "Asset prefetch" };
+    mutable RenderTaskQueue m_RenderTasks;
+};
@@ -0,0 +1,294 @@
+#include "AssetPack.h"
+#include "LZCodec.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstring>
+
+/*
++--------------------------------------------------------+
+|                      ASSET PACK                        |
++--------------------------------------------------------+
+*/
+
+// True if [offset, offset + count * stride) lies inside size bytes
+static bool s_bfRangeFits(uint64_t offset, uint64_t count, uint64_t stride, size_t size)
+{
+    if (offset > size)
+    {
+        return false;
+    }
+    return count <= (size - offset) / stride;
+}
+
+// Smallest header an entry of this kind can carry; decoders read the
+// fixed-size struct straight from the mapping
+static uint64_t s_fMinHeaderSize(uint32_t kind)
+{
+    switch (kind)
+    {
+        case c_PACK_KIND_WAVE:    return sizeof(t_PackWaveHeader);
+        case c_PACK_KIND_TEXTURE: return sizeof(t_PackTextureHeader);
+        default:                  return 0;
+    }
+}
+
+AssetPack::~AssetPack()
+{
+    Close();
+}
+
+bool AssetPack::b_Open(const std::string& pack_path)
+{
+    Close();
+
+    std::string map_error;
+    if (!m_File.b_Open(pack_path, &map_error))
+    {
+        RW_LOG_ERROR("AssetPack", "{}", map_error);
+        return false;
+    }
+
+    m_pBase = m_File.GetData();
+    m_Size = m_File.GetSize();
+
+    m_PackPath = pack_path;
+
+    // Validate header and table of contents before trusting any offsets
+    if (m_Size < sizeof(t_PackHeader))
+    {
+        RW_LOG_ERROR("AssetPack", "File too small: {}", pack_path);
+        Close();
+        return false;
+    }
+
+    t_PackHeader header{};
+    std::memcpy(&header, m_pBase, sizeof(header));
+
+    if (std::memcmp(header.magic, c_PACK_MAGIC.data(), 4) != 0 ||
+        header.version != c_PACK_VERSION)
+    {
+        RW_LOG_ERROR("AssetPack", "Unsupported pack format: {}", pack_path);
+        Close();
+        return false;
+    }
+
+    // Offsets come from the file, so the bounds are checked without sums
+    // that a crafted header could wrap around
+    const bool b_TablesOk =
+        s_bfRangeFits(sizeof(t_PackHeader), header.entry_count, sizeof(t_PackEntry), m_Size) &&
+        s_bfRangeFits(header.string_table_offset, header.string_table_size, 1, m_Size);
+
+    if (!b_TablesOk)
+    {
+        RW_LOG_ERROR("AssetPack", "Corrupt table of contents: {}", pack_path);
+        Close();
+        return false;
+    }
+
+    m_Entries = std::span<const t_PackEntry>
+    (
+        reinterpret_cast<const t_PackEntry*>(m_pBase + sizeof(t_PackHeader)),
+        header.entry_count
+    );
+    m_pStringTable = reinterpret_cast<const char*>
+    (
+        m_pBase + header.string_table_offset
+    );
+
+    for (const t_PackEntry& ENTRY : m_Entries)
+    {
+        bool b_PathOk =
+            static_cast<uint64_t>(ENTRY.path_offset) + ENTRY.path_length <=
+            header.string_table_size;
+        bool b_DataOk =
+            ENTRY.offset <= m_Size && ENTRY.size <= m_Size - ENTRY.offset &&
+            ENTRY.header_size <= ENTRY.size &&
+            ENTRY.header_size >= s_fMinHeaderSize(ENTRY.kind);
+
+        // A stored body is the decoded body; stored textures are uploaded
+        // from the mapping, so it must hold all raw_size bytes
+        if ((ENTRY.flags & c_PACK_FLAG_LZ) == 0)
+        {
+            b_DataOk = b_DataOk && ENTRY.size - ENTRY.header_size == ENTRY.raw_size;
+        }
+
+        if (!b_PathOk || !b_DataOk)
+        {
+            RW_LOG_ERROR("AssetPack", "Corrupt entry in: {}", pack_path);
+            Close();
+            return false;
+        }
+    }
+
+    RW_LOG_INFO
+    (
+        "AssetPack",
+        "Mounted '{}' ({} entries, {} KB)",
+        pack_path,
+        m_Entries.size(),
+        m_Size / 1024
+    );
+    return true;
+}
+
+void AssetPack::Close()
+{
+    m_File.Close();
+    m_pBase = nullptr;
+    m_Size = 0;
+    m_Entries = {};
+    m_pStringTable = nullptr;
+    m_PackPath.clear();
+}
+
+std::span<const unsigned char> AssetPack::Find(std::string_view path) const
+{
+    const t_PackEntry* entry = FindEntry(path);
+    if (!entry || entry->kind != c_PACK_KIND_FILE || entry->flags != 0)
+    {
+        return {};
+    }
+    return { m_pBase + entry->offset, static_cast<size_t>(entry->size) };
+}
+
+std::span<const unsigned char> AssetPack::GetEntryHeader
+(
+    const t_PackEntry& entry
+) const
+{
+    return { m_pBase + entry.offset, entry.header_size };
+}
+
+std::span<const unsigned char> AssetPack::GetEntryBody
+(
+    const t_PackEntry& entry
+) const
+{
+    return
+    {
+        m_pBase + entry.offset + entry.header_size,
+        static_cast<size_t>(entry.size - entry.header_size)
+    };
+}
+
+bool AssetPack::b_DecodeBody
+(
+    const t_PackEntry& entry,
+    void* dst,
+    size_t dst_size
+) const
+{
+    if (dst_size != entry.raw_size)
+    {
+        return false;
+    }
+
+    const unsigned char* ip = m_pBase + entry.offset + entry.header_size;
+    const unsigned char* iend = m_pBase + entry.offset + entry.size;
+    auto* op = static_cast<unsigned char*>(dst);
+
+    if ((entry.flags & c_PACK_FLAG_LZ) == 0)
+    {
+        if (static_cast<size_t>(iend - ip) != dst_size)
+        {
+            return false;
+        }
+        std::memcpy(op, ip, dst_size);
+        return true;
+    }
+
+    // Decode one chunk at a time so only a small window of the mapping
+    // is touched before its output lands in the destination buffer
+    size_t remaining = dst_size;
+    while (remaining > 0)
+    {
+        if (iend - ip < 4)
+        {
+            return false;
+        }
+
+        uint32_t chunk_header;
+        std::memcpy(&chunk_header, ip, sizeof(chunk_header));
+        ip += sizeof(chunk_header);
+
+        const size_t STORED = chunk_header & ~c_PACK_CHUNK_RAW_BIT;
+        const size_t RAW = remaining < c_PACK_CHUNK_SIZE ?
+            remaining : c_PACK_CHUNK_SIZE;
+
+        if (static_cast<size_t>(iend - ip) < STORED)
+        {
+            return false;
+        }
+
+        if (chunk_header & c_PACK_CHUNK_RAW_BIT)
+        {
+            if (STORED != RAW)
+            {
+                return false;
+            }
+            std::memcpy(op, ip, RAW);
+        }
+        else if (!b_LZDecompress(ip, STORED, op, RAW))
+        {
+            return false;
+        }
+
+        ip += STORED;
+        op += RAW;
+        remaining -= RAW;
+    }
+
+    return true;
+}
+
+bool AssetPack::b_Contains(std::string_view path) const
+{
+    return FindEntry(path) != nullptr;
+}
+
+std::string AssetPack::NormalizePath(std::string_view path)
+{
+    std::string result(path);
+    std::replace(result.begin(), result.end(), '\\', '/');
+
+    while (result.rfind("./", 0) == 0)
+    {
+        result.erase(0, 2);
+    }
+    return result;
+}
+
+const t_PackEntry* AssetPack::FindEntry(std::string_view path) const
+{
+    if (!m_pBase || m_Entries.empty())
+    {
+        return nullptr;
+    }
+
+    const std::string KEY = NormalizePath(path);
+
+    auto it = std::lower_bound
+    (
+        m_Entries.begin(),
+        m_Entries.end(),
+        KEY,
+        [this](const t_PackEntry& entry, const std::string& key)
+        {
+            return GetEntryPath(entry) < key;
+        }
+    );
+
+    if (it == m_Entries.end() || GetEntryPath(*it) != KEY)
+    {
+        return nullptr;
+    }
+    return &(*it);
+}
+
+std::string_view AssetPack::GetEntryPath(const t_PackEntry& entry) const
+{
+    return std::string_view
+    (
+        m_pStringTable + entry.path_offset, entry.path_length
+    );
+}
@@ -0,0 +1,147 @@
+#pragma once
+#include "MappedFile.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/*
++--------------------------------------------------------+
+|                    .PAK FILE LAYOUT                     |
++--------------------------------------------------------+
+
+    t_PackHeader
+    t_PackEntry[entry_count]     sorted by path (binary search)
+    path string table            not null-terminated
+    payloads                     each aligned to c_PACK_ALIGNMENT
+
+Each payload is a kind-specific header (header_size bytes, never
+compressed) followed by the body. With c_PACK_FLAG_LZ the body is a run
+of independently compressed chunks, each prefixed by a uint32 stored size
+(top bit set = chunk kept raw), so it can be decoded chunk by chunk
+straight into its destination buffer.
+
+All integers are little-endian. Paths are stored with forward slashes
+exactly as the game asks for them, e.g. "Assets/tileset.png".
+*/
+
+constexpr std::array<char, 4> c_PACK_MAGIC = { 'R', 'W', 'P', 'K' };
+constexpr uint32_t c_PACK_VERSION = 3;
+constexpr uint64_t c_PACK_ALIGNMENT = 64;
+constexpr uint32_t c_PACK_CHUNK_SIZE = 64 * 1024;
+constexpr uint32_t c_PACK_CHUNK_RAW_BIT = 0x80000000u;
+
+// Entry kinds
+constexpr uint32_t c_PACK_KIND_FILE = 0;      // original file bytes
+constexpr uint32_t c_PACK_KIND_WAVE = 1;      // t_PackWaveHeader + s16 PCM
+constexpr uint32_t c_PACK_KIND_TEXTURE = 2;   // t_PackTextureHeader + pixels
+
+// Entry flags
+constexpr uint32_t c_PACK_FLAG_LZ = 1u << 0;
+
+// Texture header flags
+constexpr uint32_t c_PACK_TEXTURE_PREMULTIPLIED = 1u << 0;
+
+struct t_PackHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t string_table_size;
+    uint64_t string_table_offset;
+};
+
+struct t_PackEntry
+{
+    uint64_t offset;        // payload start (header + stored body)
+    uint64_t size;          // stored payload bytes
+    uint64_t raw_size;      // decoded body bytes
+    uint32_t path_offset;
+    uint32_t path_length;
+    uint32_t kind;
+    uint32_t flags;
+    uint32_t header_size;
+    uint32_t reserved;
+};
+
+// Pre-decoded WAV: matches what raylib's loader produces (16-bit samples)
+struct t_PackWaveHeader
+{
+    uint32_t frame_count;
+    uint32_t sample_rate;
+    uint32_t sample_size;
+    uint32_t channels;
+};
+
+// Pre-decoded image: pixels in a raylib PixelFormat, ready for upload
+struct t_PackTextureHeader
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t format;        // raylib PixelFormat
+    uint32_t mipmaps;
+    uint32_t flags;         // c_PACK_TEXTURE_*
+};
+
+/**
+ * @brief Read-only view over a memory-mapped .pak archive
+ *
+ * The whole archive is mapped once; Find() hands out spans that point
+ * straight into the mapping, so decoders can read asset bytes without
+ * an intermediate copy. Spans stay valid until Close().
+ */
+class AssetPack
+{
+public:
+    AssetPack() = default;
+    ~AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    bool b_Open(const std::string& pack_path);
+    void Close();
+    bool b_IsOpen() const { return m_pBase != nullptr; }
+
+    const t_PackEntry* FindEntry(std::string_view path) const;
+    bool b_Contains(std::string_view path) const;
+
+    // Zero-copy bytes of an uncompressed file entry (empty otherwise)
+    std::span<const unsigned char> Find(std::string_view path) const;
+
+    std::span<const unsigned char> GetEntryHeader(const t_PackEntry& entry) const;
+
+    // Stored body bytes as they sit in the mapping (still compressed if LZ)
+    std::span<const unsigned char> GetEntryBody(const t_PackEntry& entry) const;
+
+    // Streams the body into dst chunk by chunk; dst_size must be raw_size
+    bool b_DecodeBody
+    (
+        const t_PackEntry& entry,
+        void* dst,
+        size_t dst_size
+    ) const;
+
+    size_t GetEntryCount() const { return m_Entries.size(); }
+    size_t GetMappedSize() const { return m_Size; }
+    const std::string& GetPackPath() const { return m_PackPath; }
+
+    // Converts "Assets\\x.png" or "./Assets/x.png" to "Assets/x.png"
+    static std::string NormalizePath(std::string_view path);
+
+private:
+    std::string_view GetEntryPath(const t_PackEntry& entry) const;
+
+    const unsigned char* m_pBase = nullptr;
+    size_t m_Size = 0;
+    std::span<const t_PackEntry> m_Entries;
+    const char* m_pStringTable = nullptr;
+    std::string m_PackPath;
+    MappedFile m_File;
+};
@@ -0,0 +1,471 @@
+#include "AssetPackWriter.h"
+#include "LZCodec.h"
+#include <raylib.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+void AssetPackWriter::AddFile
+(
+    const fs::path& source_file,
+    std::string_view pack_path
+)
+{
+    m_Files.push_back({ source_file, AssetPack::NormalizePath(pack_path) });
+}
+
+static bool s_bfReadFile(const fs::path& path, std::vector<unsigned char>& out)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    out.resize(static_cast<size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(out.data()), static_cast<std::streamsize>(out.size()));
+    return in.good() || in.eof();
+}
+
+/*
+    Converts an 8/16-bit integer PCM WAV into t_PackWaveHeader + s16
+    samples, the same layout raylib's WAV loader produces. Anything else
+    (float, 24-bit, compressed formats) is left as a plain file entry.
+*/
+static bool s_bfConvertWav
+(
+    const std::vector<unsigned char>& file,
+    std::vector<unsigned char>& out_header,
+    std::vector<unsigned char>& out_body
+)
+{
+    auto read16 = [&](size_t at)
+    {
+        return static_cast<uint32_t>(file[at] | (file[at + 1] << 8));
+    };
+    auto read32 = [&](size_t at)
+    {
+        return read16(at) | (read16(at + 2) << 16);
+    };
+
+    if (file.size() < 12 ||
+        std::memcmp(file.data(), "RIFF", 4) != 0 ||
+        std::memcmp(file.data() + 8, "WAVE", 4) != 0)
+    {
+        return false;
+    }
+
+    uint32_t format = 0;
+    uint32_t channels = 0;
+    uint32_t sample_rate = 0;
+    uint32_t bits = 0;
+    const unsigned char* samples = nullptr;
+    size_t sample_bytes = 0;
+
+    size_t cursor = 12;
+    while (cursor + 8 <= file.size())
+    {
+        const uint32_t CHUNK_SIZE = read32(cursor + 4);
+        const size_t BODY = cursor + 8;
+        if (CHUNK_SIZE > file.size() - BODY)
+        {
+            return false;
+        }
+
+        if (std::memcmp(file.data() + cursor, "fmt ", 4) == 0 && CHUNK_SIZE >= 16)
+        {
+            format = read16(BODY);
+            channels = read16(BODY + 2);
+            sample_rate = read32(BODY + 4);
+            bits = read16(BODY + 14);
+        }
+        else if (std::memcmp(file.data() + cursor, "data", 4) == 0)
+        {
+            samples = file.data() + BODY;
+            sample_bytes = CHUNK_SIZE;
+        }
+
+        // Chunks are word aligned
+        cursor = BODY + CHUNK_SIZE + (CHUNK_SIZE & 1);
+    }
+
+    if (format != 1 || channels == 0 || !samples || (bits != 8 && bits != 16))
+    {
+        return false;
+    }
+
+    const size_t BYTES_PER_SAMPLE = bits / 8;
+    const size_t FRAME_COUNT = sample_bytes / (BYTES_PER_SAMPLE * channels);
+    const size_t SAMPLE_COUNT = FRAME_COUNT * channels;
+
+    t_PackWaveHeader header{};
+    header.frame_count = static_cast<uint32_t>(FRAME_COUNT);
+    header.sample_rate = sample_rate;
+    header.sample_size = 16;
+    header.channels = channels;
+
+    out_header.resize(sizeof(header));
+    std::memcpy(out_header.data(), &header, sizeof(header));
+
+    out_body.resize(SAMPLE_COUNT * sizeof(int16_t));
+    auto* dst = reinterpret_cast<int16_t*>(out_body.data());
+    for (size_t i = 0; i < SAMPLE_COUNT; ++i)
+    {
+        if (bits == 8)
+        {
+            // Unsigned 8-bit to signed 16-bit, as dr_wav does
+            dst[i] = static_cast<int16_t>((static_cast<int>(samples[i]) - 128) << 8);
+        }
+        else
+        {
+            dst[i] = static_cast<int16_t>(samples[i * 2] | (samples[i * 2 + 1] << 8));
+        }
+    }
+    return true;
+}
+
+static bool s_bfIsImageExtension(const std::string& extension)
+{
+    return extension == ".png" || extension == ".bmp" || extension == ".tga" ||
+           extension == ".jpg" || extension == ".jpeg" || extension == ".gif" ||
+           extension == ".qoi";
+}
+
+/*
+    Decodes an image once at export time and stores its pixels in the
+    format raylib would upload, so the runtime skips inflate/unfilter and
+    can hand the mapped bytes straight to the GPU. Optional alpha
+    premultiplication is baked in here and recorded in the header.
+*/
+static bool s_bfConvertTexture
+(
+    const std::vector<unsigned char>& file,
+    const std::string& extension,
+    bool b_PremultiplyAlpha,
+    std::vector<unsigned char>& out_header,
+    std::vector<unsigned char>& out_body
+)
+{
+    Image image = LoadImageFromMemory
+    (
+        extension.c_str(),
+        file.data(),
+        static_cast<int>(file.size())
+    );
+    if (!image.data)
+    {
+        return false;
+    }
+
+    t_PackTextureHeader header{};
+    if (b_PremultiplyAlpha)
+    {
+        // Converts to R8G8B8A8 as a side effect
+        ImageAlphaPremultiply(&image);
+        header.flags |= c_PACK_TEXTURE_PREMULTIPLIED;
+    }
+
+    header.width = static_cast<uint32_t>(image.width);
+    header.height = static_cast<uint32_t>(image.height);
+    header.format = static_cast<uint32_t>(image.format);
+    header.mipmaps = static_cast<uint32_t>(image.mipmaps);
+
+    const int PIXEL_BYTES = GetPixelDataSize(image.width, image.height, image.format);
+
+    out_header.resize(sizeof(header));
+    std::memcpy(out_header.data(), &header, sizeof(header));
+
+    const auto* pixels = static_cast<const unsigned char*>(image.data);
+    out_body.assign(pixels, pixels + PIXEL_BYTES);
+
+    UnloadImage(image);
+    return true;
+}
+
+// Chunked LZ body; returns false when compression would not pay off
+static bool s_bfCompressBody
+(
+    const std::vector<unsigned char>& body,
+    std::vector<unsigned char>& out
+)
+{
+    out.clear();
+    std::vector<unsigned char> scratch(LZCompressBound(c_PACK_CHUNK_SIZE));
+
+    for (size_t at = 0; at < body.size(); at += c_PACK_CHUNK_SIZE)
+    {
+        const size_t RAW = std::min<size_t>(c_PACK_CHUNK_SIZE, body.size() - at);
+        size_t stored = LZCompress
+        (
+            body.data() + at, RAW, scratch.data(), scratch.size()
+        );
+
+        uint32_t chunk_header = static_cast<uint32_t>(stored);
+        const unsigned char* chunk_data = scratch.data();
+        if (stored == 0 || stored >= RAW)
+        {
+            chunk_header = static_cast<uint32_t>(RAW) | c_PACK_CHUNK_RAW_BIT;
+            chunk_data = body.data() + at;
+            stored = RAW;
+        }
+
+        const auto* header_bytes = reinterpret_cast<const unsigned char*>(&chunk_header);
+        out.insert(out.end(), header_bytes, header_bytes + sizeof(chunk_header));
+        out.insert(out.end(), chunk_data, chunk_data + stored);
+    }
+
+    // Keep entries that barely shrink uncompressed (e.g. PNG) so they
+    // stay zero-copy at runtime
+    return out.size() < body.size() - body.size() / 10;
+}
+
+// Everything one entry needs before it is written
+struct t_PreparedEntry
+{
+    bool b_Read = false;
+    uint32_t kind = c_PACK_KIND_FILE;
+    uint32_t flags = 0;
+    uint64_t raw_size = 0;
+    uint64_t source_size = 0;
+    std::vector<unsigned char> header;
+    std::vector<unsigned char> stored;      // body, LZ-compressed when that paid off
+};
+
+static void s_fPrepareEntry
+(
+    const fs::path& source,
+    bool b_Compress,
+    bool b_ConvertTextures,
+    bool b_PremultiplyAlpha,
+    t_PreparedEntry& out
+)
+{
+    std::vector<unsigned char> file_bytes;
+    std::vector<unsigned char> body;
+    out.header.clear();
+    out.flags = 0;
+
+    out.b_Read = s_bfReadFile(source, file_bytes);
+    if (!out.b_Read)
+    {
+        return;
+    }
+    out.source_size = file_bytes.size();
+
+    std::string extension = source.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    if (extension == ".wav" && s_bfConvertWav(file_bytes, out.header, body))
+    {
+        out.kind = c_PACK_KIND_WAVE;
+    }
+    else if (b_ConvertTextures && s_bfIsImageExtension(extension) &&
+             s_bfConvertTexture
+             (
+                 file_bytes, extension, b_PremultiplyAlpha, out.header, body
+             ))
+    {
+        out.kind = c_PACK_KIND_TEXTURE;
+    }
+    else
+    {
+        out.kind = c_PACK_KIND_FILE;
+        body.swap(file_bytes);
+    }
+
+    out.raw_size = body.size();
+    if (b_Compress && !body.empty() && s_bfCompressBody(body, out.stored))
+    {
+        out.flags |= c_PACK_FLAG_LZ;
+    }
+    else
+    {
+        out.stored.swap(body);
+    }
+}
+
+bool AssetPackWriter::b_Write
+(
+    const fs::path& out_path,
+    std::string& out_error,
+    t_PackWriteStats* out_stats
+) const
+{
+    // Sort a copy so the on-disk TOC supports binary search
+    std::vector<t_PendingFile> files = m_Files;
+    std::sort
+    (
+        files.begin(),
+        files.end(),
+        [](const t_PendingFile& a, const t_PendingFile& b)
+        {
+            return a.pack_path < b.pack_path;
+        }
+    );
+
+    auto duplicate = std::adjacent_find
+    (
+        files.begin(),
+        files.end(),
+        [](const t_PendingFile& a, const t_PendingFile& b)
+        {
+            return a.pack_path == b.pack_path;
+        }
+    );
+    if (duplicate != files.end())
+    {
+        out_error = "Duplicate pack path: " + duplicate->pack_path;
+        return false;
+    }
+
+    // Build the string table and entry skeletons
+    std::string string_table;
+    std::vector<t_PackEntry> entries(files.size());
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        entries[i].path_offset = static_cast<uint32_t>(string_table.size());
+        entries[i].path_length =
+            static_cast<uint32_t>(files[i].pack_path.size());
+        string_table += files[i].pack_path;
+    }
+
+    t_PackHeader header{};
+    std::memcpy(header.magic, c_PACK_MAGIC.data(), 4);
+    header.version = c_PACK_VERSION;
+    header.entry_count = static_cast<uint32_t>(entries.size());
+    header.string_table_size = static_cast<uint32_t>(string_table.size());
+    header.string_table_offset =
+        sizeof(t_PackHeader) + entries.size() * sizeof(t_PackEntry);
+
+    auto align_up = [](uint64_t value)
+    {
+        return (value + c_PACK_ALIGNMENT - 1) & ~(c_PACK_ALIGNMENT - 1);
+    };
+
+    std::ofstream out(out_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        out_error = "Cannot create " + out_path.string();
+        return false;
+    }
+
+    // Payload sizes are only known after conversion/compression, so the
+    // TOC is written as a placeholder first and patched at the end
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write
+    (
+        reinterpret_cast<const char*>(entries.data()),
+        static_cast<std::streamsize>(entries.size() * sizeof(t_PackEntry))
+    );
+    out.write
+    (
+        string_table.data(),
+        static_cast<std::streamsize>(string_table.size())
+    );
+
+    const size_t THREAD_COUNT = m_ThreadCount > 0 ?
+        m_ThreadCount : static_cast<size_t>((std::max)(1u, std::thread::hardware_concurrency()));
+
+    // Entries are read, converted and compressed in parallel a window at a
+    // time, then written in TOC order; the window bounds how much converted
+    // data is held at once
+    const size_t WINDOW = THREAD_COUNT * 4;
+    std::vector<t_PreparedEntry> prepared((std::min)(WINDOW, files.size()));
+    t_PackWriteStats stats;
+
+    for (size_t first = 0; first < files.size(); first += WINDOW)
+    {
+        const size_t COUNT = (std::min)(WINDOW, files.size() - first);
+        std::atomic<size_t> next_file{ 0 };
+
+        auto prepare_worker = [&]()
+        {
+            for (size_t index = next_file++; index < COUNT; index = next_file++)
+            {
+                s_fPrepareEntry
+                (
+                    files[first + index].source,
+                    m_bCompress,
+                    m_bConvertTextures,
+                    m_bPremultiplyAlpha,
+                    prepared[index]
+                );
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < (std::min)(THREAD_COUNT, COUNT); ++i)
+        {
+            workers.emplace_back(prepare_worker);
+        }
+        prepare_worker();
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (size_t index = 0; index < COUNT; ++index)
+        {
+            const t_PreparedEntry& PREPARED = prepared[index];
+            if (!PREPARED.b_Read)
+            {
+                out_error = "Cannot read " + files[first + index].source.string();
+                return false;
+            }
+
+            // Pad up to the aligned payload offset
+            const uint64_t POSITION = static_cast<uint64_t>(out.tellp());
+            const uint64_t OFFSET = align_up(POSITION);
+            std::vector<char> padding(OFFSET - POSITION, 0);
+            out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+
+            t_PackEntry& entry = entries[first + index];
+            entry.kind = PREPARED.kind;
+            entry.flags = PREPARED.flags;
+            entry.offset = OFFSET;
+            entry.header_size = static_cast<uint32_t>(PREPARED.header.size());
+            entry.raw_size = PREPARED.raw_size;
+            entry.size = PREPARED.header.size() + PREPARED.stored.size();
+
+            out.write
+            (
+                reinterpret_cast<const char*>(PREPARED.header.data()),
+                static_cast<std::streamsize>(PREPARED.header.size())
+            );
+            out.write
+            (
+                reinterpret_cast<const char*>(PREPARED.stored.data()),
+                static_cast<std::streamsize>(PREPARED.stored.size())
+            );
+
+            ++stats.file_count;
+            stats.texture_count += PREPARED.kind == c_PACK_KIND_TEXTURE ? 1 : 0;
+            stats.compressed_count += (PREPARED.flags & c_PACK_FLAG_LZ) ? 1 : 0;
+            stats.source_bytes += PREPARED.source_size;
+            stats.stored_bytes += entry.size;
+        }
+    }
+
+    out.seekp(sizeof(t_PackHeader));
+    out.write
+    (
+        reinterpret_cast<const char*>(entries.data()),
+        static_cast<std::streamsize>(entries.size() * sizeof(t_PackEntry))
+    );
+
+    if (!out.good())
+    {
+        out_error = "Write failed for " + out_path.string();
+        return false;
+    }
+
+    if (out_stats)
+    {
+        *out_stats = stats;
+    }
+    return true;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "AssetPack.h"
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct t_PackWriteStats
+{
+    size_t file_count = 0;
+    size_t compressed_count = 0;
+    size_t texture_count = 0;
+    uint64_t source_bytes = 0;
+    uint64_t stored_bytes = 0;
+};
+
+/**
+ * @brief Builds a .pak archive from files on disk
+ *
+ * Used by the export pipeline: add every asset with the path the game
+ * loads it by, then write the archive in one pass. 8/16-bit PCM WAVs are
+ * stored pre-decoded so the runtime can fill a Wave buffer directly, and
+ * with texture conversion on, images are stored as raw pixels that upload
+ * without a PNG decode. With compression on, an entry is LZ-compressed
+ * only when that saves space. Entries are read, converted and compressed
+ * on several threads; the archive itself is written in one sequential pass.
+ */
+class AssetPackWriter
+{
+public:
+    void AddFile(const fs::path& source_file, std::string_view pack_path);
+    void SetCompression(bool b_Enabled) { m_bCompress = b_Enabled; }
+
+    // Premultiplied textures must be drawn with BLEND_ALPHA_PREMULTIPLY
+    void SetTextureConversion(bool b_Enabled, bool b_PremultiplyAlpha = false)
+    {
+        m_bConvertTextures = b_Enabled;
+        m_bPremultiplyAlpha = b_PremultiplyAlpha;
+    }
+
+    // 0 uses every core
+    void SetThreadCount(size_t count) { m_ThreadCount = count; }
+    size_t GetFileCount() const { return m_Files.size(); }
+
+    bool b_Write
+    (
+        const fs::path& out_path,
+        std::string& out_error,
+        t_PackWriteStats* out_stats = nullptr
+    ) const;
+
+private:
+    struct t_PendingFile
+    {
+        fs::path source;
+        std::string pack_path;
+    };
+
+    std::vector<t_PendingFile> m_Files;
+    bool m_bCompress = false;
+    bool m_bConvertTextures = false;
+    bool m_bPremultiplyAlpha = false;
+    size_t m_ThreadCount = 0;
+};
@@ -0,0 +1,75 @@
+#include "AssetWatcher.h"
+#include <system_error>
+
+void AssetWatcher::Watch(const fs::path& root)
+{
+    m_Root = root;
+    m_Files.clear();
+
+    // Baseline pass: remember everything, report nothing
+    Poll();
+    for (auto& [path, state] : m_Files)
+    {
+        state.b_Pending = false;
+    }
+}
+
+std::vector<std::string> AssetWatcher::Poll()
+{
+    std::vector<std::string> changed;
+    std::error_code ec;
+
+    if (m_Root.empty() || !fs::exists(m_Root, ec))
+    {
+        return changed;
+    }
+
+    for (auto& [path, state] : m_Files)
+    {
+        state.b_Seen = false;
+    }
+
+    for
+    (
+        auto it = fs::recursive_directory_iterator(m_Root, ec);
+        !ec && it != fs::recursive_directory_iterator();
+        it.increment(ec)
+    )
+    {
+        if (!it->is_regular_file(ec))
+        {
+            continue;
+        }
+
+        const auto WRITE_TIME = it->last_write_time(ec);
+        const auto SIZE = it->file_size(ec);
+        if (ec)
+        {
+            // File vanished or is locked mid-save; look again next poll
+            ec.clear();
+            continue;
+        }
+
+        t_FileState& state = m_Files[it->path().generic_string()];
+        state.b_Seen = true;
+
+        if (WRITE_TIME != state.write_time || SIZE != state.size)
+        {
+            state.write_time = WRITE_TIME;
+            state.size = SIZE;
+            state.b_Pending = true;
+        }
+        else if (state.b_Pending)
+        {
+            state.b_Pending = false;
+            changed.push_back(it->path().generic_string());
+        }
+    }
+
+    std::erase_if
+    (
+        m_Files,
+        [](const auto& item) { return !item.second.b_Seen; }
+    );
+    return changed;
+}
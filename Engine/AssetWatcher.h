@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Detects edited files under an asset directory
+ *
+ * Call Poll() periodically. A change is only reported once the file has
+ * looked the same for two polls in a row, so half-written saves from an
+ * image editor are not picked up mid-write.
+ *
+ * Example Usage:
+ * @code
+ * watcher.Watch("Assets");
+ * for (const std::string& path : watcher.Poll())  // "Assets/slime.png"
+ * {
+ *     assets.ReloadTexture(path);
+ * }
+ * @endcode
+ */
+class AssetWatcher
+{
+public:
+    // Records the current state of root; existing files are not reported
+    void Watch(const fs::path& root);
+    bool b_IsWatching() const { return !m_Root.empty(); }
+
+    // Paths (root-prefixed, forward slashes) that changed and have settled
+    std::vector<std::string> Poll();
+
+private:
+    struct t_FileState
+    {
+        fs::file_time_type write_time{};
+        uintmax_t size = 0;
+        bool b_Pending = false;
+        bool b_Seen = false;
+    };
+
+    fs::path m_Root;
+    std::unordered_map<std::string, t_FileState> m_Files;
+};
@@ -0,0 +1,250 @@
+#include "AudioMixer.h"
+#include "AssetManager.h"
+#include "Logger.h"
+#include <algorithm>
+
+AudioMixer::~AudioMixer()
+{
+    Shutdown();
+}
+
+bool AudioMixer::b_Init(int voice_count)
+{
+    if (b_IsReady())
+    {
+        return true;
+    }
+
+    if (!IsAudioDeviceReady())
+    {
+        InitAudioDevice();
+        m_bOwnsDevice = true;
+    }
+
+    if (!IsAudioDeviceReady())
+    {
+        RW_LOG_ERROR("AudioMixer", "Failed to open the audio device");
+        m_bOwnsDevice = false;
+        return false;
+    }
+
+    m_Voices.assign(static_cast<size_t>(std::max(1, voice_count)), t_Voice{});
+    m_FrameStats = {};
+    m_LastFrameStats = {};
+
+    RW_LOG_INFO("AudioMixer", "Ready with {} voices", m_Voices.size());
+    return true;
+}
+
+void AudioMixer::Shutdown()
+{
+    for (t_Voice& voice : m_Voices)
+    {
+        ReleaseVoice(voice);
+    }
+    m_Voices.clear();
+    m_Sounds.clear();
+
+    if (m_bOwnsDevice)
+    {
+        CloseAudioDevice();
+        m_bOwnsDevice = false;
+    }
+}
+
+AudioMixer::t_SoundInfo& AudioMixer::GetSoundInfo(const Sound& sound)
+{
+    auto [it, b_Inserted] = m_Sounds.try_emplace(sound.stream.buffer);
+    if (b_Inserted)
+    {
+        it->second.sound = sound;
+    }
+    return it->second;
+}
+
+bool AudioMixer::b_IsVoicePlaying(const t_Voice& voice) const
+{
+    return voice.source != nullptr && IsSoundPlaying(voice.alias);
+}
+
+int AudioMixer::CountPlayingVoices() const
+{
+    return static_cast<int>(std::count_if
+    (
+        m_Voices.begin(),
+        m_Voices.end(),
+        [this](const t_Voice& voice) { return b_IsVoicePlaying(voice); }
+    ));
+}
+
+void AudioMixer::ReleaseVoice(t_Voice& voice)
+{
+    if (voice.source)
+    {
+        StopSound(voice.alias);
+        UnloadSoundAlias(voice.alias);
+    }
+    voice = t_Voice{};
+}
+
+bool AudioMixer::Play(const Sound& sound, const t_PlayParams& params)
+{
+    if (!b_IsReady() || !sound.stream.buffer || sound.frameCount == 0)
+    {
+        return false;
+    }
+
+    t_SoundInfo& info = GetSoundInfo(sound);
+    if (info.last_trigger_frame == m_Frame)
+    {
+        ++m_FrameStats.coalesced;
+        return false;
+    }
+
+    // Weakest playing voice: lowest priority, then oldest
+    auto b_Weaker = [](const t_Voice& a, const t_Voice& b)
+    {
+        return a.priority != b.priority ? a.priority < b.priority : a.serial < b.serial;
+    };
+
+    int instances = 0;
+    int weakest_instance = -1;
+    int free_slot = -1;
+    int weakest_voice = -1;
+
+    for (int i = 0; i < static_cast<int>(m_Voices.size()); ++i)
+    {
+        const t_Voice& VOICE = m_Voices[i];
+        if (!b_IsVoicePlaying(VOICE))
+        {
+            // Prefer a slot already aliasing this sound: no alias rebuild
+            if (free_slot < 0 || VOICE.source == sound.stream.buffer)
+            {
+                free_slot = i;
+            }
+            continue;
+        }
+
+        if (weakest_voice < 0 || b_Weaker(VOICE, m_Voices[weakest_voice]))
+        {
+            weakest_voice = i;
+        }
+        if (VOICE.source == sound.stream.buffer)
+        {
+            ++instances;
+            if (weakest_instance < 0 || b_Weaker(VOICE, m_Voices[weakest_instance]))
+            {
+                weakest_instance = i;
+            }
+        }
+    }
+
+    int slot = free_slot;
+    int victim = -1;
+    if (instances >= info.max_instances)
+    {
+        victim = weakest_instance;
+    }
+    else if (slot < 0)
+    {
+        victim = weakest_voice;
+    }
+
+    if (victim >= 0)
+    {
+        if (m_Voices[victim].priority > params.priority)
+        {
+            ++m_FrameStats.rejected;
+            return false;
+        }
+        StopSound(m_Voices[victim].alias);
+        slot = victim;
+        ++m_FrameStats.stolen;
+    }
+
+    t_Voice& voice = m_Voices[slot];
+    if (voice.source != sound.stream.buffer)
+    {
+        ReleaseVoice(voice);
+        voice.alias = LoadSoundAlias(sound);
+        voice.source = sound.stream.buffer;
+    }
+
+    voice.priority = params.priority;
+    voice.serial = m_NextSerial++;
+
+    SetSoundVolume(voice.alias, params.volume);
+    SetSoundPitch(voice.alias, params.pitch);
+    SetSoundPan(voice.alias, params.pan);
+    ::PlaySound(voice.alias);
+
+    info.last_trigger_frame = m_Frame;
+    ++m_FrameStats.started;
+    m_FrameStats.peak_voices = std::max(m_FrameStats.peak_voices, CountPlayingVoices());
+    return true;
+}
+
+void AudioMixer::Stop(const Sound& sound)
+{
+    for (t_Voice& voice : m_Voices)
+    {
+        if (voice.source == sound.stream.buffer)
+        {
+            StopSound(voice.alias);
+        }
+    }
+}
+
+void AudioMixer::StopAll()
+{
+    for (t_Voice& voice : m_Voices)
+    {
+        if (voice.source)
+        {
+            StopSound(voice.alias);
+        }
+    }
+}
+
+void AudioMixer::SetInstanceLimit(const Sound& sound, int max_instances)
+{
+    if (sound.stream.buffer)
+    {
+        GetSoundInfo(sound).max_instances = std::max(1, max_instances);
+    }
+}
+
+void AudioMixer::UnloadSound(const Sound& sound)
+{
+    if (!sound.stream.buffer)
+    {
+        return;
+    }
+
+    for (t_Voice& voice : m_Voices)
+    {
+        if (voice.source == sound.stream.buffer)
+        {
+            ReleaseVoice(voice);
+        }
+    }
+    m_Sounds.erase(sound.stream.buffer);
+
+    if (m_pAssets && m_pAssets->b_ReleaseSound(sound))
+    {
+        return;
+    }
+    ::UnloadSound(sound);
+}
+
+void AudioMixer::Update()
+{
+    m_FrameStats.voice_count = static_cast<int>(m_Voices.size());
+    m_FrameStats.active_voices = CountPlayingVoices();
+    m_FrameStats.peak_voices = std::max(m_FrameStats.peak_voices, m_FrameStats.active_voices);
+    m_FrameStats.sound_count = m_Sounds.size();
+
+    m_LastFrameStats = m_FrameStats;
+    m_FrameStats = {};
+    ++m_Frame;
+}
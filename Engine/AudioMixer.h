@@ -0,0 +1,121 @@
+#pragma once
+#include <raylib.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class AssetManager;
+
+constexpr int c_AUDIO_DEFAULT_VOICES = 16;
+constexpr int c_AUDIO_DEFAULT_INSTANCE_LIMIT = 4;
+
+// Voice priorities: a voice can only be stolen by an equal or higher one
+constexpr int c_SOUND_PRIORITY_LOW = 0;
+constexpr int c_SOUND_PRIORITY_NORMAL = 50;
+constexpr int c_SOUND_PRIORITY_HIGH = 100;
+
+struct t_PlayParams
+{
+    float volume = 1.0f;
+    float pitch = 1.0f;
+    float pan = 0.5f;
+    int priority = c_SOUND_PRIORITY_NORMAL;
+};
+
+// Counters for the last completed frame (see AudioMixer::Update)
+struct t_MixerStats
+{
+    int voice_count = 0;        // pool size
+    int active_voices = 0;      // playing at the end of the frame
+    int peak_voices = 0;        // most voices playing at once this frame
+    int started = 0;
+    int stolen = 0;             // started by cutting off another voice
+    int rejected = 0;           // dropped: pool or instance limit full of stronger voices
+    int coalesced = 0;          // repeat triggers of one sound within a frame
+    size_t sound_count = 0;     // distinct sounds played so far
+};
+
+/**
+ * @brief Engine audio service with a fixed pool of voices
+ *
+ * Owns the audio device. Every Play() runs on a pooled voice that is an
+ * alias of the loaded Sound, so one decoded buffer backs any number of
+ * overlapping instances without copying samples. The pool size caps how
+ * many buffers the audio thread mixes; when it is full the weakest voice
+ * (lowest priority, then oldest) is stolen, or the new sound is dropped
+ * if everything playing outranks it. Triggering the same sound more than
+ * once in a frame only starts it once.
+ *
+ * Example Usage:
+ * @code
+ * m_Jump = GetAssets().LoadSound("Assets/Sounds/jump.wav");
+ * GetAudio().Play(m_Jump);
+ * GetAudio().Play(m_Hit, { .volume = 0.5f, .priority = c_SOUND_PRIORITY_HIGH });
+ * GetAudio().UnloadSound(m_Jump);   // instead of raylib's UnloadSound
+ * @endcode
+ */
+class AudioMixer
+{
+public:
+    AudioMixer() = default;
+    ~AudioMixer();
+
+    AudioMixer(const AudioMixer&) = delete;
+    AudioMixer& operator=(const AudioMixer&) = delete;
+
+    // Opens the audio device (unless already open) and sizes the pool
+    bool b_Init(int voice_count = c_AUDIO_DEFAULT_VOICES);
+    void Shutdown();
+    bool b_IsReady() const { return !m_Voices.empty(); }
+
+    // Returns false if the sound was dropped or coalesced
+    bool Play(const Sound& sound, const t_PlayParams& params = {});
+    void Stop(const Sound& sound);
+    void StopAll();
+
+    // Maximum overlapping instances of one sound (oldest is replaced)
+    void SetInstanceLimit(const Sound& sound, int max_instances);
+
+    // Stops and frees the sound's voices, then unloads the sound itself.
+    // Aliases read the source's samples, so never UnloadSound() directly.
+    void UnloadSound(const Sound& sound);
+
+    // Sounds it loaded are handed to it on unload, so a hot reload can keep them
+    void SetAssetManager(const AssetManager* assets) { m_pAssets = assets; }
+
+    // Closes the stats frame; call once per frame
+    void Update();
+    const t_MixerStats& GetStats() const { return m_LastFrameStats; }
+
+private:
+    struct t_Voice
+    {
+        Sound alias{};
+        const rAudioBuffer* source = nullptr;
+        int priority = 0;
+        uint64_t serial = 0;
+    };
+
+    struct t_SoundInfo
+    {
+        Sound sound{};
+        int max_instances = c_AUDIO_DEFAULT_INSTANCE_LIMIT;
+        uint64_t last_trigger_frame = UINT64_MAX;
+    };
+
+    t_SoundInfo& GetSoundInfo(const Sound& sound);
+    bool b_IsVoicePlaying(const t_Voice& voice) const;
+    int CountPlayingVoices() const;
+    void ReleaseVoice(t_Voice& voice);
+
+    std::vector<t_Voice> m_Voices;
+    std::unordered_map<const rAudioBuffer*, t_SoundInfo> m_Sounds;
+
+    const AssetManager* m_pAssets = nullptr;
+    bool m_bOwnsDevice = false;
+    uint64_t m_Frame = 0;
+    uint64_t m_NextSerial = 0;
+
+    t_MixerStats m_FrameStats;
+    t_MixerStats m_LastFrameStats;
+};
@@ -0,0 +1,316 @@
+#include "CVar.h"
+#include "Logger.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <sstream>
+
+// This binary's view of the host registry; see AttachEngineCVars
+static std::atomic<CVarRegistry*> s_AttachedRegistry{ nullptr };
+
+/*
++--------------------------------------------------------+
+|                       TEXT FORM                        |
++--------------------------------------------------------+
+*/
+
+bool b_ParseCVarValue(std::string_view text, bool& out)
+{
+    if (text == "true" || text == "1")
+    {
+        out = true;
+        return true;
+    }
+    if (text == "false" || text == "0")
+    {
+        out = false;
+        return true;
+    }
+    return false;
+}
+
+bool b_ParseCVarValue(std::string_view text, int32_t& out)
+{
+    const char* end = text.data() + text.size();
+    const auto RESULT = std::from_chars(text.data(), end, out);
+    return RESULT.ec == std::errc() && RESULT.ptr == end;
+}
+
+bool b_ParseCVarValue(std::string_view text, float& out)
+{
+    const char* end = text.data() + text.size();
+    const auto RESULT = std::from_chars(text.data(), end, out);
+    return RESULT.ec == std::errc() && RESULT.ptr == end;
+}
+
+bool b_ParseCVarValue(std::string_view text, std::string& out)
+{
+    out = text;
+    return true;
+}
+
+std::string FormatCVarValue(bool value)
+{
+    return value ? "true" : "false";
+}
+
+std::string FormatCVarValue(int32_t value)
+{
+    return std::to_string(value);
+}
+
+std::string FormatCVarValue(float value)
+{
+    // Shortest form that reads back as the same float
+    char buffer[32];
+    const auto RESULT = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return std::string(buffer, RESULT.ptr);
+}
+
+std::string FormatCVarValue(const std::string& value)
+{
+    return value;
+}
+
+/*
++--------------------------------------------------------+
+|                        REGISTRY                        |
++--------------------------------------------------------+
+*/
+
+CVarRegistry& CVarRegistry::Get()
+{
+    if (CVarRegistry* host = s_AttachedRegistry.load(std::memory_order_acquire))
+    {
+        return *host;
+    }
+    static CVarRegistry s_Registry;
+    return s_Registry;
+}
+
+void CVarRegistry::Attach(CVarRegistry* host)
+{
+    CVarRegistry& own = Get();
+    if (&own == host)
+    {
+        return;
+    }
+
+    // CVars constructed during the library's static initialization sit in
+    // its own registry; they move to the host, picking up its values
+    const std::vector<CVarBase*> VARS = own.MoveAll();
+    s_AttachedRegistry.store(host, std::memory_order_release);
+    for (CVarBase* var : VARS)
+    {
+        host->Declare(*var);
+    }
+}
+
+std::vector<CVarBase*> CVarRegistry::MoveAll()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::vector<CVarBase*> vars;
+    for (auto& [NAME, entry] : m_Entries)
+    {
+        vars.insert(vars.end(), entry.vars.begin(), entry.vars.end());
+    }
+    m_Entries.clear();
+    return vars;
+}
+
+void CVarRegistry::Declare(CVarBase& var)
+{
+    std::string value;
+    bool b_Apply = false;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        t_Entry& entry = m_Entries[var.GetName()];
+
+        // A second copy (a reloaded library next to its replacement) starts
+        // from the live value
+        if (!entry.vars.empty())
+        {
+            value = entry.vars.front()->GetString();
+            b_Apply = true;
+        }
+        else if (entry.b_HasValue)
+        {
+            value = entry.value;
+            b_Apply = true;
+        }
+        entry.vars.push_back(&var);
+        entry.value.clear();
+        entry.b_HasValue = false;
+        var.m_Registry = this;
+    }
+
+    if (b_Apply && !var.b_SetFromString(value))
+    {
+        RW_LOG_WARNING("CVar", "'{}' = '{}' is not a valid value, keeping {}", var.GetName(), value, var.GetString());
+    }
+}
+
+void CVarRegistry::Undeclare(CVarBase& var)
+{
+    CVarRegistry* registry = var.m_Registry;
+    if (!registry)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(registry->m_Mutex);
+    var.m_Registry = nullptr;
+
+    auto it = registry->m_Entries.find(var.GetName());
+    if (it == registry->m_Entries.end())
+    {
+        return;
+    }
+
+    t_Entry& entry = it->second;
+    std::erase(entry.vars, &var);
+    if (!entry.vars.empty())
+    {
+        return;
+    }
+
+    // Keep a changed value for the next declaration (the reloaded library)
+    const std::string VALUE = var.GetString();
+    if (VALUE != var.GetDefaultString())
+    {
+        entry.value = VALUE;
+        entry.b_HasValue = true;
+    }
+    else
+    {
+        registry->m_Entries.erase(it);
+    }
+}
+
+bool CVarRegistry::b_Set(std::string_view name, std::string_view value)
+{
+    std::vector<CVarBase*> vars;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Entries.find(name);
+        if (it == m_Entries.end())
+        {
+            it = m_Entries.emplace(std::string(name), t_Entry{}).first;
+        }
+
+        t_Entry& entry = it->second;
+        if (entry.vars.empty())
+        {
+            entry.value = value;
+            entry.b_HasValue = true;
+            return true;
+        }
+        vars = entry.vars;
+    }
+
+    // Outside the lock: callbacks run and may use the registry
+    bool b_Parsed = true;
+    for (CVarBase* var : vars)
+    {
+        b_Parsed = var->b_SetFromString(value) && b_Parsed;
+    }
+    return b_Parsed;
+}
+
+bool CVarRegistry::b_ResetToDefault(std::string_view name)
+{
+    std::string default_value;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Entries.find(name);
+        if (it == m_Entries.end())
+        {
+            return false;
+        }
+        if (it->second.vars.empty())
+        {
+            // Nothing declared it, so there is no default to go back to
+            m_Entries.erase(it);
+            return true;
+        }
+        default_value = it->second.vars.front()->GetDefaultString();
+    }
+    return b_Set(name, default_value);
+}
+
+int CVarRegistry::ApplyCommandLine(int argc, char** argv)
+{
+    int applied = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view ARG = argv[i];
+        const size_t EQUALS = ARG.find('=');
+        if (!ARG.starts_with('+') || EQUALS == std::string_view::npos || EQUALS == 1)
+        {
+            continue;
+        }
+
+        const std::string_view NAME = ARG.substr(1, EQUALS - 1);
+        const std::string_view VALUE = ARG.substr(EQUALS + 1);
+        if (b_Set(NAME, VALUE))
+        {
+            ++applied;
+        }
+        else
+        {
+            RW_LOG_WARNING("CVar", "Command line: '{}' is not a valid value for {}", VALUE, NAME);
+        }
+    }
+    return applied;
+}
+
+std::vector<CVarRegistry::t_CVarInfo> CVarRegistry::GetAll() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    std::vector<t_CVarInfo> infos;
+    infos.reserve(m_Entries.size());
+    for (const auto& [NAME, ENTRY] : m_Entries)
+    {
+        t_CVarInfo info;
+        info.name = NAME;
+        if (ENTRY.vars.empty())
+        {
+            info.value = ENTRY.value;
+        }
+        else
+        {
+            const CVarBase& VAR = *ENTRY.vars.front();
+            info.description = VAR.GetDescription();
+            info.value = VAR.GetString();
+            info.default_value = VAR.GetDefaultString();
+            info.type = VAR.GetType();
+            info.flags = VAR.GetFlags();
+            info.b_Declared = true;
+            info.b_HasRange = VAR.b_GetRange(info.min, info.max);
+        }
+        infos.push_back(std::move(info));
+    }
+    return infos;
+}
+
+std::string CVarRegistry::GenerateConfigString() const
+{
+    std::ostringstream ss;
+    for (const t_CVarInfo& INFO : GetAll())
+    {
+        const bool b_Write = !INFO.b_Declared ||
+            b_HasFlag(INFO.flags, CVarFlags::Archive) ||
+            INFO.value != INFO.default_value;
+        if (b_Write)
+        {
+            ss << INFO.name << "=" << INFO.value << "\n";
+        }
+    }
+    return ss.str();
+}
+
+void AttachEngineCVars(CVarRegistry* host)
+{
+    CVarRegistry::Attach(host);
+}
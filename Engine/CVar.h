@@ -0,0 +1,414 @@
+#pragma once
+#include "EngineExport.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+enum class CVarType : uint8_t
+{
+    Bool,
+    Int,
+    Float,
+    String
+};
+
+enum class CVarFlags : uint8_t
+{
+    None = 0,
+    Archive = 1 << 0,           // always written to config.ini, even at its default
+    RestartRequired = 1 << 1    // read once at startup; changes apply on the next run
+};
+
+constexpr CVarFlags operator|(CVarFlags a, CVarFlags b)
+{
+    return static_cast<CVarFlags>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+}
+
+constexpr bool b_HasFlag(CVarFlags flags, CVarFlags flag)
+{
+    return (static_cast<uint8_t>(flags) & static_cast<uint8_t>(flag)) != 0;
+}
+
+class CVarRegistry;
+
+/**
+ * @brief Type-erased part of a CVar, what the registry and the editor see
+ */
+class CVarBase
+{
+public:
+    CVarBase(const CVarBase&) = delete;
+    CVarBase& operator=(const CVarBase&) = delete;
+
+    const std::string& GetName() const { return m_Name; }
+    const std::string& GetDescription() const { return m_Description; }
+    CVarType GetType() const { return m_Type; }
+    CVarFlags GetFlags() const { return m_Flags; }
+
+    virtual std::string GetString() const = 0;
+    virtual std::string GetDefaultString() const = 0;
+
+    // false when value does not parse as the CVar's type
+    virtual bool b_SetFromString(std::string_view value) = 0;
+
+    // Numeric CVars declared with a range; the editor shows a slider
+    virtual bool b_GetRange(double&, double&) const { return false; }
+
+protected:
+    CVarBase(std::string_view name, std::string_view description, CVarType type, CVarFlags flags)
+        : m_Name(name), m_Description(description), m_Type(type), m_Flags(flags)
+    {
+    }
+    virtual ~CVarBase() = default;
+
+private:
+    friend class CVarRegistry;
+
+    std::string m_Name;
+    std::string m_Description;
+    CVarType m_Type;
+    CVarFlags m_Flags;
+    CVarRegistry* m_Registry = nullptr;     // set while declared
+};
+
+/**
+ * @brief Name -> CVar table shared by the executable and the GameLogic libraries
+ *
+ * Values can be set before the CVar that owns them is declared (config.ini
+ * is read before GameLogic is loaded); the registry keeps them as text and
+ * applies them on declaration. A value changed at runtime also survives
+ * its CVar going away, so a hot reload keeps tweaks: the new library's
+ * CVar starts from the old one's value.
+ *
+ * Like the Logger, every binary the Engine is linked into has a registry
+ * of its own. The host passes its registry to a library it loads
+ * (AttachEngineCVars), which moves the library's CVars over to it.
+ *
+ * Example Usage:
+ * @code
+ * CVarRegistry::Get().b_Set("demo.gravity", "900");   // config.ini, editor
+ * CVarRegistry::Get().ApplyCommandLine(argc, argv);    // +demo.gravity=900
+ * @endcode
+ */
+class CVarRegistry
+{
+public:
+    struct t_CVarInfo
+    {
+        std::string name;
+        std::string description;
+        std::string value;
+        std::string default_value;      // empty while not declared
+        CVarType type = CVarType::String;
+        CVarFlags flags = CVarFlags::None;
+        bool b_Declared = false;        // false: only a value from config.ini or the command line
+        bool b_HasRange = false;
+        double min = 0.0;
+        double max = 0.0;
+    };
+
+    CVarRegistry() = default;
+    CVarRegistry(const CVarRegistry&) = delete;
+    CVarRegistry& operator=(const CVarRegistry&) = delete;
+
+    // The host's registry once attached, else this binary's own
+    static CVarRegistry& Get();
+    static void Attach(CVarRegistry* host);
+
+    // Sets a declared CVar (running its callbacks) or keeps the value for
+    // when it is declared. false if it does not parse as the CVar's type.
+    bool b_Set(std::string_view name, std::string_view value);
+    bool b_ResetToDefault(std::string_view name);
+
+    // Applies every "+name=value" argument; returns how many were set
+    int ApplyCommandLine(int argc, char** argv);
+
+    // Sorted by name
+    std::vector<t_CVarInfo> GetAll() const;
+
+    // name=value lines for config.ini: Archive CVars, CVars changed from
+    // their default, and values whose CVar is not declared right now
+    std::string GenerateConfigString() const;
+
+    void Declare(CVarBase& var);
+
+    // Removes var from whichever registry it was declared in
+    static void Undeclare(CVarBase& var);
+
+private:
+    struct t_Entry
+    {
+        // More than one while a reloaded library and its replacement are
+        // both loaded
+        std::vector<CVarBase*> vars;
+
+        // Set from outside or kept from an undeclared CVar
+        std::string value;
+        bool b_HasValue = false;
+    };
+
+    std::vector<CVarBase*> MoveAll();
+
+    mutable std::mutex m_Mutex;
+    std::map<std::string, t_Entry, std::less<>> m_Entries;
+};
+
+/**
+ * @brief Typed runtime-tunable value
+ *
+ * Declared as a static (or member) in the code that reads it; reading is a
+ * relaxed atomic load, so CVars can be polled in Update and Draw. Setting
+ * it, from code, config.ini, the command line or the editor's CVars panel,
+ * runs the change callbacks on the thread that set it.
+ *
+ * T is bool, int32_t, float or std::string. Reading a string CVar copies it
+ * under a lock, so keep those out of per-frame code.
+ *
+ * Example Usage:
+ * @code
+ * static CVar<float> s_Gravity("demo.gravity", 1200.0f, "Downward acceleration (px/s^2)");
+ * static CVar<int32_t> s_Jobs("build.jobs", 0, 0, 64, "Compiler processes, 0 = all cores", CVarFlags::Archive);
+ *
+ * velocity.y += s_Gravity.Get() * delta_time;
+ *
+ * size_t id = s_Jobs.AddCallback([](const int32_t& jobs) { ... });
+ * s_Jobs.RemoveCallback(id);
+ * @endcode
+ */
+template<typename T>
+class CVar final : public CVarBase
+{
+    static_assert
+    (
+        std::is_same_v<T, bool> || std::is_same_v<T, int32_t> ||
+        std::is_same_v<T, float> || std::is_same_v<T, std::string>,
+        "CVar supports bool, int32_t, float and std::string"
+    );
+
+public:
+    using Callback = std::function<void(const T& value)>;
+
+    CVar(std::string_view name, T default_value, std::string_view description, CVarFlags flags = CVarFlags::None);
+
+    // Values are clamped to [min, max]
+    CVar(std::string_view name, T default_value, T min, T max, std::string_view description, CVarFlags flags = CVarFlags::None)
+        requires (std::is_same_v<T, int32_t> || std::is_same_v<T, float>);
+
+    ~CVar() override;
+
+    T Get() const;
+    void Set(T value);
+
+    // The returned id removes the callback again; callbacks capturing an
+    // object must be removed before it is destroyed
+    size_t AddCallback(Callback callback);
+    void RemoveCallback(size_t id);
+
+    std::string GetString() const override;
+    std::string GetDefaultString() const override;
+    bool b_SetFromString(std::string_view value) override;
+    bool b_GetRange(double& min, double& max) const override;
+
+private:
+    static constexpr CVarType GetStaticType();
+
+    using Storage = std::conditional_t<std::is_same_v<T, std::string>, std::string, std::atomic<T>>;
+
+    Storage m_Value;
+    T m_Default;
+    T m_Min{};
+    T m_Max{};
+    bool m_bHasRange = false;
+
+    // Guards the callbacks, and the value of string CVars
+    mutable std::mutex m_Mutex;
+    std::vector<std::pair<size_t, Callback>> m_Callbacks;
+    size_t m_NextCallbackId = 1;
+};
+
+// Text form used by config.ini, the command line and the editor
+bool b_ParseCVarValue(std::string_view text, bool& out);
+bool b_ParseCVarValue(std::string_view text, int32_t& out);
+bool b_ParseCVarValue(std::string_view text, float& out);
+bool b_ParseCVarValue(std::string_view text, std::string& out);
+std::string FormatCVarValue(bool value);
+std::string FormatCVarValue(int32_t value);
+std::string FormatCVarValue(float value);
+std::string FormatCVarValue(const std::string& value);
+
+/*
++--------------------------------------------------------+
+|                     CVAR TEMPLATE                      |
++--------------------------------------------------------+
+*/
+
+template<typename T>
+constexpr CVarType CVar<T>::GetStaticType()
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return CVarType::Bool;
+    }
+    else if constexpr (std::is_same_v<T, int32_t>)
+    {
+        return CVarType::Int;
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+        return CVarType::Float;
+    }
+    else
+    {
+        return CVarType::String;
+    }
+}
+
+template<typename T>
+CVar<T>::CVar(std::string_view name, T default_value, std::string_view description, CVarFlags flags)
+    : CVarBase(name, description, GetStaticType(), flags),
+      m_Value(default_value),
+      m_Default(std::move(default_value))
+{
+    // Here rather than in CVarBase: the registry may apply a stored value,
+    // which needs the derived object to exist
+    CVarRegistry::Get().Declare(*this);
+}
+
+template<typename T>
+CVar<T>::CVar(std::string_view name, T default_value, T min, T max, std::string_view description, CVarFlags flags)
+    requires (std::is_same_v<T, int32_t> || std::is_same_v<T, float>)
+    : CVarBase(name, description, GetStaticType(), flags),
+      m_Value(default_value),
+      m_Default(default_value),
+      m_Min(min),
+      m_Max(max),
+      m_bHasRange(true)
+{
+    CVarRegistry::Get().Declare(*this);
+}
+
+template<typename T>
+CVar<T>::~CVar()
+{
+    CVarRegistry::Undeclare(*this);
+}
+
+template<typename T>
+T CVar<T>::Get() const
+{
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Value;
+    }
+    else
+    {
+        return m_Value.load(std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+void CVar<T>::Set(T value)
+{
+    if constexpr (!std::is_same_v<T, std::string> && !std::is_same_v<T, bool>)
+    {
+        if (m_bHasRange)
+        {
+            value = value < m_Min ? m_Min : (value > m_Max ? m_Max : value);
+        }
+    }
+
+    std::vector<std::pair<size_t, Callback>> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            if (m_Value == value)
+            {
+                return;
+            }
+            m_Value = value;
+        }
+        else
+        {
+            if (m_Value.exchange(value, std::memory_order_relaxed) == value)
+            {
+                return;
+            }
+        }
+        callbacks = m_Callbacks;
+    }
+
+    // Outside the lock, so a callback may read or set CVars itself
+    for (const auto& entry : callbacks)
+    {
+        entry.second(value);
+    }
+}
+
+template<typename T>
+size_t CVar<T>::AddCallback(Callback callback)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const size_t ID = m_NextCallbackId++;
+    m_Callbacks.emplace_back(ID, std::move(callback));
+    return ID;
+}
+
+template<typename T>
+void CVar<T>::RemoveCallback(size_t id)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::erase_if(m_Callbacks, [id](const auto& entry) { return entry.first == id; });
+}
+
+template<typename T>
+std::string CVar<T>::GetString() const
+{
+    return FormatCVarValue(Get());
+}
+
+template<typename T>
+std::string CVar<T>::GetDefaultString() const
+{
+    return FormatCVarValue(m_Default);
+}
+
+template<typename T>
+bool CVar<T>::b_SetFromString(std::string_view value)
+{
+    T parsed{};
+    if (!b_ParseCVarValue(value, parsed))
+    {
+        return false;
+    }
+    Set(std::move(parsed));
+    return true;
+}
+
+template<typename T>
+bool CVar<T>::b_GetRange(double& min, double& max) const
+{
+    if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, float>)
+    {
+        if (m_bHasRange)
+        {
+            min = static_cast<double>(m_Min);
+            max = static_cast<double>(m_Max);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Exported from every binary the Engine is linked into, next to
+// AttachEngineLogger; the host calls it in each GameLogic library it loads
+ENGINE_EXPORT void AttachEngineCVars(CVarRegistry* host);
+using AttachEngineCVarsFunc = void (*)(CVarRegistry*);
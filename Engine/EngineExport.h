@@ -0,0 +1,11 @@
+#pragma once
+
+// C entry points exported from a binary the Engine is linked into, so the
+// host can look them up by name in each GameLogic library it loads
+// (AttachEngineLogger, AttachEngineCVars, AttachEngineStats) and GameLogic
+// libraries can export their own (CreateGameMap, RegisterGameMaps)
+#ifdef _WIN32
+#define ENGINE_EXPORT extern "C" __declspec(dllexport)
+#else
+#define ENGINE_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
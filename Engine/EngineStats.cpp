@@ -0,0 +1,232 @@
+#include "EngineStats.h"
+#include <algorithm>
+
+// This binary's view of the host stats; see AttachEngineStats
+static std::atomic<EngineStats*> s_AttachedStats{ nullptr };
+
+/*
++--------------------------------------------------------+
+|                     WORKER METERS                      |
++--------------------------------------------------------+
+*/
+
+WorkerMeter::WorkerMeter(std::string name)
+    : m_Name(std::move(name))
+{
+    EngineStats::Get().AddWorker(*this);
+}
+
+WorkerMeter::~WorkerMeter()
+{
+    EngineStats::RemoveWorker(*this);
+}
+
+WorkerMeter::Scope::Scope(WorkerMeter& meter)
+    : m_Meter(meter)
+{
+    m_Meter.m_BusySinceNs.store(EngineStats::NowNs(), std::memory_order_relaxed);
+}
+
+WorkerMeter::Scope::~Scope()
+{
+    const int64_t SINCE = m_Meter.m_BusySinceNs.exchange(0, std::memory_order_relaxed);
+    m_Meter.m_BusyNs.fetch_add(static_cast<uint64_t>(EngineStats::NowNs() - SINCE), std::memory_order_relaxed);
+}
+
+uint64_t WorkerMeter::GetBusyNs(int64_t now_ns) const
+{
+    // Total first: a scope closing in between is then missed for now
+    // rather than counted twice
+    const uint64_t BUSY = m_BusyNs.load(std::memory_order_relaxed);
+    const int64_t SINCE = m_BusySinceNs.load(std::memory_order_relaxed);
+    return BUSY + (SINCE != 0 && now_ns > SINCE ? static_cast<uint64_t>(now_ns - SINCE) : 0);
+}
+
+/*
++--------------------------------------------------------+
+|                        COUNTERS                        |
++--------------------------------------------------------+
+*/
+
+EngineStats& EngineStats::Get()
+{
+    if (EngineStats* host = s_AttachedStats.load(std::memory_order_acquire))
+    {
+        return *host;
+    }
+    static EngineStats s_Stats;
+    return s_Stats;
+}
+
+void EngineStats::Attach(EngineStats* host)
+{
+    EngineStats& own = Get();
+    if (&own == host)
+    {
+        return;
+    }
+
+    // Meters created during the library's static initialization move over
+    std::vector<WorkerMeter*> workers;
+    {
+        std::lock_guard<std::mutex> lock(own.m_Mutex);
+        workers.swap(own.m_Workers);
+    }
+    s_AttachedStats.store(host, std::memory_order_release);
+    for (WorkerMeter* worker : workers)
+    {
+        host->AddWorker(*worker);
+    }
+}
+
+int64_t EngineStats::NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+    (
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+void EngineStats::AddUpdateTime(double ms)
+{
+    m_PendingUpdateNs.fetch_add(static_cast<int64_t>(ms * 1e6), std::memory_order_relaxed);
+}
+
+void EngineStats::CountQuad(unsigned int texture_id)
+{
+    ++m_Frame.quads;
+    if (m_bBatchOpen && texture_id == m_BatchTexture && m_BatchQuads < c_RAYLIB_BATCH_QUADS)
+    {
+        ++m_BatchQuads;
+        return;
+    }
+
+    ++m_Frame.draw_calls;
+    if (texture_id != m_BatchTexture)
+    {
+        ++m_Frame.texture_binds;
+    }
+    m_bBatchOpen = true;
+    m_BatchTexture = texture_id;
+    m_BatchQuads = 1;
+}
+
+void EngineStats::EndFrame()
+{
+    const auto NOW = std::chrono::steady_clock::now();
+    const double FRAME_MS = m_LastFrameEnd.time_since_epoch().count() != 0 ?
+        std::chrono::duration<double, std::milli>(NOW - m_LastFrameEnd).count() : 0.0;
+    m_LastFrameEnd = NOW;
+
+    m_Frame.frame_ms = static_cast<float>(FRAME_MS);
+    m_Frame.update_ms = static_cast<float>(m_PendingUpdateNs.exchange(0, std::memory_order_relaxed) / 1e6);
+    m_LastFrame = m_Frame;
+    m_History[m_HistoryNext] = m_Frame;
+    m_HistoryNext = (m_HistoryNext + 1) % c_FRAME_HISTORY_SIZE;
+    m_HistoryCount = (std::min)(m_HistoryCount + 1, c_FRAME_HISTORY_SIZE);
+
+    // EndDrawing submits whatever rlgl still has batched
+    m_Frame = {};
+    m_bBatchOpen = false;
+    m_BatchTexture = 0;
+
+    const int64_t NOW_NS = EngineStats::NowNs();
+    const double FRAME_NS = FRAME_MS * 1e6;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_WorkerLoads.clear();
+    for (WorkerMeter* worker : m_Workers)
+    {
+        // A missed closing scope can make the total dip below the last
+        // reading; it catches up next frame
+        const uint64_t BUSY_NS = worker->GetBusyNs(NOW_NS);
+        const double DELTA_NS = BUSY_NS > worker->m_LastBusyNs ?
+            static_cast<double>(BUSY_NS - worker->m_LastBusyNs) : 0.0;
+        worker->m_LastBusyNs = (std::max)(worker->m_LastBusyNs, BUSY_NS);
+
+        t_WorkerLoad load;
+        load.name = worker->GetName();
+        load.utilization = FRAME_NS > 0.0 ? static_cast<float>((std::min)(DELTA_NS / FRAME_NS, 1.0)) : 0.0f;
+        m_WorkerLoads.push_back(std::move(load));
+    }
+}
+
+std::vector<t_FrameStats> EngineStats::GetHistory() const
+{
+    std::vector<t_FrameStats> history;
+    history.reserve(m_HistoryCount);
+
+    const size_t FIRST = (m_HistoryNext + c_FRAME_HISTORY_SIZE - m_HistoryCount) % c_FRAME_HISTORY_SIZE;
+    for (size_t i = 0; i < m_HistoryCount; ++i)
+    {
+        history.push_back(m_History[(FIRST + i) % c_FRAME_HISTORY_SIZE]);
+    }
+    return history;
+}
+
+void EngineStats::SetMemoryUsage(std::string_view subsystem, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = std::find_if
+    (
+        m_Memory.begin(),
+        m_Memory.end(),
+        [&](const t_MemoryUsage& usage) { return usage.subsystem == subsystem; }
+    );
+
+    if (bytes == 0)
+    {
+        if (it != m_Memory.end())
+        {
+            m_Memory.erase(it);
+        }
+        return;
+    }
+
+    if (it == m_Memory.end())
+    {
+        m_Memory.push_back({ std::string(subsystem), bytes });
+    }
+    else
+    {
+        it->bytes = bytes;
+    }
+}
+
+std::vector<t_MemoryUsage> EngineStats::GetMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Memory;
+}
+
+std::vector<t_WorkerLoad> EngineStats::GetWorkerLoads() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_WorkerLoads;
+}
+
+void EngineStats::AddWorker(WorkerMeter& meter)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    meter.m_Stats = this;
+    meter.m_LastBusyNs = meter.GetBusyNs(NowNs());
+    m_Workers.push_back(&meter);
+}
+
+void EngineStats::RemoveWorker(WorkerMeter& meter)
+{
+    EngineStats* stats = meter.m_Stats;
+    if (!stats)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(stats->m_Mutex);
+    std::erase(stats->m_Workers, &meter);
+    meter.m_Stats = nullptr;
+}
+
+void AttachEngineStats(EngineStats* host)
+{
+    EngineStats::Attach(host);
+}
@@ -0,0 +1,223 @@
+#pragma once
+#include "EngineExport.h"
+#include <raylib.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// raylib submits its 2D batch after this many quads (RL_DEFAULT_BATCH_BUFFER_ELEMENTS)
+constexpr uint32_t c_RAYLIB_BATCH_QUADS = 8192;
+
+// Frames kept for the editor's frame-time graph
+constexpr size_t c_FRAME_HISTORY_SIZE = 240;
+
+// Counters of one completed frame (see EngineStats::EndFrame)
+struct t_FrameStats
+{
+    float frame_ms = 0.0f;          // EndFrame to EndFrame, presentation included
+    float update_ms = 0.0f;         // GameEngine::UpdateMap, or the simulation steps since the last frame
+    float draw_ms = 0.0f;           // GameEngine::DrawMap
+    uint32_t draw_calls = 0;
+    uint32_t texture_binds = 0;     // draw calls that switched to another texture
+    uint32_t quads = 0;             // counted draws submitted
+};
+
+// Busy share of a background worker over the last frame
+struct t_WorkerLoad
+{
+    std::string name;
+    float utilization = 0.0f;       // 0..1
+};
+
+struct t_MemoryUsage
+{
+    std::string subsystem;
+    size_t bytes = 0;
+};
+
+class EngineStats;
+
+/**
+ * @brief Busy-time meter for one background worker thread
+ *
+ * Registers itself with EngineStats for its lifetime. The worker opens a
+ * Scope around each job; time outside of scopes counts as idle, and a job
+ * still running when the frame ends is counted up to that point.
+ *
+ * Example Usage:
+ * @code
+ * WorkerMeter m_Meter{ "Asset prefetch" };
+ * ...
+ * WorkerMeter::Scope busy(m_Meter);       // worker thread, per job
+ * DecodePrefetch(key, decoded);
+ * @endcode
+ */
+class WorkerMeter
+{
+public:
+    explicit WorkerMeter(std::string name);
+    ~WorkerMeter();
+
+    WorkerMeter(const WorkerMeter&) = delete;
+    WorkerMeter& operator=(const WorkerMeter&) = delete;
+
+    // One open scope per meter at a time
+    class Scope
+    {
+    public:
+        explicit Scope(WorkerMeter& meter);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        WorkerMeter& m_Meter;
+    };
+
+    const std::string& GetName() const { return m_Name; }
+
+    // Busy time up to now_ns, including an open scope
+    uint64_t GetBusyNs(int64_t now_ns) const;
+
+private:
+    friend class EngineStats;
+
+    std::string m_Name;
+    std::atomic<uint64_t> m_BusyNs{ 0 };
+    std::atomic<int64_t> m_BusySinceNs{ 0 };    // 0 while idle
+
+    // Guarded by the registry's mutex
+    EngineStats* m_Stats = nullptr;
+    uint64_t m_LastBusyNs = 0;
+};
+
+/**
+ * @brief Per-frame engine counters for the editor's Performance panel
+ *
+ * The host times the map update and draw (GameEngine does) and closes
+ * every frame with EndFrame(), which files the frame into a short history
+ * and turns the worker meters into a utilization figure. Subsystems report
+ * their memory with SetMemoryUsage() whenever it changes or once a frame.
+ *
+ * raylib batches 2D drawing internally and reports no statistics, so draw
+ * calls are mirrored: the *Counted draw helpers below forward to raylib
+ * and record the texture of each quad. As in rlgl, consecutive quads with
+ * one texture share a draw call, a different texture starts a new one, and
+ * BreakBatch() (camera and render mode changes) ends the current batch.
+ * Draws that bypass the helpers (shapes, text) are not counted.
+ *
+ * Like the Logger, the Engine is linked into every GameLogic library, and
+ * AttachEngineStats points a library's EngineStats::Get() at the host's.
+ *
+ * Example Usage:
+ * @code
+ * DrawTextureProCounted(m_TilesetTex, Src, Dst, { 0, 0 }, 0, WHITE);
+ * EngineStats::Get().SetMemoryUsage("World streaming", m_ChunkBytes);
+ *
+ * // Host, after EndDrawing()
+ * EngineStats::Get().EndFrame();
+ * const t_FrameStats& LAST = EngineStats::Get().GetLastFrame();
+ * @endcode
+ */
+class EngineStats
+{
+public:
+    EngineStats() = default;
+
+    EngineStats(const EngineStats&) = delete;
+    EngineStats& operator=(const EngineStats&) = delete;
+
+    static EngineStats& Get();
+    static void Attach(EngineStats* host);
+
+    // steady_clock nanoseconds, the time base of the worker meters
+    static int64_t NowNs();
+
+    // Any thread: the editor can step the map on a simulation thread
+    void AddUpdateTime(double ms);
+
+    // Main thread
+    void AddDrawTime(double ms) { m_Frame.draw_ms += static_cast<float>(ms); }
+    void CountQuad(unsigned int texture_id);
+    void BreakBatch() { m_bBatchOpen = false; }
+    void EndFrame();
+
+    const t_FrameStats& GetLastFrame() const { return m_LastFrame; }
+
+    // Oldest first, at most c_FRAME_HISTORY_SIZE frames
+    std::vector<t_FrameStats> GetHistory() const;
+
+    // Last reported value per subsystem; 0 removes the entry
+    void SetMemoryUsage(std::string_view subsystem, size_t bytes);
+    std::vector<t_MemoryUsage> GetMemoryUsage() const;
+
+    // Utilization of every registered worker over the last frame
+    std::vector<t_WorkerLoad> GetWorkerLoads() const;
+
+    void AddWorker(WorkerMeter& meter);
+    static void RemoveWorker(WorkerMeter& meter);
+
+private:
+    // Main thread only
+    t_FrameStats m_Frame;
+    t_FrameStats m_LastFrame;
+    std::array<t_FrameStats, c_FRAME_HISTORY_SIZE> m_History{};
+    size_t m_HistoryCount = 0;
+    size_t m_HistoryNext = 0;
+    std::chrono::steady_clock::time_point m_LastFrameEnd{};
+
+    std::atomic<int64_t> m_PendingUpdateNs{ 0 };
+
+    // Mirror of rlgl's current batch
+    bool m_bBatchOpen = false;
+    unsigned int m_BatchTexture = 0;
+    uint32_t m_BatchQuads = 0;
+
+    mutable std::mutex m_Mutex;
+    std::vector<t_MemoryUsage> m_Memory;
+    std::vector<WorkerMeter*> m_Workers;
+    std::vector<t_WorkerLoad> m_WorkerLoads;
+};
+
+/*
++--------------------------------------------------------+
+|                     COUNTED DRAWS                      |
++--------------------------------------------------------+
+*/
+
+inline void DrawTextureProCounted
+(
+    Texture2D texture,
+    Rectangle source,
+    Rectangle dest,
+    Vector2 origin,
+    float rotation,
+    Color tint
+)
+{
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+    EngineStats::Get().CountQuad(texture.id);
+}
+
+inline void DrawTextureRecCounted(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+{
+    DrawTextureRec(texture, source, position, tint);
+    EngineStats::Get().CountQuad(texture.id);
+}
+
+inline void DrawTextureExCounted(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    DrawTextureEx(texture, position, rotation, scale, tint);
+    EngineStats::Get().CountQuad(texture.id);
+}
+
+// Exported from every binary the Engine is linked into, next to
+// AttachEngineLogger; the host calls it in each GameLogic library it loads
+ENGINE_EXPORT void AttachEngineStats(EngineStats* host);
+using AttachEngineStatsFunc = void (*)(EngineStats*);
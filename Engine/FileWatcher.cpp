@@ -0,0 +1,619 @@
+#include "FileWatcher.h"
+#include "AssetWatcher.h"
+#include "Logger.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Give up on a path that keeps failing its checks (e.g. deleted for good)
+constexpr auto c_WATCH_GIVE_UP = std::chrono::seconds(10);
+
+// Poll interval of the fallback loop
+constexpr auto c_WATCH_POLL_INTERVAL = std::chrono::milliseconds(100);
+
+/*
++--------------------------------------------------------+
+|                    STABILITY CHECKS                    |
++--------------------------------------------------------+
+*/
+
+enum class FileAccess
+{
+    Free,       // nobody has it open for writing
+    Busy,       // still open by its writer
+    Unknown     // the platform cannot tell
+};
+
+static FileAccess s_fGetFileAccess(const std::string& path)
+{
+#ifdef _WIN32
+    // Linkers and editors hold the file open while writing; an open that
+    // shares nothing only succeeds once they have closed it
+    HANDLE file = CreateFileW
+    (
+        fs::path(path).c_str(),
+        GENERIC_READ,
+        0,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return GetLastError() == ERROR_SHARING_VIOLATION ? FileAccess::Busy : FileAccess::Unknown;
+    }
+    CloseHandle(file);
+    return FileAccess::Free;
+#else
+    (void)path;
+    return FileAccess::Unknown;
+#endif
+}
+
+/*
++--------------------------------------------------------+
+|                      FILE WATCHER                      |
++--------------------------------------------------------+
+*/
+
+FileWatcher::~FileWatcher()
+{
+    Stop();
+}
+
+void FileWatcher::WatchFile(const fs::path& file)
+{
+    m_Files.push_back(file);
+}
+
+void FileWatcher::WatchDirectory(const fs::path& root)
+{
+    m_Directories.push_back(root);
+}
+
+void FileWatcher::SetTiming(std::chrono::milliseconds debounce, std::chrono::milliseconds settle)
+{
+    m_Debounce = debounce;
+    m_Settle = settle;
+}
+
+bool FileWatcher::b_Start()
+{
+    if (b_IsRunning())
+    {
+        return true;
+    }
+
+#ifdef _WIN32
+    m_StopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (!m_StopEvent)
+    {
+        return false;
+    }
+#else
+    if (pipe(m_StopPipe) != 0)
+    {
+        return false;
+    }
+    fcntl(m_StopPipe[0], F_SETFD, FD_CLOEXEC);
+    fcntl(m_StopPipe[1], F_SETFD, FD_CLOEXEC);
+#endif
+
+    m_bStop = false;
+    m_Thread = std::thread(&FileWatcher::RunNative, this);
+    return true;
+}
+
+void FileWatcher::Stop()
+{
+    if (!b_IsRunning())
+    {
+        return;
+    }
+
+    m_bStop = true;
+#ifdef _WIN32
+    SetEvent(m_StopEvent);
+    m_Thread.join();
+    CloseHandle(m_StopEvent);
+    m_StopEvent = nullptr;
+#else
+    const char WAKE = 1;
+    (void)!write(m_StopPipe[1], &WAKE, 1);
+    m_Thread.join();
+    close(m_StopPipe[0]);
+    close(m_StopPipe[1]);
+    m_StopPipe[0] = m_StopPipe[1] = -1;
+#endif
+    m_Pending.clear();
+}
+
+std::vector<std::string> FileWatcher::TakeChanges()
+{
+    std::lock_guard lock(m_ChangesMutex);
+    return std::exchange(m_Changes, {});
+}
+
+void FileWatcher::OnFileEvent(const std::string& path, bool b_Closed)
+{
+    const auto NOW = Clock::now();
+
+    auto [it, b_Inserted] = m_Pending.try_emplace(path);
+    t_Pending& pending = it->second;
+    if (b_Inserted)
+    {
+        pending.first_event = NOW;
+    }
+    // A close already says the writer is done, so it is checked as soon as
+    // the current batch of events is read; a write after a close means the
+    // file is being written again
+    pending.due = b_Closed ? NOW : NOW + m_Debounce;
+    pending.b_Closed = b_Closed;
+}
+
+FileWatcher::Clock::time_point FileWatcher::ProcessPending()
+{
+    const auto NOW = Clock::now();
+    auto next_due = Clock::time_point::max();
+    std::vector<std::string> settled;
+
+    for (auto it = m_Pending.begin(); it != m_Pending.end();)
+    {
+        t_Pending& pending = it->second;
+        if (pending.due > NOW)
+        {
+            next_due = std::min(next_due, pending.due);
+            ++it;
+            continue;
+        }
+
+        std::error_code ec;
+        const uintmax_t SIZE = fs::file_size(it->first, ec);
+        const fs::file_time_type WRITE_TIME = ec ? fs::file_time_type{} : fs::last_write_time(it->first, ec);
+        if (ec)
+        {
+            // Mid-rename or deleted: look again unless it has been gone for long
+            if (NOW - pending.first_event > c_WATCH_GIVE_UP)
+            {
+                it = m_Pending.erase(it);
+                continue;
+            }
+            pending.b_Checked = false;
+            pending.due = NOW + m_Settle;
+            next_due = std::min(next_due, pending.due);
+            ++it;
+            continue;
+        }
+
+        const FileAccess ACCESS = s_fGetFileAccess(it->first);
+        const bool b_Unchanged = pending.b_Checked && SIZE == pending.size && WRITE_TIME == pending.write_time;
+        const bool b_Settled = ACCESS == FileAccess::Free ||
+            (ACCESS == FileAccess::Unknown && (pending.b_Closed || b_Unchanged));
+
+        if (b_Settled)
+        {
+            settled.push_back(it->first);
+            it = m_Pending.erase(it);
+            continue;
+        }
+
+        pending.size = SIZE;
+        pending.write_time = WRITE_TIME;
+        pending.b_Checked = true;
+        pending.due = NOW + (ACCESS == FileAccess::Busy ? m_Debounce : m_Settle);
+        next_due = std::min(next_due, pending.due);
+        ++it;
+    }
+
+    if (!settled.empty())
+    {
+        std::lock_guard lock(m_ChangesMutex);
+        m_Changes.insert(m_Changes.end(), settled.begin(), settled.end());
+    }
+    return next_due;
+}
+
+static int s_fTimeoutMs(FileWatcher::Clock::time_point due)
+{
+    if (due == FileWatcher::Clock::time_point::max())
+    {
+        return -1;
+    }
+
+    const auto REMAINING = std::chrono::ceil<std::chrono::milliseconds>(due - FileWatcher::Clock::now());
+    return static_cast<int>(std::max<long long>(0, REMAINING.count()));
+}
+
+/*
++--------------------------------------------------------+
+|                     NATIVE BACKENDS                    |
++--------------------------------------------------------+
+*/
+
+#if defined(__linux__)
+
+void FileWatcher::RunNative()
+{
+    const int NOTIFY_FD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (NOTIFY_FD < 0)
+    {
+        RW_LOG_WARNING("FileWatcher", "inotify unavailable, polling instead");
+        RunPolling();
+        return;
+    }
+
+    // One watch per directory; a file watch is its parent with a name filter
+    struct t_WatchedDir
+    {
+        fs::path path;                                      // as registered
+        bool b_Recursive = false;                           // report every file
+        std::unordered_map<std::string, std::string> files; // name -> reported path
+    };
+    std::unordered_map<int, t_WatchedDir> watches;
+
+    constexpr uint32_t MASK = IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO;
+
+    auto add_watch = [&](const fs::path& directory) -> t_WatchedDir*
+    {
+        const fs::path WATCH_PATH = directory.empty() ? fs::path(".") : directory;
+        const int WD = inotify_add_watch(NOTIFY_FD, WATCH_PATH.c_str(), MASK);
+        if (WD < 0)
+        {
+            RW_LOG_WARNING("FileWatcher", "Cannot watch {}", WATCH_PATH.string());
+            return nullptr;
+        }
+
+        t_WatchedDir& watched = watches[WD];
+        if (watched.path.empty())
+        {
+            watched.path = directory;
+        }
+        return &watched;
+    };
+
+    auto add_tree = [&](const fs::path& root)
+    {
+        if (t_WatchedDir* watched = add_watch(root))
+        {
+            watched->b_Recursive = true;
+        }
+
+        std::error_code ec;
+        for
+        (
+            auto it = fs::recursive_directory_iterator(root, ec);
+            !ec && it != fs::recursive_directory_iterator();
+            it.increment(ec)
+        )
+        {
+            if (it->is_directory(ec))
+            {
+                if (t_WatchedDir* watched = add_watch(it->path()))
+                {
+                    watched->b_Recursive = true;
+                }
+            }
+        }
+    };
+
+    for (const fs::path& FILE : m_Files)
+    {
+        if (t_WatchedDir* watched = add_watch(FILE.parent_path()))
+        {
+            watched->files[FILE.filename().string()] = FILE.generic_string();
+        }
+    }
+    for (const fs::path& ROOT : m_Directories)
+    {
+        add_tree(ROOT);
+    }
+
+    alignas(inotify_event) std::array<char, 16 * 1024> buffer;
+    while (!m_bStop)
+    {
+        std::array<pollfd, 2> fds{ { { NOTIFY_FD, POLLIN, 0 }, { m_StopPipe[0], POLLIN, 0 } } };
+        if (poll(fds.data(), fds.size(), s_fTimeoutMs(ProcessPending())) < 0 && errno != EINTR)
+        {
+            break;
+        }
+
+        ssize_t length = 0;
+        while ((length = read(NOTIFY_FD, buffer.data(), buffer.size())) > 0)
+        {
+            for (ssize_t offset = 0; offset < length;)
+            {
+                const auto* EVENT = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + EVENT->len);
+
+                auto it = watches.find(EVENT->wd);
+                if (it == watches.end() || EVENT->len == 0)
+                {
+                    continue;
+                }
+
+                const t_WatchedDir& WATCHED = it->second;
+                const std::string NAME = EVENT->name;
+                if (EVENT->mask & IN_ISDIR)
+                {
+                    // New subdirectories of a watched tree are watched too
+                    if (WATCHED.b_Recursive && (EVENT->mask & (IN_CREATE | IN_MOVED_TO)))
+                    {
+                        add_tree(WATCHED.path / NAME);
+                    }
+                    continue;
+                }
+
+                std::string reported;
+                if (auto file = WATCHED.files.find(NAME); file != WATCHED.files.end())
+                {
+                    reported = file->second;
+                }
+                else if (WATCHED.b_Recursive)
+                {
+                    reported = (WATCHED.path / NAME).generic_string();
+                }
+                else
+                {
+                    continue;
+                }
+
+                OnFileEvent(reported, (EVENT->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) != 0);
+            }
+        }
+    }
+
+    close(NOTIFY_FD);
+}
+
+#elif defined(_WIN32)
+
+void FileWatcher::RunNative()
+{
+    // One overlapped ReadDirectoryChangesW per directory; a file watch is
+    // its parent with a name filter
+    struct t_WatchedDir
+    {
+        fs::path path;
+        bool b_Recursive = false;
+        std::unordered_map<std::wstring, std::string> files;
+        HANDLE handle = INVALID_HANDLE_VALUE;
+        OVERLAPPED overlapped{};
+        alignas(DWORD) std::array<char, 32 * 1024> buffer{};
+    };
+    std::vector<std::unique_ptr<t_WatchedDir>> watches;
+
+    constexpr DWORD FILTER = FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE |
+        FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_CREATION;
+
+    auto find_or_add = [&](const fs::path& directory, bool b_Recursive) -> t_WatchedDir*
+    {
+        const fs::path WATCH_PATH = directory.empty() ? fs::path(".") : directory;
+        for (auto& watched : watches)
+        {
+            std::error_code ec;
+            if (fs::equivalent(watched->path.empty() ? fs::path(".") : watched->path, WATCH_PATH, ec))
+            {
+                watched->b_Recursive = watched->b_Recursive || b_Recursive;
+                return watched.get();
+            }
+        }
+
+        auto watched = std::make_unique<t_WatchedDir>();
+        watched->path = directory;
+        watched->b_Recursive = b_Recursive;
+        watched->handle = CreateFileW
+        (
+            WATCH_PATH.c_str(),
+            FILE_LIST_DIRECTORY,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+            nullptr
+        );
+        if (watched->handle == INVALID_HANDLE_VALUE)
+        {
+            RW_LOG_WARNING("FileWatcher", "Cannot watch {}", WATCH_PATH.string());
+            return nullptr;
+        }
+        watched->overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        watches.push_back(std::move(watched));
+        return watches.back().get();
+    };
+
+    auto arm = [&](t_WatchedDir& watched)
+    {
+        ResetEvent(watched.overlapped.hEvent);
+        return ReadDirectoryChangesW
+        (
+            watched.handle,
+            watched.buffer.data(),
+            static_cast<DWORD>(watched.buffer.size()),
+            watched.b_Recursive,
+            FILTER,
+            nullptr,
+            &watched.overlapped,
+            nullptr
+        ) != FALSE;
+    };
+
+    for (const fs::path& FILE : m_Files)
+    {
+        if (t_WatchedDir* watched = find_or_add(FILE.parent_path(), false))
+        {
+            watched->files[FILE.filename().wstring()] = FILE.generic_string();
+        }
+    }
+    for (const fs::path& ROOT : m_Directories)
+    {
+        find_or_add(ROOT, true);
+    }
+
+    std::vector<HANDLE> handles{ m_StopEvent };
+    for (auto& watched : watches)
+    {
+        if (arm(*watched))
+        {
+            handles.push_back(watched->overlapped.hEvent);
+        }
+    }
+
+    while (!m_bStop)
+    {
+        const int TIMEOUT_MS = s_fTimeoutMs(ProcessPending());
+        const DWORD RESULT = WaitForMultipleObjects
+        (
+            static_cast<DWORD>(handles.size()),
+            handles.data(),
+            FALSE,
+            TIMEOUT_MS < 0 ? INFINITE : static_cast<DWORD>(TIMEOUT_MS)
+        );
+        if (RESULT == WAIT_TIMEOUT || RESULT == WAIT_OBJECT_0)
+        {
+            continue;
+        }
+
+        const size_t INDEX = RESULT - WAIT_OBJECT_0;
+        if (INDEX >= handles.size())
+        {
+            break;
+        }
+
+        t_WatchedDir* watched = nullptr;
+        for (auto& candidate : watches)
+        {
+            if (candidate->overlapped.hEvent == handles[INDEX])
+            {
+                watched = candidate.get();
+            }
+        }
+
+        DWORD bytes = 0;
+        if (watched && GetOverlappedResult(watched->handle, &watched->overlapped, &bytes, FALSE) && bytes > 0)
+        {
+            for (DWORD offset = 0;;)
+            {
+                const auto* INFO = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(watched->buffer.data() + offset);
+                const std::wstring NAME(INFO->FileName, INFO->FileNameLength / sizeof(wchar_t));
+
+                std::string reported;
+                if (auto file = watched->files.find(NAME); file != watched->files.end())
+                {
+                    reported = file->second;
+                }
+                else if (watched->b_Recursive)
+                {
+                    reported = (watched->path / NAME).generic_string();
+                }
+
+                if (!reported.empty() && INFO->Action != FILE_ACTION_REMOVED && INFO->Action != FILE_ACTION_RENAMED_OLD_NAME)
+                {
+                    OnFileEvent(reported, INFO->Action == FILE_ACTION_RENAMED_NEW_NAME);
+                }
+
+                if (INFO->NextEntryOffset == 0)
+                {
+                    break;
+                }
+                offset += INFO->NextEntryOffset;
+            }
+        }
+
+        if (watched)
+        {
+            arm(*watched);
+        }
+    }
+
+    for (auto& watched : watches)
+    {
+        CancelIoEx(watched->handle, &watched->overlapped);
+        DWORD bytes = 0;
+        GetOverlappedResult(watched->handle, &watched->overlapped, &bytes, TRUE);
+        CloseHandle(watched->overlapped.hEvent);
+        CloseHandle(watched->handle);
+    }
+}
+
+#else
+
+void FileWatcher::RunNative()
+{
+    RunPolling();
+}
+
+#endif
+
+/*
++--------------------------------------------------------+
+|                    POLLING FALLBACK                    |
++--------------------------------------------------------+
+*/
+
+void FileWatcher::RunPolling()
+{
+    // Same checks as the native loops, just driven by stat instead of events
+    std::unordered_map<std::string, fs::file_time_type> file_times;
+    for (const fs::path& FILE : m_Files)
+    {
+        std::error_code ec;
+        file_times[FILE.generic_string()] = fs::last_write_time(FILE, ec);
+    }
+
+    std::vector<AssetWatcher> trees(m_Directories.size());
+    for (size_t i = 0; i < m_Directories.size(); ++i)
+    {
+        trees[i].Watch(m_Directories[i]);
+    }
+
+    while (!m_bStop)
+    {
+        for (auto& [path, last_write] : file_times)
+        {
+            std::error_code ec;
+            const fs::file_time_type WRITE_TIME = fs::last_write_time(path, ec);
+            if (!ec && WRITE_TIME != last_write)
+            {
+                last_write = WRITE_TIME;
+                OnFileEvent(path, false);
+            }
+        }
+
+        // AssetWatcher already waits for a file to settle across two polls
+        for (AssetWatcher& tree : trees)
+        {
+            std::vector<std::string> changed = tree.Poll();
+            if (!changed.empty())
+            {
+                std::lock_guard lock(m_ChangesMutex);
+                m_Changes.insert(m_Changes.end(), changed.begin(), changed.end());
+            }
+        }
+
+        const auto NEXT_DUE = ProcessPending();
+        const auto WAKE = std::min(NEXT_DUE, Clock::now() + c_WATCH_POLL_INTERVAL);
+#ifdef _WIN32
+        WaitForSingleObject(m_StopEvent, static_cast<DWORD>(std::max(0, s_fTimeoutMs(WAKE))));
+#else
+        std::this_thread::sleep_until(WAKE);
+#endif
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Reports changed files from a background thread
+ *
+ * Watches single files and directory trees with the OS change API
+ * (inotify on Linux, ReadDirectoryChangesW on Windows), so nothing is
+ * stat'ed until something actually changed; other platforms poll on the
+ * watcher thread instead. Events for a path are debounced, then the file
+ * has to pass a stability check before it is reported:
+ *
+ *  - Windows: an exclusive open succeeds, i.e. the writer closed it
+ *  - Linux: the writer closed it (IN_CLOSE_WRITE) or renamed it into place
+ *  - otherwise: size and write time unchanged across one settle interval
+ *
+ * so a linker or image editor that is still writing is never picked up.
+ * Settled paths queue up for TakeChanges(), which only takes a lock and
+ * is meant to be drained once per frame.
+ *
+ * Example Usage:
+ * @code
+ * watcher.WatchFile("GameLogic.dll");
+ * watcher.WatchDirectory("Assets");
+ * watcher.b_Start();
+ *
+ * for (const std::string& path : watcher.TakeChanges())  // "Assets/slime.png"
+ * {
+ *     ...
+ * }
+ * @endcode
+ */
+class FileWatcher
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    FileWatcher() = default;
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Register before b_Start(). Paths are reported under the spelling
+    // they were registered with (forward slashes).
+    void WatchFile(const fs::path& file);
+    void WatchDirectory(const fs::path& root);
+
+    // debounce: quiet time after the last event before checking the file.
+    // settle: wait between two checks of a file whose writer is unknown.
+    void SetTiming(std::chrono::milliseconds debounce, std::chrono::milliseconds settle);
+
+    bool b_Start();
+    void Stop();
+    bool b_IsRunning() const { return m_Thread.joinable(); }
+
+    // Paths that changed and settled since the last call, oldest first
+    std::vector<std::string> TakeChanges();
+
+private:
+    struct t_Pending
+    {
+        Clock::time_point due;
+        Clock::time_point first_event;
+        uintmax_t size = 0;
+        fs::file_time_type write_time{};
+        bool b_Closed = false;      // the writer closed it or renamed it into place
+        bool b_Checked = false;     // size and write_time hold an earlier check
+    };
+
+    // Platform loops, run on m_Thread until m_bStop
+    void RunNative();
+    void RunPolling();
+
+    // Watcher thread: a write was seen; resets the path's debounce
+    void OnFileEvent(const std::string& path, bool b_Closed);
+
+    // Watcher thread: checks due paths, reports the settled ones and
+    // returns when the next check is due (Clock::time_point::max() if none)
+    Clock::time_point ProcessPending();
+
+    std::vector<fs::path> m_Files;
+    std::vector<fs::path> m_Directories;
+    std::chrono::milliseconds m_Debounce{ 20 };
+    std::chrono::milliseconds m_Settle{ 100 };
+
+    std::unordered_map<std::string, t_Pending> m_Pending;
+
+    std::mutex m_ChangesMutex;
+    std::vector<std::string> m_Changes;
+
+    std::atomic<bool> m_bStop{ false };
+    std::thread m_Thread;
+
+    // Wakes the native loop for Stop(): an event HANDLE on Windows, a
+    // pipe elsewhere
+#ifdef _WIN32
+    void* m_StopEvent = nullptr;
+#else
+    int m_StopPipe[2] = { -1, -1 };
+#endif
+};
@@ -1,5 +1,18 @@
 #include "GameConfig.h"
+#include "CVar.h"
+#include "Logger.h"
 
+// Key names are the ones config.ini has always used
+static CVar<int32_t> s_Width("width", 1280, "Window width in pixels", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<int32_t> s_Height("height", 720, "Window height in pixels", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<bool> s_Fullscreen("b_Fullscreen", false, "Start in fullscreen (Alt+Enter toggles)", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<bool> s_Resizable("b_Resizable", true, "Let the window be resized", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<bool> s_Vsync("b_Vsync", true, "Wait for vertical sync instead of target_fps", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<int32_t> s_TargetFps("target_fps", 60, "Frame limit when b_Vsync is off (0 = unlimited)", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<std::string> s_Title("title", "My Game", "Window title", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<int32_t> s_SceneWidth("scene_width", 1280, "Editor scene render width", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<int32_t> s_SceneHeight("scene_height", 720, "Editor scene render height", CVarFlags::Archive | CVarFlags::RestartRequired);
+static CVar<int32_t> s_SceneFps("scene_fps", 60, "Editor scene frame limit", CVarFlags::Archive | CVarFlags::RestartRequired);
 
 GameConfig& GameConfig::GetInstance() 
 {
@@ -12,11 +25,11 @@ bool GameConfig::m_bLoadFromFile(const std::string& config_path)
     std::ifstream file(config_path);
     if (!file.is_open()) 
     {
-        std::cout << "Config file not found: " 
-                  << config_path << ". Using defaults." << "\n";
+        RW_LOG_INFO("GameConfig", "Config file not found: {}. Using defaults.", config_path);
         return false;
     }
     
+    CVarRegistry& registry = CVarRegistry::Get();
     std::string line;
     while (std::getline(file, line)) 
     {
@@ -37,56 +50,21 @@ bool GameConfig::m_bLoadFromFile(const std::string& config_path)
         std::string value(line.begin() + equal_pos + 1, line.end());
         
         // Trim whitespace
-        key.erase(0, key.find_first_not_of(" \t"));
-        key.erase(key.find_last_not_of(" \t") + 1);
-        value.erase(0, value.find_first_not_of(" \t"));
-        value.erase(value.find_last_not_of(" \t") + 1);
+        key.erase(0, key.find_first_not_of(" \t\r"));
+        key.erase(key.find_last_not_of(" \t\r") + 1);
+        value.erase(0, value.find_first_not_of(" \t\r"));
+        value.erase(value.find_last_not_of(" \t\r") + 1);
         
-        // Parse configuration values
-        if (key == "width") 
+        // Keys nothing has declared yet (GameLogic CVars) are kept until
+        // their CVar is
+        if (!registry.b_Set(key, value))
         {
-            m_WindowConfig.width = std::stoi(value);
-        } 
-        else if (key == "height") 
-        {
-            m_WindowConfig.height = std::stoi(value);
-        } 
-        else if (key == "b_Fullscreen") 
-        {
-            m_WindowConfig.b_Fullscreen = (value == "true" || value == "1");
-        } 
-        else if (key == "b_Resizable") 
-        {
-            m_WindowConfig.b_Resizable = (value == "true" || value == "1");
-        } 
-        else if (key == "b_Vsync") 
-        {
-            m_WindowConfig.b_Vsync = (value == "true" || value == "1");
-        } 
-        else if (key == "target_fps") 
-        {
-            m_WindowConfig.target_fps = std::stoi(value);
-        }
-        else if (key == "title") 
-        {
-            m_WindowConfig.title = value;
-        }
-        else if (key == "scene_width")
-        {
-            m_WindowConfig.scene_width = std::stoi(value);
-        }
-        else if (key == "scene_height")
-        {
-            m_WindowConfig.scene_height = std::stoi(value);
-        }
-        else if (key == "scene_fps")
-        {
-            m_WindowConfig.scene_fps = std::stoi(value);
+            RW_LOG_WARNING("GameConfig", "{}: '{}' is not a valid value for {}", config_path, value, key);
         }
     }
     
     file.close();
-    std::cout << "Loaded configuration from: " << config_path << "\n";
+    RW_LOG_INFO("GameConfig", "Loaded configuration from: {}", config_path);
     return true;
 }
 
@@ -95,52 +73,52 @@ bool GameConfig::m_bSaveToFile(const std::string& config_path) const
     std::ofstream file(config_path);
     if (!file.is_open()) 
     {
-        std::cout << "Failed to create config file: " 
-                  << config_path << "\n";
+        RW_LOG_ERROR("GameConfig", "Failed to create config file: {}", config_path);
         return false;
     }
     
-    file << "# Game Configuration File" << "\n";
-    file << "# Window Settings" << "\n";
-    file << "width=" << m_WindowConfig.width << "\n";
-    file << "height=" << m_WindowConfig.height << "\n";
-    file << "b_Fullscreen=" 
-         << (m_WindowConfig.b_Fullscreen ? "true" : "false") << "\n";
-    file << "b_Resizable=" 
-         << (m_WindowConfig.b_Resizable ? "true" : "false") << "\n";
-    file << "b_Vsync=" 
-         << (m_WindowConfig.b_Vsync ? "true" : "false") << "\n";
-    file << "target_fps=" << m_WindowConfig.target_fps << "\n";
-    file << "title=" << m_WindowConfig.title << "\n";
-    file << "scene_width=" << m_WindowConfig.scene_width << "\n";
-    file << "scene_height=" << m_WindowConfig.scene_height << "\n";
-    file << "scene_fps=" << m_WindowConfig.scene_fps << "\n";
+    file << GenerateConfigString();
     
     file.close();
-    std::cout << "Saved configuration to: " << config_path << "\n";
+    RW_LOG_INFO("GameConfig", "Saved configuration to: {}", config_path);
     return true;
 }
 
 std::string GameConfig::GenerateConfigString() const
 {
-    std::ostringstream ss;
+    return "# Game Configuration File\n"
+           "# key=value per line; any CVar can be set here\n" +
+           CVarRegistry::Get().GenerateConfigString();
+}
 
-    ss << "# Game Configuration File\n"
-       << "# Window Settings\n"
-       << "width=" << m_WindowConfig.width << "\n"
-       << "height=" << m_WindowConfig.height << "\n"
-       << "b_Fullscreen=" 
-       << (m_WindowConfig.b_Fullscreen ? "true" : "false") << "\n"
-       << "b_Resizable=" 
-       << (m_WindowConfig.b_Resizable ? "true" : "false") << "\n"
-       << "b_Vsync=" << (m_WindowConfig.b_Vsync ? "true" : "false") << "\n"
-       << "target_fps=" << m_WindowConfig.target_fps << "\n"
-       << "title=" << m_WindowConfig.title << "\n"
-       << "scene_width=" << m_WindowConfig.scene_width << "\n"
-       << "scene_height=" << m_WindowConfig.scene_height << "\n"
-       << "scene_fps=" << m_WindowConfig.scene_fps << "\n";
+t_WindowConfig GameConfig::GetWindowConfig() const
+{
+    t_WindowConfig config;
+    config.width = s_Width.Get();
+    config.height = s_Height.Get();
+    config.b_Fullscreen = s_Fullscreen.Get();
+    config.b_Resizable = s_Resizable.Get();
+    config.b_Vsync = s_Vsync.Get();
+    config.target_fps = s_TargetFps.Get();
+    config.title = s_Title.Get();
+    config.scene_width = s_SceneWidth.Get();
+    config.scene_height = s_SceneHeight.Get();
+    config.scene_fps = s_SceneFps.Get();
+    return config;
+}
 
-    return ss.str();
+void GameConfig::SetWindowConfig(const t_WindowConfig& config)
+{
+    s_Width.Set(config.width);
+    s_Height.Set(config.height);
+    s_Fullscreen.Set(config.b_Fullscreen);
+    s_Resizable.Set(config.b_Resizable);
+    s_Vsync.Set(config.b_Vsync);
+    s_TargetFps.Set(config.target_fps);
+    s_Title.Set(config.title);
+    s_SceneWidth.Set(config.scene_width);
+    s_SceneHeight.Set(config.scene_height);
+    s_SceneFps.Set(config.scene_fps);
 }
 
 void GameConfig::ApplyExportSettings
@@ -150,10 +128,10 @@ void GameConfig::ApplyExportSettings
     bool vsync, int target_fps
 )
 {
-    m_WindowConfig.width = width;
-    m_WindowConfig.height = height;
-    m_WindowConfig.b_Fullscreen = fullscreen;
-    m_WindowConfig.b_Resizable = resizable;
-    m_WindowConfig.b_Vsync = vsync;
-    m_WindowConfig.target_fps = target_fps;
-}
\ No newline at end of file
+    s_Width.Set(width);
+    s_Height.Set(height);
+    s_Fullscreen.Set(fullscreen);
+    s_Resizable.Set(resizable);
+    s_Vsync.Set(vsync);
+    s_TargetFps.Set(target_fps);
+}
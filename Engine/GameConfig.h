@@ -21,6 +21,14 @@ struct t_WindowConfig
     int scene_fps = 60;
 };
 
+/**
+ * @brief config.ini on top of the CVar registry
+ *
+ * Every key=value line is handed to CVarRegistry, so config.ini can set
+ * any CVar, including ones GameLogic declares after the file was read.
+ * The window settings are CVars declared in GameConfig.cpp under their
+ * old key names, and t_WindowConfig is a copy of them.
+ */
 class GameConfig 
 {
 public:
@@ -31,8 +39,8 @@ public:
         const std::string& config_path = "config.ini"
     ) const;
     
-    t_WindowConfig& GetWindowConfig() { return m_WindowConfig; }
-    const t_WindowConfig& GetWindowConfig() const { return m_WindowConfig; }
+    t_WindowConfig GetWindowConfig() const;
+    void SetWindowConfig(const t_WindowConfig& config);
     std::string GenerateConfigString() const;
     void ApplyExportSettings
     (
@@ -42,6 +50,5 @@ public:
     );
 
 private:
-    t_WindowConfig m_WindowConfig;
     GameConfig() = default;
-};
\ No newline at end of file
+};
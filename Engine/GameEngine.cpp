@@ -1,6 +1,9 @@
 #include "GameEngine.h"
+#include "Logger.h"
 #include "MapManager.h"
+#include <chrono>
 
+#ifdef _WIN32
 #define CloseWindow WinAPICloseWindow
 #define ShowCursor  WinAPIShowCursor
 #include <windows.h>
@@ -9,12 +12,15 @@
 #undef ShowCursor
 
 #pragma comment(lib, "Dwmapi.lib")
+#endif
 
 GameEngine::GameEngine()
 {
 	m_WindowWidth = 1280;
 	m_WindowHeight = 720;
 	m_WindowTitle = "Game Window";
+	m_AssetManager.SetStartupProfiler(&m_StartupProfiler);
+	m_AudioMixer.SetAssetManager(&m_AssetManager);
 }
 GameEngine::~GameEngine() = default;
 
@@ -24,17 +30,18 @@ void GameEngine::LaunchWindow(int width, int height, std::string_view title)
 	m_WindowHeight = height;
 	m_WindowTitle = title;
 
-	std::cout << "Window initialized: "
-		<< title
-		<< " ("
-		<< width
-		<< "x"
-		<< height
-		<< ")"
-		<< std::endl;
+	RW_LOG_INFO("GameEngine", "Window initialized: {} ({}x{})", title, width, height);
 
-	InitWindow(width, height, title.data());
+	{
+		StartupProfiler::Scope phase(&m_StartupProfiler, "InitWindow");
+		InitWindow(width, height, title.data());
+	}
+	{
+		StartupProfiler::Scope phase(&m_StartupProfiler, "InitAudioDevice");
+		m_AudioMixer.b_Init();
+	}
 
+#ifdef _WIN32
 	HWND hwnd = GetActiveWindow();
 	BOOL value = TRUE;
 
@@ -48,6 +55,7 @@ void GameEngine::LaunchWindow(int width, int height, std::string_view title)
 
 	// Windows 11 (attribute 20)
 	DwmSetWindowAttribute(hwnd, 20, &value, sizeof(value));
+#endif
 }
 
 
@@ -57,15 +65,15 @@ void GameEngine::LaunchWindow(const t_WindowConfig& config)
 	m_WindowHeight = config.height;
 	m_WindowTitle = config.title;
 
-	std::cout << "Window initialized from config: "
-		<< config.title
-		<< " ("
-		<< config.width
-		<< "x"
-		<< config.height
-		<< ") "
-		<< (config.b_Fullscreen ? "Fullscreen" : "Windowed")
-		<< std::endl;
+	RW_LOG_INFO
+	(
+		"GameEngine",
+		"Window initialized from config: {} ({}x{}) {}",
+		config.title,
+		config.width,
+		config.height,
+		(config.b_Fullscreen ? "Fullscreen" : "Windowed")
+	);
 
 	// Set window flags before initialization
 	unsigned int flags = 0;
@@ -77,7 +85,14 @@ void GameEngine::LaunchWindow(const t_WindowConfig& config)
 		SetConfigFlags(flags);
 	}
 
-	InitWindow(config.width, config.height, config.title.c_str());
+	{
+		StartupProfiler::Scope phase(&m_StartupProfiler, "InitWindow");
+		InitWindow(config.width, config.height, config.title.c_str());
+	}
+	{
+		StartupProfiler::Scope phase(&m_StartupProfiler, "InitAudioDevice");
+		m_AudioMixer.b_Init();
+	}
 
 	// Set fullscreen after window creation if needed
 	if (config.b_Fullscreen)
@@ -91,11 +106,11 @@ void GameEngine::ToggleFullscreen()
 	::ToggleFullscreen();
 	if (IsWindowFullscreen())
 	{
-		std::cout << "Switched to fullscreen mode" << std::endl;
+		RW_LOG_INFO("GameEngine", "Switched to fullscreen mode");
 	}
 	else
 	{
-		std::cout << "Switched to windowed mode" << std::endl;
+		RW_LOG_INFO("GameEngine", "Switched to windowed mode");
 	}
 }
 
@@ -105,17 +120,20 @@ void GameEngine::SetWindowMode(bool fullscreen)
 	if (fullscreen && !b_IsCurrentlyFullscreen)
 	{
 		::ToggleFullscreen();
-		std::cout << "Switched to fullscreen mode" << std::endl;
+		RW_LOG_INFO("GameEngine", "Switched to fullscreen mode");
 	}
 	else if (!fullscreen && b_IsCurrentlyFullscreen)
 	{
 		::ToggleFullscreen();
-		std::cout << "Switched to windowed mode" << std::endl;
+		RW_LOG_INFO("GameEngine", "Switched to windowed mode");
 	}
 }
 
 void GameEngine::SetMap(std::unique_ptr<GameMap> game_map)
 {
+	// The prefetch thread may run code from the outgoing GameLogic module
+	m_AssetManager.ClearPrefetch();
+
 	m_GameMap = std::move(game_map);
 	if (m_GameMap)
 	{
@@ -124,12 +142,19 @@ void GameEngine::SetMap(std::unique_ptr<GameMap> game_map)
 			static_cast<float>(m_WindowWidth), 
 			static_cast<float>(m_WindowHeight)
 		);
+		m_GameMap->SetAssetManager(&m_AssetManager);
+		m_GameMap->SetAudioMixer(&m_AudioMixer);
+		m_GameMap->SetInput(&m_Input);
+
+		StartupProfiler::Scope phase(&m_StartupProfiler, "Map Initialize");
 		m_GameMap->Initialize();
 	}
 }
 
 void GameEngine::DrawMap() const
 {
+	const auto START = std::chrono::steady_clock::now();
+
 	// First check if we have a MapManager
 	// Otherwise, use the regular GameMap
 	if (m_MapManager)
@@ -140,18 +165,66 @@ void GameEngine::DrawMap() const
 	{
 		m_GameMap->Draw();
 	}
+
+	EngineStats::Get().AddDrawTime
+	(
+		std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - START).count()
+	);
 }
 
-void GameEngine::UpdateMap(float dt) const
+void GameEngine::UpdateMap(float dt)
 {
+	CaptureInput();
+	BeginMapFrame();
+	StepMap(dt);
+}
+
+void GameEngine::CaptureInput()
+{
+	std::lock_guard<std::mutex> lock(m_InputMutex);
+	m_PendingInput.Capture();
+}
+
+void GameEngine::BeginMapFrame()
+{
+	const auto START = std::chrono::steady_clock::now();
+
+	m_AssetManager.UpdatePrefetch();
 	if (m_MapManager)
 	{
-		m_MapManager->Update(dt);
+		m_MapManager->ApplyPendingChanges();
+	}
+
+	EngineStats::Get().AddUpdateTime
+	(
+		std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - START).count()
+	);
+}
+
+void GameEngine::StepMap(float dt)
+{
+	const auto START = std::chrono::steady_clock::now();
+
+	// Each press reaches exactly one step
+	{
+		std::lock_guard<std::mutex> lock(m_InputMutex);
+		m_PendingInput.Take(m_Input);
+	}
+
+	m_AudioMixer.Update();
+	if (m_MapManager)
+	{
+		m_MapManager->UpdateLayers(dt);
 	}
 	else if (m_GameMap)
 	{
 		m_GameMap->Update(dt);
 	}
+
+	EngineStats::Get().AddUpdateTime
+	(
+		std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - START).count()
+	);
 }
 
 void GameEngine::ResetMap()
@@ -164,6 +237,8 @@ void GameEngine::ResetMap()
 
 void GameEngine::SetMapManager(std::unique_ptr<MapManager> map_manager)
 {
+	m_AssetManager.ClearPrefetch();
+
 	m_MapManager = std::move(map_manager);
 	if (m_MapManager)
 	{
@@ -172,6 +247,11 @@ void GameEngine::SetMapManager(std::unique_ptr<MapManager> map_manager)
 			static_cast<float>(m_WindowWidth), 
 			static_cast<float>(m_WindowHeight)
 		);
+		m_MapManager->SetAssetManager(&m_AssetManager);
+		m_MapManager->SetAudioMixer(&m_AudioMixer);
+		m_MapManager->SetInput(&m_Input);
+
+		StartupProfiler::Scope phase(&m_StartupProfiler, "Map Initialize");
 		m_MapManager->Initialize();
 	}
 }
@@ -184,4 +264,44 @@ MapManager* GameEngine::GetMapManager() const
 bool GameEngine::b_HasMapManager() const
 {
 	return m_MapManager != nullptr;
+}
+
+AssetManager& GameEngine::GetAssetManager()
+{
+	return m_AssetManager;
+}
+
+bool GameEngine::b_MountAssetPack(const std::string& pack_path)
+{
+	return m_AssetManager.b_MountPack(pack_path);
+}
+
+AudioMixer& GameEngine::GetAudioMixer()
+{
+	return m_AudioMixer;
+}
+
+StartupProfiler& GameEngine::GetStartupProfiler()
+{
+	return m_StartupProfiler;
+}
+
+void GameEngine::ReportMemoryUsage()
+{
+	EngineStats& stats = EngineStats::Get();
+	const t_AssetMemoryStats ASSETS = m_AssetManager.GetMemoryStats();
+	stats.SetMemoryUsage("Textures (GPU)", ASSETS.texture_bytes);
+	stats.SetMemoryUsage("Sounds", ASSETS.sound_bytes);
+	stats.SetMemoryUsage("Asset prefetch", ASSETS.prefetch_bytes);
+	stats.SetMemoryUsage("Asset pack (mapped)", ASSETS.pack_bytes);
+	stats.SetMemoryUsage("Map snapshots", m_MapManager ? m_MapManager->GetSnapshotBytes() : 0);
+}
+
+void GameEngine::EndFrame(bool b_MapIdle)
+{
+	if (b_MapIdle)
+	{
+		ReportMemoryUsage();
+	}
+	EngineStats::Get().EndFrame();
 }
\ No newline at end of file
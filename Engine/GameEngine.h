@@ -2,7 +2,13 @@
 
 #include "GameMap.h"
 #include "GameConfig.h"
+#include "AssetManager.h"
+#include "AudioMixer.h"
+#include "EngineStats.h"
+#include "StartupProfiler.h"
+#include "InputState.h"
 #include <memory>
+#include <mutex>
 #include <string>
 class MapManager;
 
@@ -11,14 +17,28 @@ class GameEngine
     bool m_bIsRunning = false;
     bool b_IsRunning() const { return m_bIsRunning; }
 
+	// Declared ahead of the engine services so timing starts as soon as
+	// main() builds the engine
+	StartupProfiler m_StartupProfiler;
+
 	// The window dimensions
     int m_WindowWidth;
 	int m_WindowHeight;
 	std::string m_WindowTitle;
+
+	// Declared before the maps so they outlive every asset they load
+	AudioMixer m_AudioMixer;
+	AssetManager m_AssetManager;
 	std::unique_ptr<GameMap> m_GameMap;
 	
 	// MapManager instance for advanced map management
 	std::unique_ptr<MapManager> m_MapManager;
+
+	// Captured by the render thread each frame, taken by each StepMap into
+	// m_Input, which is what the maps read
+	std::mutex m_InputMutex;
+	InputState m_PendingInput;
+	InputState m_Input;
 	
 public:
     GameEngine();
@@ -30,11 +50,41 @@ public:
 	void SetWindowMode(bool fullscreen);
 	void SetMap(std::unique_ptr<GameMap> game_map);
 	void DrawMap() const;
-	void UpdateMap(float delta_time) const;
+	void UpdateMap(float delta_time);
+
+	// UpdateMap in three steps, for hosts that simulate on another thread.
+	// CaptureInput runs on the render thread once per frame, also while a
+	// step runs; each StepMap takes the input captured since the last one.
+	// BeginMapFrame must run on the render thread with the map idle: it
+	// uploads prefetched assets and applies staged map transitions. StepMap
+	// runs audio and the maps' Update and may run on any single thread.
+	void CaptureInput();
+	void BeginMapFrame();
+	void StepMap(float delta_time);
 	void ResetMap();
 	
 	// MapManager integration methods
 	void SetMapManager(std::unique_ptr<MapManager> map_manager);
 	MapManager* GetMapManager() const;
 	bool b_HasMapManager() const;
+
+	// Asset resolution shared with every map (loose files or Assets.pak)
+	AssetManager& GetAssetManager();
+	bool b_MountAssetPack(const std::string& pack_path);
+
+	// Voice-pooled audio shared with every map; opened by LaunchWindow
+	AudioMixer& GetAudioMixer();
+
+	// Phase timings up to the first presented frame (see StartupProfiler)
+	StartupProfiler& GetStartupProfiler();
+
+	// Reports engine memory to EngineStats. Reads the maps and their
+	// assets, so it needs the map idle: with a simulation thread, call it
+	// while holding the world lock.
+	void ReportMemoryUsage();
+
+	// After EndDrawing: closes the frame in EngineStats (UpdateMap and
+	// DrawMap time themselves). Reports memory first unless b_MapIdle is
+	// false, i.e. a simulation thread may be stepping the map right now.
+	void EndFrame(bool b_MapIdle = true);
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "GameMap.h"
+#include "Logger.h"
 
 GameMap::GameMap()
 	: m_MapName("DefaultMap") {}
@@ -21,6 +22,27 @@ void GameMap::Draw()
     // Drawing logic for the game map
 }
 
+void GameMap::OnSuspend()
+{
+    // Pause anything that should not run while the map is parked
+}
+
+void GameMap::OnResume()
+{
+    // Restore anything paused in OnSuspend
+}
+
+bool GameMap::b_SaveSnapshot(MapSnapshot&) const
+{
+    // No snapshot support: restarting reloads the map
+    return false;
+}
+
+bool GameMap::b_RestoreSnapshot(MapSnapshot&)
+{
+    return false;
+}
+
 void GameMap::SetMapName(const std::string& map_name)
 {
     m_MapName = map_name;
@@ -69,6 +91,128 @@ void GameMap::RequestGotoMap(std::string_view map_id, bool force_reload)
     }
     else
     {
-		std::cout << "Transition callback not set!" << std::endl;
+        RW_LOG_WARNING("GameMap", "Transition callback not set, cannot switch to: {}", map_id);
+    }
+}
+
+void GameMap::RequestPushLayer(std::string_view map_id, const t_LayerOptions& options)
+{
+    if (m_PushLayerCallback)
+    {
+        m_PushLayerCallback(map_id, options);
+    }
+    else
+    {
+        RW_LOG_WARNING("GameMap", "Layer callback not set, cannot push: {}", map_id);
+    }
+}
+
+void GameMap::RequestRemoveLayer(std::string_view map_id)
+{
+    if (m_RemoveLayerCallback)
+    {
+        m_RemoveLayerCallback(map_id);
     }
 }
+
+void GameMap::SetLayerCallbacks
+(
+    std::function<void(std::string_view, const t_LayerOptions&)> push,
+    std::function<void(std::string_view)> remove
+)
+{
+    m_PushLayerCallback = std::move(push);
+    m_RemoveLayerCallback = std::move(remove);
+}
+
+void GameMap::SetInput(const InputState* input)
+{
+    m_Input = input;
+}
+
+const InputState& GameMap::GetInput() const
+{
+    static const InputState s_NoInput;
+    return m_Input ? *m_Input : s_NoInput;
+}
+
+void GameMap::SetInputFocus(bool b_HasFocus)
+{
+    m_bHasInputFocus = b_HasFocus;
+}
+
+bool GameMap::b_HasInputFocus() const
+{
+    return m_bHasInputFocus;
+}
+
+void GameMap::SetAssetManager(AssetManager* asset_manager)
+{
+    m_AssetManager = asset_manager;
+}
+
+AssetManager* GameMap::GetAssetManager() const
+{
+    return m_AssetManager;
+}
+
+AssetManager& GameMap::GetAssets() const
+{
+    if (m_AssetManager)
+    {
+        return *m_AssetManager;
+    }
+
+    // Maps running outside an engine still get a working loader
+    static AssetManager s_LooseFileAssets;
+    return s_LooseFileAssets;
+}
+
+
+void GameMap::SetAudioMixer(AudioMixer* audio_mixer)
+{
+    m_AudioMixer = audio_mixer;
+}
+
+AudioMixer* GameMap::GetAudioMixer() const
+{
+    return m_AudioMixer;
+}
+
+AudioMixer& GameMap::GetAudio() const
+{
+    if (m_AudioMixer)
+    {
+        return *m_AudioMixer;
+    }
+
+    static AudioMixer s_StandaloneAudio;
+    s_StandaloneAudio.b_Init();
+    return s_StandaloneAudio;
+}
+
+bool GameMap::b_LoadLevel(const std::string& path)
+{
+    if (!GetAssets().b_LoadLevel(path.c_str(), m_Level))
+    {
+        RW_LOG_ERROR("GameMap", "{}: failed to load level {}", m_MapName, path);
+        return false;
+    }
+
+    RW_LOG_INFO
+    (
+        "GameMap",
+        "{}: level {} ({} layers, {} spawns, {} KB)",
+        m_MapName,
+        path,
+        m_Level.GetLayers().size(),
+        m_Level.GetSpawns().size(),
+        m_Level.GetSize() / 1024
+    );
+    return true;
+}
+
+const LevelFile& GameMap::GetLevel() const
+{
+    return m_Level;
+}
\ No newline at end of file
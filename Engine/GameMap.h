@@ -1,10 +1,30 @@
 #pragma once
+#include "AssetManager.h"
+#include "AudioMixer.h"
+#include "InputState.h"
+#include "LevelFile.h"
+#include "MapSnapshot.h"
 #include <iostream>
 #include <raylib.h>
 #include <string>
 #include <string_view>
 #include <functional>
 
+// Draw order of the map MapManager::b_GotoMap makes current
+constexpr int c_LAYER_BASE_ORDER = 0;
+
+// How MapManager runs a map stacked as a layer (see b_PushLayer)
+struct t_LayerOptions
+{
+    int order = 100;                // higher draws later and gets input first;
+                                    // below c_LAYER_BASE_ORDER draws under the map
+    float tick_rate = 0.0f;         // updates per second, 0 = every frame
+    bool b_Paused = false;
+    bool b_Visible = true;
+    bool b_ConsumesInput = false;   // layers below lose input focus
+    bool b_PausesBelow = false;     // layers below stop updating (pause menus)
+};
+
 class GameMap
 {
 protected:
@@ -16,6 +36,25 @@ protected:
     // Transition callback to request a map change via the manager
     std::function<void(std::string_view, bool)> m_TransitionCallback;
 
+    // Engine-owned asset resolver, injected before Initialize()
+    AssetManager* m_AssetManager = nullptr;
+
+    // Engine-owned audio service, injected before Initialize()
+    AudioMixer* m_AudioMixer = nullptr;
+
+    // Engine-owned input of the running update, injected before Initialize()
+    const InputState* m_Input = nullptr;
+
+    // Layer requests routed to MapManager, applied at the next frame start
+    std::function<void(std::string_view, const t_LayerOptions&)> m_PushLayerCallback;
+    std::function<void(std::string_view)> m_RemoveLayerCallback;
+
+    // False while a layer above consumes input (see t_LayerOptions)
+    bool m_bHasInputFocus = true;
+
+    // Level data loaded with b_LoadLevel; tiles and spawns are read in place
+    LevelFile m_Level;
+
 public:
     GameMap(); 
     GameMap(const std::string& map_name);
@@ -24,6 +63,27 @@ public:
     virtual void Initialize();
     virtual void Update(float delta_time);
     virtual void Draw();
+
+    // Called by MapManager when the map is parked instead of destroyed, and
+    // when it becomes current again. Initialize is not re-run on resume.
+    virtual void OnSuspend();
+    virtual void OnResume();
+
+    // Fast restart: MapManager saves the gameplay state right after
+    // Initialize and restores it on Restart instead of rebuilding the map
+    // and reloading its assets. Write state only, never asset handles.
+    // The defaults return false, so such maps get a full reload.
+    virtual bool b_SaveSnapshot(MapSnapshot& out) const;
+    virtual bool b_RestoreSnapshot(MapSnapshot& in);
+
+    // A GameLogic hot reload restores snapshots written by the previous
+    // build into fresh instances. Bump this whenever b_SaveSnapshot writes
+    // something different, so stale state is dropped instead of misread.
+    virtual uint32_t GetSnapshotVersion() const { return 1; }
+
+    // Live gameplay objects (player, enemies, tiles in play, ...), shown
+    // per map in the editor's Performance panel
+    virtual size_t GetEntityCount() const { return 0; }
     
     void SetMapName(const std::string& map_name);
     std::string GetMapName() const;
@@ -39,7 +99,53 @@ public:
         std::function<void(std::string_view, bool)> cb
     );
 
+    // Hook for GameEngine/MapManager: shares the engine's AssetManager
+    // (and any mounted .pak) with this map.
+    void SetAssetManager(AssetManager* asset_manager);
+    AssetManager* GetAssetManager() const;
+
+    // Hook for GameEngine/MapManager: shares the engine's voice pool
+    void SetAudioMixer(AudioMixer* audio_mixer);
+    AudioMixer* GetAudioMixer() const;
+
+    // Hook for MapManager: lets maps add and remove overlay layers
+    void SetLayerCallbacks
+    (
+        std::function<void(std::string_view, const t_LayerOptions&)> push,
+        std::function<void(std::string_view)> remove
+    );
+
+    // Hook for GameEngine/MapManager: the input each Update reads
+    void SetInput(const InputState* input);
+
+    // Set by MapManager every frame before Update. Every map sees the same
+    // input, so maps check this before reading keys or the mouse.
+    void SetInputFocus(bool b_HasFocus);
+    bool b_HasInputFocus() const;
+
 protected:
     // Helper maps can call to request a transition (executes callback if provided)
     void RequestGotoMap(std::string_view map_id, bool force_reload = false);
+
+    // Stack a registered map above (or below) this one, e.g. a HUD or a
+    // pause menu, or remove it again; both take effect next frame
+    void RequestPushLayer(std::string_view map_id, const t_LayerOptions& options = {});
+    void RequestRemoveLayer(std::string_view map_id);
+
+    // Asset loading for maps; falls back to loose files if no engine is attached
+    AssetManager& GetAssets() const;
+
+    // Sound playback for maps; falls back to a private mixer if no engine is attached
+    AudioMixer& GetAudio() const;
+
+    // Keyboard and mouse for Update. Maps must not call raylib's input
+    // functions (IsKeyPressed, ...): Update may run on the editor's
+    // simulation thread, and several times per rendered frame. Without an
+    // engine attached, nothing is pressed.
+    const InputState& GetInput() const;
+
+    // Opens a .rwl level through GetAssets(), replacing any previous one.
+    // Views from GetLevel() stay valid until the next load or ~GameMap.
+    bool b_LoadLevel(const std::string& path);
+    const LevelFile& GetLevel() const;
 };
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "InputState.h"
+
+static bool s_bfIsKey(int key)
+{
+    return key >= 0 && key < c_INPUT_KEY_COUNT;
+}
+
+static bool s_bfIsButton(int button)
+{
+    return button >= 0 && button < c_INPUT_MOUSE_BUTTON_COUNT;
+}
+
+bool InputState::b_IsKeyDown(int key) const
+{
+    return s_bfIsKey(key) && m_KeysDown.test(static_cast<size_t>(key));
+}
+
+bool InputState::b_IsKeyPressed(int key) const
+{
+    return s_bfIsKey(key) && m_KeysPressed.test(static_cast<size_t>(key));
+}
+
+bool InputState::b_IsKeyReleased(int key) const
+{
+    return s_bfIsKey(key) && m_KeysReleased.test(static_cast<size_t>(key));
+}
+
+bool InputState::b_IsMouseButtonDown(int button) const
+{
+    return s_bfIsButton(button) && m_ButtonsDown.test(static_cast<size_t>(button));
+}
+
+bool InputState::b_IsMouseButtonPressed(int button) const
+{
+    return s_bfIsButton(button) && m_ButtonsPressed.test(static_cast<size_t>(button));
+}
+
+bool InputState::b_IsMouseButtonReleased(int button) const
+{
+    return s_bfIsButton(button) && m_ButtonsReleased.test(static_cast<size_t>(button));
+}
+
+void InputState::Capture()
+{
+    for (int key = 0; key < c_INPUT_KEY_COUNT; ++key)
+    {
+        const size_t BIT = static_cast<size_t>(key);
+        m_KeysDown[BIT] = ::IsKeyDown(key);
+        if (::IsKeyPressed(key))
+        {
+            m_KeysPressed.set(BIT);
+        }
+        if (::IsKeyReleased(key))
+        {
+            m_KeysReleased.set(BIT);
+        }
+    }
+
+    for (int button = 0; button < c_INPUT_MOUSE_BUTTON_COUNT; ++button)
+    {
+        const size_t BIT = static_cast<size_t>(button);
+        m_ButtonsDown[BIT] = ::IsMouseButtonDown(button);
+        if (::IsMouseButtonPressed(button))
+        {
+            m_ButtonsPressed.set(BIT);
+        }
+        if (::IsMouseButtonReleased(button))
+        {
+            m_ButtonsReleased.set(BIT);
+        }
+    }
+
+    m_MousePosition = ::GetMousePosition();
+}
+
+void InputState::Take(InputState& out)
+{
+    out = *this;
+    m_KeysPressed.reset();
+    m_KeysReleased.reset();
+    m_ButtonsPressed.reset();
+    m_ButtonsReleased.reset();
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <bitset>
+#include <raylib.h>
+
+// raylib's MAX_KEYBOARD_KEYS and MAX_MOUSE_BUTTONS
+constexpr int c_INPUT_KEY_COUNT = 512;
+constexpr int c_INPUT_MOUSE_BUTTON_COUNT = 8;
+
+/**
+ * @brief Keyboard and mouse state as one map update sees it
+ *
+ * raylib's input functions read state that PollInputEvents (inside
+ * EndDrawing) rewrites on the render thread, and their "pressed" edges
+ * last exactly one rendered frame. A map stepped on another thread, or
+ * stepped several times per frame, would race with the poll and see an
+ * edge twice or not at all. Maps therefore never call raylib's input
+ * functions; they read GameMap::GetInput() instead.
+ *
+ * The render thread captures raylib's state once per frame and adds it to
+ * a pending state; each update takes the pending state, which clears its
+ * press and release edges. An edge is seen by exactly one update however
+ * many frames or updates run in between; held keys and the mouse position
+ * are the latest captured.
+ *
+ * Example Usage:
+ * @code
+ * // Render thread, once per frame (GameEngine::CaptureInput)
+ * pending.Capture();
+ *
+ * // Before each update (GameEngine::StepMap)
+ * pending.Take(current);
+ *
+ * // In a map's Update
+ * if (GetInput().b_IsKeyPressed(KEY_P)) { ... }
+ * @endcode
+ */
+class InputState
+{
+public:
+    bool b_IsKeyDown(int key) const;
+    bool b_IsKeyPressed(int key) const;
+    bool b_IsKeyReleased(int key) const;
+
+    bool b_IsMouseButtonDown(int button) const;
+    bool b_IsMouseButtonPressed(int button) const;
+    bool b_IsMouseButtonReleased(int button) const;
+    Vector2 GetMousePosition() const { return m_MousePosition; }
+
+    // Render thread, after raylib polled input: adds this frame's edges to
+    // the ones not yet taken and replaces the held state
+    void Capture();
+
+    // Hands everything captured so far to one update and clears the edges
+    void Take(InputState& out);
+
+    void Clear() { *this = InputState{}; }
+
+private:
+    std::bitset<c_INPUT_KEY_COUNT> m_KeysDown;
+    std::bitset<c_INPUT_KEY_COUNT> m_KeysPressed;
+    std::bitset<c_INPUT_KEY_COUNT> m_KeysReleased;
+    std::bitset<c_INPUT_MOUSE_BUTTON_COUNT> m_ButtonsDown;
+    std::bitset<c_INPUT_MOUSE_BUTTON_COUNT> m_ButtonsPressed;
+    std::bitset<c_INPUT_MOUSE_BUTTON_COUNT> m_ButtonsReleased;
+    Vector2 m_MousePosition{};
+};
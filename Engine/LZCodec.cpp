@@ -0,0 +1,238 @@
+#include "LZCodec.h"
+#include <array>
+#include <cstring>
+
+constexpr size_t c_MIN_MATCH = 4;
+constexpr size_t c_MAX_OFFSET = 65535;
+constexpr int c_HASH_BITS = 12;
+
+// Stop searching for matches this close to the end so the tail is literals
+constexpr size_t c_END_LITERALS = 12;
+
+static uint32_t s_fRead32(const uint8_t* p)
+{
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint32_t s_fHash(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - c_HASH_BITS);
+}
+
+// Writes the 255-continued tail of a length whose nibble saturated at 15
+static bool s_bfWriteLength(size_t length, uint8_t*& op, const uint8_t* oend)
+{
+    while (length >= 255)
+    {
+        if (op >= oend) return false;
+        *op++ = 255;
+        length -= 255;
+    }
+    if (op >= oend) return false;
+    *op++ = static_cast<uint8_t>(length);
+    return true;
+}
+
+static bool s_bfEmitSequence
+(
+    const uint8_t* literals, size_t literal_count,
+    size_t offset, size_t match_length,
+    uint8_t*& op, const uint8_t* oend
+)
+{
+    if (op >= oend) return false;
+    uint8_t* token = op++;
+
+    size_t lit_nibble = literal_count < 15 ? literal_count : 15;
+    size_t match_nibble = 0;
+    if (match_length > 0)
+    {
+        size_t extra = match_length - c_MIN_MATCH;
+        match_nibble = extra < 15 ? extra : 15;
+    }
+    *token = static_cast<uint8_t>((lit_nibble << 4) | match_nibble);
+
+    if (lit_nibble == 15 && !s_bfWriteLength(literal_count - 15, op, oend))
+    {
+        return false;
+    }
+
+    if (static_cast<size_t>(oend - op) < literal_count) return false;
+    if (literal_count > 0)
+    {
+        std::memcpy(op, literals, literal_count);
+        op += literal_count;
+    }
+
+    if (match_length == 0)
+    {
+        return true;
+    }
+
+    if (oend - op < 2) return false;
+    *op++ = static_cast<uint8_t>(offset & 0xFF);
+    *op++ = static_cast<uint8_t>(offset >> 8);
+
+    if (match_nibble == 15)
+    {
+        return s_bfWriteLength(match_length - c_MIN_MATCH - 15, op, oend);
+    }
+    return true;
+}
+
+size_t LZCompressBound(size_t src_size)
+{
+    return src_size + src_size / 255 + 16;
+}
+
+size_t LZCompress
+(
+    const uint8_t* src, size_t src_size,
+    uint8_t* dst, size_t dst_capacity
+)
+{
+    std::array<uint32_t, 1u << c_HASH_BITS> table;
+    table.fill(UINT32_MAX);
+
+    uint8_t* op = dst;
+    const uint8_t* oend = dst + dst_capacity;
+
+    size_t anchor = 0;
+    size_t ip = 0;
+    const size_t MATCH_LIMIT =
+        src_size > c_END_LITERALS ? src_size - c_END_LITERALS : 0;
+
+    while (ip < MATCH_LIMIT)
+    {
+        const uint32_t SEQUENCE = s_fRead32(src + ip);
+        const uint32_t HASH = s_fHash(SEQUENCE);
+        const uint32_t REF = table[HASH];
+        table[HASH] = static_cast<uint32_t>(ip);
+
+        if (REF == UINT32_MAX ||
+            ip - REF > c_MAX_OFFSET ||
+            s_fRead32(src + REF) != SEQUENCE)
+        {
+            ++ip;
+            continue;
+        }
+
+        size_t length = c_MIN_MATCH;
+        while (ip + length < MATCH_LIMIT && src[REF + length] == src[ip + length])
+        {
+            ++length;
+        }
+
+        if (!s_bfEmitSequence
+            (
+                src + anchor, ip - anchor, ip - REF, length, op, oend
+            ))
+        {
+            return 0;
+        }
+
+        ip += length;
+        anchor = ip;
+    }
+
+    // Final literals-only sequence marks the end of the block
+    if (!s_bfEmitSequence
+        (
+            src + anchor, src_size - anchor, 0, 0, op, oend
+        ))
+    {
+        return 0;
+    }
+
+    return static_cast<size_t>(op - dst);
+}
+
+static bool s_bfReadLength(size_t& length, const uint8_t*& ip, const uint8_t* iend)
+{
+    uint8_t byte;
+    do
+    {
+        if (ip >= iend) return false;
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+bool b_LZDecompress
+(
+    const uint8_t* src, size_t src_size,
+    uint8_t* dst, size_t dst_size
+)
+{
+    const uint8_t* ip = src;
+    const uint8_t* iend = src + src_size;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + dst_size;
+
+    while (ip < iend)
+    {
+        const uint8_t TOKEN = *ip++;
+
+        size_t literal_count = TOKEN >> 4;
+        if (literal_count == 15 && !s_bfReadLength(literal_count, ip, iend))
+        {
+            return false;
+        }
+
+        if (static_cast<size_t>(iend - ip) < literal_count ||
+            static_cast<size_t>(oend - op) < literal_count)
+        {
+            return false;
+        }
+        if (literal_count > 0)
+        {
+            std::memcpy(op, ip, literal_count);
+            ip += literal_count;
+            op += literal_count;
+        }
+
+        // Literals-only sequence: end of block
+        if (ip == iend)
+        {
+            break;
+        }
+
+        if (iend - ip < 2) return false;
+        size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+
+        size_t match_length = TOKEN & 0x0F;
+        if (match_length == 15 && !s_bfReadLength(match_length, ip, iend))
+        {
+            return false;
+        }
+        match_length += c_MIN_MATCH;
+
+        if (offset == 0 ||
+            offset > static_cast<size_t>(op - dst) ||
+            static_cast<size_t>(oend - op) < match_length)
+        {
+            return false;
+        }
+
+        const uint8_t* match = op - offset;
+        if (offset >= match_length)
+        {
+            std::memcpy(op, match, match_length);
+            op += match_length;
+        }
+        else
+        {
+            // Overlapping copy repeats the last `offset` bytes (RLE-style)
+            for (size_t i = 0; i < match_length; ++i)
+            {
+                *op++ = match[i];
+            }
+        }
+    }
+
+    return op == oend;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/*
+    Small byte-oriented LZ77 codec in the LZ4 block style, used for
+    per-entry compression in .pak archives. Favours decode speed over
+    ratio: no entropy stage, 64 KB window, 4-byte minimum match.
+
+    Sequence layout:
+        token      high nibble = literal count, low nibble = match length - 4
+                   (15 means "more length bytes follow", each 255 continues)
+        literals   raw bytes
+        offset     uint16 little-endian distance back (absent in the
+                   final sequence, which is literals only)
+*/
+
+// Worst-case compressed size for an input of src_size bytes
+size_t LZCompressBound(size_t src_size);
+
+// Returns the compressed size, or 0 if dst_capacity was too small
+size_t LZCompress
+(
+    const uint8_t* src, size_t src_size,
+    uint8_t* dst, size_t dst_capacity
+);
+
+// Decodes exactly dst_size bytes; fails on any malformed or truncated input
+bool b_LZDecompress
+(
+    const uint8_t* src, size_t src_size,
+    uint8_t* dst, size_t dst_size
+);
@@ -0,0 +1,227 @@
+#include "LevelFile.h"
+#include "Logger.h"
+#include <cstring>
+
+/*
++--------------------------------------------------------+
+|                      LEVEL FILE                        |
++--------------------------------------------------------+
+*/
+
+// True if [offset, offset + count * stride) lies inside size bytes
+static bool s_bfRangeFits(uint64_t offset, uint64_t count, uint64_t stride, size_t size)
+{
+    if (offset > size)
+    {
+        return false;
+    }
+    return count <= (size - offset) / stride;
+}
+
+bool LevelFile::b_Open(const std::string& path)
+{
+    Close();
+
+    std::string map_error;
+    if (!m_File.b_Open(path, &map_error))
+    {
+        RW_LOG_ERROR("LevelFile", "{}", map_error);
+        return false;
+    }
+
+    if (!b_Attach(m_File.GetData(), m_File.GetSize(), path))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool LevelFile::b_OpenMemory
+(
+    std::span<const unsigned char> bytes,
+    std::string_view name
+)
+{
+    Close();
+
+    if (!b_Attach(bytes.data(), bytes.size(), name))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool LevelFile::b_OpenBuffer
+(
+    std::vector<unsigned char>&& bytes,
+    std::string_view name
+)
+{
+    Close();
+
+    m_Buffer = std::move(bytes);
+    if (!b_Attach(m_Buffer.data(), m_Buffer.size(), name))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void LevelFile::Close()
+{
+    m_File.Close();
+    m_Buffer.clear();
+    m_Buffer.shrink_to_fit();
+    m_pBase = nullptr;
+    m_Size = 0;
+    m_Header = {};
+    m_Layers = {};
+    m_Spawns = {};
+    m_pStringTable = nullptr;
+    m_Name.clear();
+}
+
+bool LevelFile::b_Attach
+(
+    const unsigned char* base,
+    size_t size,
+    std::string_view name
+)
+{
+    m_Name = name;
+
+    if (!base || size < sizeof(t_LevelHeader))
+    {
+        RW_LOG_ERROR("LevelFile", "File too small: {}", m_Name);
+        return false;
+    }
+
+    // Records are read in place, so the storage must be aligned like they are
+    if (reinterpret_cast<uintptr_t>(base) % alignof(t_LevelHeader) != 0)
+    {
+        RW_LOG_ERROR("LevelFile", "Misaligned level data: {}", m_Name);
+        return false;
+    }
+
+    std::memcpy(&m_Header, base, sizeof(m_Header));
+    if (std::memcmp(m_Header.magic, c_LEVEL_MAGIC.data(), 4) != 0)
+    {
+        RW_LOG_ERROR("LevelFile", "Not a level file: {}", m_Name);
+        return false;
+    }
+    if (m_Header.version != c_LEVEL_VERSION)
+    {
+        RW_LOG_ERROR
+        (
+            "LevelFile",
+            "Unsupported level version {} (expected {}): {}",
+            m_Header.version,
+            c_LEVEL_VERSION,
+            m_Name
+        );
+        return false;
+    }
+
+    const bool b_TablesOk =
+        s_bfRangeFits(m_Header.layer_table_offset, m_Header.layer_count, sizeof(t_LevelLayer), size) &&
+        s_bfRangeFits(m_Header.spawn_table_offset, m_Header.spawn_count, sizeof(t_LevelSpawn), size) &&
+        s_bfRangeFits(m_Header.string_table_offset, m_Header.string_table_size, 1, size) &&
+        m_Header.layer_table_offset % alignof(t_LevelLayer) == 0 &&
+        m_Header.spawn_table_offset % alignof(t_LevelSpawn) == 0 &&
+        m_Header.tile_size > 0.0f;
+
+    if (!b_TablesOk)
+    {
+        RW_LOG_ERROR("LevelFile", "Corrupt level header: {}", m_Name);
+        return false;
+    }
+
+    m_Layers = std::span<const t_LevelLayer>
+    (
+        reinterpret_cast<const t_LevelLayer*>(base + m_Header.layer_table_offset),
+        m_Header.layer_count
+    );
+    m_Spawns = std::span<const t_LevelSpawn>
+    (
+        reinterpret_cast<const t_LevelSpawn*>(base + m_Header.spawn_table_offset),
+        m_Header.spawn_count
+    );
+    m_pStringTable = reinterpret_cast<const char*>(base + m_Header.string_table_offset);
+
+    for (const t_LevelLayer& LAYER : m_Layers)
+    {
+        const uint64_t TILE_COUNT = static_cast<uint64_t>(LAYER.width) * LAYER.height;
+        const bool b_LayerOk =
+            static_cast<uint64_t>(LAYER.name_offset) + LAYER.name_length <= m_Header.string_table_size &&
+            LAYER.tiles_offset % alignof(uint16_t) == 0 &&
+            s_bfRangeFits(LAYER.tiles_offset, TILE_COUNT, sizeof(uint16_t), size);
+
+        if (!b_LayerOk)
+        {
+            RW_LOG_ERROR("LevelFile", "Corrupt layer in: {}", m_Name);
+            return false;
+        }
+    }
+
+    for (const t_LevelSpawn& SPAWN : m_Spawns)
+    {
+        if (static_cast<uint64_t>(SPAWN.type_offset) + SPAWN.type_length > m_Header.string_table_size)
+        {
+            RW_LOG_ERROR("LevelFile", "Corrupt spawn in: {}", m_Name);
+            return false;
+        }
+    }
+
+    m_pBase = base;
+    m_Size = size;
+    return true;
+}
+
+std::string_view LevelFile::GetString(uint32_t offset, uint32_t length) const
+{
+    return { m_pStringTable + offset, length };
+}
+
+const t_LevelLayer* LevelFile::FindLayer(std::string_view name) const
+{
+    // A level has a handful of layers; a linear scan beats a sorted table
+    for (const t_LevelLayer& LAYER : m_Layers)
+    {
+        if (GetLayerName(LAYER) == name)
+        {
+            return &LAYER;
+        }
+    }
+    return nullptr;
+}
+
+std::string_view LevelFile::GetLayerName(const t_LevelLayer& layer) const
+{
+    return GetString(layer.name_offset, layer.name_length);
+}
+
+std::span<const uint16_t> LevelFile::GetTiles(const t_LevelLayer& layer) const
+{
+    return
+    {
+        reinterpret_cast<const uint16_t*>(m_pBase + layer.tiles_offset),
+        static_cast<size_t>(layer.width) * layer.height
+    };
+}
+
+uint16_t LevelFile::GetTile(const t_LevelLayer& layer, int64_t x, int64_t y) const
+{
+    if (x < 0 || y < 0 || x >= layer.width || y >= layer.height)
+    {
+        return c_LEVEL_TILE_EMPTY;
+    }
+    return GetTiles(layer)[static_cast<size_t>(y) * layer.width + static_cast<size_t>(x)];
+}
+
+std::string_view LevelFile::GetSpawnType(const t_LevelSpawn& spawn) const
+{
+    return GetString(spawn.type_offset, spawn.type_length);
+}
@@ -0,0 +1,158 @@
+#pragma once
+#include "MappedFile.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
++--------------------------------------------------------+
+|                    .RWL FILE LAYOUT                     |
++--------------------------------------------------------+
+
+    t_LevelHeader
+    t_LevelLayer[layer_count]
+    t_LevelSpawn[spawn_count]
+    name string table            not null-terminated
+    tile arrays                  each aligned to c_LEVEL_ALIGNMENT
+
+Every table is plain fixed-size records at an aligned offset, so a mapped
+file is used as-is: layers hand out spans over their tile arrays and the
+spawn table is iterated straight out of the mapping. Opening a level is
+one mmap plus a bounds check per table; nothing is parsed or allocated
+per tile, and pages are read when something first touches them.
+
+A tile array is width * height uint16 tile ids, row-major, top row
+first. Id 0 (c_LEVEL_TILE_EMPTY) is empty space; what other ids mean is
+up to the map. Positions are in world units, layer origins are the top
+left corner of tile (0, 0).
+
+All integers and floats are little-endian. A version bump is required
+for any change to these records; older files are rejected, not guessed.
+*/
+
+constexpr std::array<char, 4> c_LEVEL_MAGIC = { 'R', 'W', 'L', 'V' };
+constexpr uint32_t c_LEVEL_VERSION = 1;
+constexpr uint64_t c_LEVEL_ALIGNMENT = 64;
+constexpr uint16_t c_LEVEL_TILE_EMPTY = 0;
+
+struct t_LevelHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t layer_count;
+    uint32_t spawn_count;
+    uint64_t layer_table_offset;
+    uint64_t spawn_table_offset;
+    uint64_t string_table_offset;
+    uint32_t string_table_size;
+    float tile_size;        // world units per tile
+};
+
+struct t_LevelLayer
+{
+    uint64_t tiles_offset;
+    uint32_t name_offset;
+    uint32_t name_length;
+    uint32_t width;         // tiles
+    uint32_t height;
+    float origin_x;         // world position of tile (0, 0)
+    float origin_y;
+    uint32_t flags;         // free for the map to interpret
+    uint32_t reserved;
+};
+
+struct t_LevelSpawn
+{
+    uint32_t type_offset;
+    uint32_t type_length;
+    float x;
+    float y;
+    float param_a;          // meaning depends on type, e.g. patrol bounds
+    float param_b;
+};
+
+// The records are read in place, so their layout is part of the format
+static_assert(sizeof(t_LevelHeader) == 48);
+static_assert(sizeof(t_LevelLayer) == 40);
+static_assert(sizeof(t_LevelSpawn) == 24);
+
+/**
+ * @brief Read-only view over a .rwl level
+ *
+ * Loose files are memory-mapped; levels inside a .pak are read from the
+ * pack's own mapping (see AssetManager::b_LoadLevel), or from an owned
+ * buffer when the entry is compressed. Every span and string_view handed
+ * out points into that storage and stays valid until Close(), which is
+ * why a map keeps its LevelFile for as long as it uses the level.
+ *
+ * The view is immutable, so the streaming thread may read it while the
+ * main thread does too.
+ *
+ * Example Usage:
+ * @code
+ * const t_LevelLayer* ground = level.FindLayer("ground");
+ * std::span<const uint16_t> tiles = level.GetTiles(*ground);
+ * for (const t_LevelSpawn& SPAWN : level.GetSpawns())
+ * {
+ *     if (level.GetSpawnType(SPAWN) == "slime") { ... }
+ * }
+ * @endcode
+ */
+class LevelFile
+{
+public:
+    LevelFile() = default;
+
+    LevelFile(const LevelFile&) = delete;
+    LevelFile& operator=(const LevelFile&) = delete;
+
+    // Maps a loose .rwl file
+    bool b_Open(const std::string& path);
+
+    // Uses bytes owned by someone else (e.g. a mounted pack) in place
+    bool b_OpenMemory(std::span<const unsigned char> bytes, std::string_view name);
+
+    // Takes ownership of a decoded copy
+    bool b_OpenBuffer(std::vector<unsigned char>&& bytes, std::string_view name);
+
+    void Close();
+    bool b_IsOpen() const { return m_pBase != nullptr; }
+
+    const std::string& GetName() const { return m_Name; }
+    size_t GetSize() const { return m_Size; }
+    float GetTileSize() const { return m_Header.tile_size; }
+
+    std::span<const t_LevelLayer> GetLayers() const { return m_Layers; }
+    const t_LevelLayer* FindLayer(std::string_view name) const;
+    std::string_view GetLayerName(const t_LevelLayer& layer) const;
+
+    std::span<const uint16_t> GetTiles(const t_LevelLayer& layer) const;
+
+    // Out-of-range cells read as c_LEVEL_TILE_EMPTY
+    uint16_t GetTile(const t_LevelLayer& layer, int64_t x, int64_t y) const;
+
+    std::span<const t_LevelSpawn> GetSpawns() const { return m_Spawns; }
+    std::string_view GetSpawnType(const t_LevelSpawn& spawn) const;
+
+private:
+    // Checks every table against the storage before anything trusts an offset
+    bool b_Attach(const unsigned char* base, size_t size, std::string_view name);
+
+    std::string_view GetString(uint32_t offset, uint32_t length) const;
+
+    const unsigned char* m_pBase = nullptr;
+    size_t m_Size = 0;
+    t_LevelHeader m_Header{};
+    std::span<const t_LevelLayer> m_Layers;
+    std::span<const t_LevelSpawn> m_Spawns;
+    const char* m_pStringTable = nullptr;
+    std::string m_Name;
+
+    // At most one of these backs m_pBase; neither for b_OpenMemory
+    MappedFile m_File;
+    std::vector<unsigned char> m_Buffer;
+};
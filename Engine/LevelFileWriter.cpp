@@ -0,0 +1,164 @@
+#include "LevelFileWriter.h"
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+void LevelFileWriter::AddLayer
+(
+    std::string_view name,
+    uint32_t width,
+    uint32_t height,
+    float origin_x,
+    float origin_y,
+    std::vector<uint16_t> tiles,
+    uint32_t flags
+)
+{
+    t_PendingLayer layer;
+    layer.name = name;
+    layer.width = width;
+    layer.height = height;
+    layer.origin_x = origin_x;
+    layer.origin_y = origin_y;
+    layer.flags = flags;
+    layer.tiles = std::move(tiles);
+    m_Layers.push_back(std::move(layer));
+}
+
+void LevelFileWriter::AddSpawn
+(
+    std::string_view type,
+    float x,
+    float y,
+    float param_a,
+    float param_b
+)
+{
+    m_Spawns.push_back({ std::string(type), x, y, param_a, param_b });
+}
+
+bool LevelFileWriter::b_Write(const fs::path& out_path, std::string& out_error) const
+{
+    if (m_TileSize <= 0.0f)
+    {
+        out_error = "Tile size must be positive";
+        return false;
+    }
+
+    for (const t_PendingLayer& LAYER : m_Layers)
+    {
+        if (LAYER.tiles.size() != static_cast<size_t>(LAYER.width) * LAYER.height)
+        {
+            out_error = "Layer '" + LAYER.name + "' has " + std::to_string(LAYER.tiles.size()) +
+                " tiles, expected " + std::to_string(static_cast<size_t>(LAYER.width) * LAYER.height);
+            return false;
+        }
+    }
+
+    // Spawn types repeat a lot ("slime" x 1000), so each name is stored once
+    std::string string_table;
+    std::unordered_map<std::string, uint32_t> string_offsets;
+    auto intern = [&](const std::string& text)
+    {
+        auto [it, b_Inserted] = string_offsets.try_emplace
+        (
+            text, static_cast<uint32_t>(string_table.size())
+        );
+        if (b_Inserted)
+        {
+            string_table += text;
+        }
+        return it->second;
+    };
+
+    std::vector<t_LevelLayer> layers(m_Layers.size());
+    for (size_t i = 0; i < m_Layers.size(); ++i)
+    {
+        layers[i].name_offset = intern(m_Layers[i].name);
+        layers[i].name_length = static_cast<uint32_t>(m_Layers[i].name.size());
+        layers[i].width = m_Layers[i].width;
+        layers[i].height = m_Layers[i].height;
+        layers[i].origin_x = m_Layers[i].origin_x;
+        layers[i].origin_y = m_Layers[i].origin_y;
+        layers[i].flags = m_Layers[i].flags;
+    }
+
+    std::vector<t_LevelSpawn> spawns(m_Spawns.size());
+    for (size_t i = 0; i < m_Spawns.size(); ++i)
+    {
+        spawns[i].type_offset = intern(m_Spawns[i].type);
+        spawns[i].type_length = static_cast<uint32_t>(m_Spawns[i].type.size());
+        spawns[i].x = m_Spawns[i].x;
+        spawns[i].y = m_Spawns[i].y;
+        spawns[i].param_a = m_Spawns[i].param_a;
+        spawns[i].param_b = m_Spawns[i].param_b;
+    }
+
+    auto align_up = [](uint64_t value)
+    {
+        return (value + c_LEVEL_ALIGNMENT - 1) & ~(c_LEVEL_ALIGNMENT - 1);
+    };
+
+    t_LevelHeader header{};
+    std::memcpy(header.magic, c_LEVEL_MAGIC.data(), 4);
+    header.version = c_LEVEL_VERSION;
+    header.layer_count = static_cast<uint32_t>(layers.size());
+    header.spawn_count = static_cast<uint32_t>(spawns.size());
+    header.layer_table_offset = sizeof(t_LevelHeader);
+    header.spawn_table_offset = header.layer_table_offset + layers.size() * sizeof(t_LevelLayer);
+    header.string_table_offset = header.spawn_table_offset + spawns.size() * sizeof(t_LevelSpawn);
+    header.string_table_size = static_cast<uint32_t>(string_table.size());
+    header.tile_size = m_TileSize;
+
+    // Tile arrays follow the tables, so every offset is known up front
+    uint64_t offset = header.string_table_offset + string_table.size();
+    for (size_t i = 0; i < layers.size(); ++i)
+    {
+        offset = align_up(offset);
+        layers[i].tiles_offset = offset;
+        offset += m_Layers[i].tiles.size() * sizeof(uint16_t);
+    }
+
+    std::ofstream out(out_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        out_error = "Cannot create " + out_path.string();
+        return false;
+    }
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write
+    (
+        reinterpret_cast<const char*>(layers.data()),
+        static_cast<std::streamsize>(layers.size() * sizeof(t_LevelLayer))
+    );
+    out.write
+    (
+        reinterpret_cast<const char*>(spawns.data()),
+        static_cast<std::streamsize>(spawns.size() * sizeof(t_LevelSpawn))
+    );
+    out.write
+    (
+        string_table.data(),
+        static_cast<std::streamsize>(string_table.size())
+    );
+
+    for (size_t i = 0; i < layers.size(); ++i)
+    {
+        const uint64_t POSITION = static_cast<uint64_t>(out.tellp());
+        std::vector<char> padding(layers[i].tiles_offset - POSITION, 0);
+        out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        out.write
+        (
+            reinterpret_cast<const char*>(m_Layers[i].tiles.data()),
+            static_cast<std::streamsize>(m_Layers[i].tiles.size() * sizeof(uint16_t))
+        );
+    }
+
+    if (!out.good())
+    {
+        out_error = "Failed writing " + out_path.string();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "LevelFile.h"
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Builds a .rwl level from tile layers and spawn entries
+ *
+ * Collect the whole level, then write it in one pass. The writer lays
+ * out the tables and pads every tile array to c_LEVEL_ALIGNMENT so the
+ * result can be mapped and read in place by LevelFile.
+ */
+class LevelFileWriter
+{
+public:
+    void SetTileSize(float tile_size) { m_TileSize = tile_size; }
+
+    // tiles is row-major, width * height ids (c_LEVEL_TILE_EMPTY = nothing)
+    void AddLayer
+    (
+        std::string_view name,
+        uint32_t width,
+        uint32_t height,
+        float origin_x,
+        float origin_y,
+        std::vector<uint16_t> tiles,
+        uint32_t flags = 0
+    );
+
+    void AddSpawn
+    (
+        std::string_view type,
+        float x,
+        float y,
+        float param_a = 0.0f,
+        float param_b = 0.0f
+    );
+
+    size_t GetLayerCount() const { return m_Layers.size(); }
+    size_t GetSpawnCount() const { return m_Spawns.size(); }
+
+    bool b_Write(const fs::path& out_path, std::string& out_error) const;
+
+private:
+    struct t_PendingLayer
+    {
+        std::string name;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        float origin_x = 0.0f;
+        float origin_y = 0.0f;
+        uint32_t flags = 0;
+        std::vector<uint16_t> tiles;
+    };
+
+    struct t_PendingSpawn
+    {
+        std::string type;
+        float x = 0.0f;
+        float y = 0.0f;
+        float param_a = 0.0f;
+        float param_b = 0.0f;
+    };
+
+    float m_TileSize = 32.0f;
+    std::vector<t_PendingLayer> m_Layers;
+    std::vector<t_PendingSpawn> m_Spawns;
+};
@@ -0,0 +1,453 @@
+#include "Logger.h"
+#include <algorithm>
+#include <charconv>
+
+static_assert((c_LOG_QUEUE_SIZE & (c_LOG_QUEUE_SIZE - 1)) == 0, "c_LOG_QUEUE_SIZE must be a power of two");
+
+// This binary's view of the host logger; see AttachEngineLogger
+static std::atomic<Logger*> s_AttachedLogger{ nullptr };
+
+const char* GetLogLevelName(LogLevel level)
+{
+    switch (level)
+    {
+        case LogLevel::Trace:   return "Trace";
+        case LogLevel::Debug:   return "Debug";
+        case LogLevel::Info:    return "Info";
+        case LogLevel::Warning: return "Warning";
+        case LogLevel::Error:   return "Error";
+    }
+    return "Unknown";
+}
+
+/*
++--------------------------------------------------------+
+|                   MESSAGE FORMATTING                   |
++--------------------------------------------------------+
+*/
+
+void LogTextWriter::Append(std::string_view text)
+{
+    const size_t COUNT = std::min(text.size(), m_Capacity - m_Size);
+    text.copy(m_Data + m_Size, COUNT);
+    m_Size += COUNT;
+}
+
+// N of a ".Nf" spec, -1 for anything else
+static int s_fFixedPrecision(std::string_view spec)
+{
+    if (spec.size() < 3 || spec.front() != '.' || spec.back() != 'f')
+    {
+        return -1;
+    }
+
+    int precision = -1;
+    const char* LAST = spec.data() + spec.size() - 1;
+    const auto RESULT = std::from_chars(spec.data() + 1, LAST, precision);
+    return RESULT.ec == std::errc() && RESULT.ptr == LAST && precision <= 17 ? precision : -1;
+}
+
+template<typename T>
+static void s_fAppendNumber(LogTextWriter& out, T value)
+{
+    char buffer[24];
+    const auto RESULT = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.Append(std::string_view(buffer, static_cast<size_t>(RESULT.ptr - buffer)));
+}
+
+template<typename T>
+static void s_fAppendFloat(LogTextWriter& out, std::string_view spec, T value)
+{
+    char buffer[64];
+    const int PRECISION = s_fFixedPrecision(spec);
+    auto result = PRECISION >= 0
+        ? std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, PRECISION)
+        : std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+    // Too wide for fixed notation: the shortest form always fits
+    if (result.ec != std::errc())
+    {
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    }
+    out.Append(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)));
+}
+
+void FormatLogValue(LogTextWriter& out, std::string_view, std::string_view value)
+{
+    out.Append(value);
+}
+
+void FormatLogValue(LogTextWriter& out, std::string_view, bool value)
+{
+    out.Append(value ? "true" : "false");
+}
+
+void FormatLogValue(LogTextWriter& out, std::string_view, char value)
+{
+    out.Append(std::string_view(&value, 1));
+}
+
+void FormatLogValue(LogTextWriter& out, std::string_view, long long value)
+{
+    s_fAppendNumber(out, value);
+}
+
+void FormatLogValue(LogTextWriter& out, std::string_view, unsigned long long value)
+{
+    s_fAppendNumber(out, value);
+}
+
+void FormatLogValue(LogTextWriter& out, std::string_view spec, float value)
+{
+    s_fAppendFloat(out, spec, value);
+}
+
+void FormatLogValue(LogTextWriter& out, std::string_view spec, double value)
+{
+    s_fAppendFloat(out, spec, value);
+}
+
+void FormatLogValue(LogTextWriter& out, std::string_view, const void* value)
+{
+    char buffer[24] = "0x";
+    const auto RESULT = std::to_chars(buffer + 2, buffer + sizeof(buffer), reinterpret_cast<uintptr_t>(value), 16);
+    out.Append(std::string_view(buffer, static_cast<size_t>(RESULT.ptr - buffer)));
+}
+
+size_t FormatLogText(char* data, size_t capacity, std::string_view format, const t_LogArg* args, size_t arg_count)
+{
+    LogTextWriter out(data, capacity);
+    size_t next_arg = 0;
+    size_t pos = 0;
+
+    while (pos < format.size())
+    {
+        const size_t BRACE = format.find_first_of("{}", pos);
+        if (BRACE == std::string_view::npos)
+        {
+            out.Append(format.substr(pos));
+            break;
+        }
+        out.Append(format.substr(pos, BRACE - pos));
+
+        // "{{" and "}}"; a lone "}" is printed as is
+        if (BRACE + 1 < format.size() && format[BRACE + 1] == format[BRACE])
+        {
+            out.Append(format.substr(BRACE, 1));
+            pos = BRACE + 2;
+            continue;
+        }
+        if (format[BRACE] == '}')
+        {
+            out.Append("}");
+            pos = BRACE + 1;
+            continue;
+        }
+
+        const size_t CLOSE = format.find('}', BRACE);
+        if (CLOSE == std::string_view::npos)
+        {
+            out.Append(format.substr(BRACE));
+            break;
+        }
+
+        std::string_view spec = format.substr(BRACE + 1, CLOSE - BRACE - 1);
+        if (!spec.empty() && spec.front() == ':')
+        {
+            spec.remove_prefix(1);
+        }
+
+        if (next_arg < arg_count)
+        {
+            args[next_arg].format(out, spec, args[next_arg].value);
+            ++next_arg;
+        }
+        else
+        {
+            out.Append("{?}");
+        }
+        pos = CLOSE + 1;
+    }
+
+    return out.GetSize();
+}
+
+/*
++--------------------------------------------------------+
+|                         SINKS                          |
++--------------------------------------------------------+
+*/
+
+void ConsoleLogSink::Write(const t_LogRecord& record)
+{
+    const std::string_view TAG = record.GetTag();
+    const std::string_view TEXT = record.GetText();
+    const bool b_Problem = record.level >= LogLevel::Warning;
+
+    std::FILE* stream = b_Problem ? stderr : stdout;
+    std::fprintf
+    (
+        stream,
+        "[%.*s] %s%.*s\n",
+        static_cast<int>(TAG.size()), TAG.data(),
+        b_Problem ? (record.level == LogLevel::Error ? "Error: " : "Warning: ") : "",
+        static_cast<int>(TEXT.size()), TEXT.data()
+    );
+}
+
+void ConsoleLogSink::Flush()
+{
+    std::fflush(stdout);
+    std::fflush(stderr);
+}
+
+FileLogSink::FileLogSink(const std::string& path)
+{
+    m_File = std::fopen(path.c_str(), "w");
+}
+
+FileLogSink::~FileLogSink()
+{
+    if (m_File)
+    {
+        std::fclose(m_File);
+    }
+}
+
+void FileLogSink::Write(const t_LogRecord& record)
+{
+    if (!m_File)
+    {
+        return;
+    }
+
+    const std::string_view TAG = record.GetTag();
+    const std::string_view TEXT = record.GetText();
+    std::fprintf
+    (
+        m_File,
+        "%10.4f %-7s [%.*s] %.*s\n",
+        record.time,
+        GetLogLevelName(record.level),
+        static_cast<int>(TAG.size()), TAG.data(),
+        static_cast<int>(TEXT.size()), TEXT.data()
+    );
+}
+
+void FileLogSink::Flush()
+{
+    if (m_File)
+    {
+        std::fflush(m_File);
+    }
+}
+
+void MemoryLogSink::Write(const t_LogRecord& record)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Records.size() == m_Capacity)
+    {
+        m_Records.pop_front();
+    }
+    m_Records.push_back(record);
+    ++m_WriteCount;
+}
+
+void MemoryLogSink::CopyNewRecords(std::vector<t_LogRecord>& out, uint64_t& read_count) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    // Records that already fell out of the buffer are skipped
+    const uint64_t NEW_COUNT = std::min<uint64_t>(m_WriteCount - read_count, m_Records.size());
+    out.insert(out.end(), m_Records.end() - static_cast<ptrdiff_t>(NEW_COUNT), m_Records.end());
+    read_count = m_WriteCount;
+}
+
+void MemoryLogSink::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Records.clear();
+}
+
+/*
++--------------------------------------------------------+
+|                         LOGGER                         |
++--------------------------------------------------------+
+*/
+
+Logger::Logger()
+    : m_Slots(std::make_unique<t_Slot[]>(c_LOG_QUEUE_SIZE)),
+      m_StartTime(std::chrono::steady_clock::now())
+{
+    // A slot is free for the producer at position p when its sequence is p
+    // and readable for the writer when it is p + 1
+    for (size_t i = 0; i < c_LOG_QUEUE_SIZE; ++i)
+    {
+        m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    m_Sinks.push_back(std::make_shared<ConsoleLogSink>());
+    m_Thread = std::thread(&Logger::Run, this);
+}
+
+Logger::~Logger()
+{
+    m_bStop.store(true, std::memory_order_release);
+    m_bWake.store(true, std::memory_order_release);
+    m_bWake.notify_one();
+    if (m_Thread.joinable())
+    {
+        m_Thread.join();
+    }
+}
+
+Logger& Logger::Get()
+{
+    if (Logger* host = s_AttachedLogger.load(std::memory_order_acquire))
+    {
+        return *host;
+    }
+    static Logger s_Logger;
+    return s_Logger;
+}
+
+void Logger::Attach(Logger* host)
+{
+    s_AttachedLogger.store(host, std::memory_order_release);
+}
+
+void Logger::AddSink(std::shared_ptr<LogSink> sink)
+{
+    std::lock_guard<std::mutex> lock(m_SinkMutex);
+    m_Sinks.push_back(std::move(sink));
+}
+
+void Logger::RemoveSink(const std::shared_ptr<LogSink>& sink)
+{
+    // Waits out a batch in progress, so the sink is not in use afterwards
+    std::lock_guard<std::mutex> lock(m_SinkMutex);
+    std::erase(m_Sinks, sink);
+}
+
+t_LogRecord* Logger::ClaimSlot(size_t& position)
+{
+    size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        t_Slot& slot = m_Slots[pos & (c_LOG_QUEUE_SIZE - 1)];
+        const size_t SEQUENCE = slot.sequence.load(std::memory_order_acquire);
+        const intptr_t DIFF = static_cast<intptr_t>(SEQUENCE) - static_cast<intptr_t>(pos);
+        if (DIFF == 0)
+        {
+            if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                position = pos;
+                return &slot.record;
+            }
+        }
+        else if (DIFF < 0)
+        {
+            // The writer has not freed this slot yet: the queue is full
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        else
+        {
+            pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::Publish(size_t position, LogLevel level, std::string_view tag)
+{
+    t_Slot& slot = m_Slots[position & (c_LOG_QUEUE_SIZE - 1)];
+    t_LogRecord& record = slot.record;
+
+    const size_t TAG_LENGTH = std::min(tag.size(), c_LOG_TAG_SIZE - 1);
+    tag.copy(record.tag.data(), TAG_LENGTH);
+    record.tag[TAG_LENGTH] = '\0';
+    record.level = level;
+    record.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count();
+
+    slot.sequence.store(position + 1, std::memory_order_release);
+
+    // Only the first producer after the writer went idle pays for the wake-up
+    if (!m_bWake.exchange(true, std::memory_order_acq_rel))
+    {
+        m_bWake.notify_one();
+    }
+}
+
+void Logger::Flush()
+{
+    const size_t TARGET = m_EnqueuePos.load(std::memory_order_acquire);
+    size_t written = m_WrittenPos.load(std::memory_order_acquire);
+    while (written < TARGET && !m_bStop.load(std::memory_order_acquire))
+    {
+        m_WrittenPos.wait(written, std::memory_order_acquire);
+        written = m_WrittenPos.load(std::memory_order_acquire);
+    }
+}
+
+void Logger::Run()
+{
+    while (true)
+    {
+        // Taking the flag before draining means a record published after
+        // the drain leaves it set, and the wait below returns at once
+        m_bWake.exchange(false, std::memory_order_acq_rel);
+        const bool b_Stop = m_bStop.load(std::memory_order_acquire);
+
+        Drain();
+        if (b_Stop)
+        {
+            break;
+        }
+        m_bWake.wait(false, std::memory_order_acquire);
+    }
+
+    m_WrittenPos.store(m_EnqueuePos.load(std::memory_order_acquire), std::memory_order_release);
+    m_WrittenPos.notify_all();
+}
+
+void Logger::Drain()
+{
+    std::lock_guard<std::mutex> lock(m_SinkMutex);
+
+    bool b_Wrote = false;
+    while (true)
+    {
+        t_Slot& slot = m_Slots[m_DequeuePos & (c_LOG_QUEUE_SIZE - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != m_DequeuePos + 1)
+        {
+            // Empty, or the producer of this slot is still formatting; its
+            // Publish wakes the writer again
+            break;
+        }
+
+        for (const std::shared_ptr<LogSink>& SINK : m_Sinks)
+        {
+            SINK->Write(slot.record);
+        }
+        slot.sequence.store(m_DequeuePos + c_LOG_QUEUE_SIZE, std::memory_order_release);
+        ++m_DequeuePos;
+        b_Wrote = true;
+    }
+
+    if (!b_Wrote)
+    {
+        return;
+    }
+
+    for (const std::shared_ptr<LogSink>& SINK : m_Sinks)
+    {
+        SINK->Flush();
+    }
+    m_WrittenPos.store(m_DequeuePos, std::memory_order_release);
+    m_WrittenPos.notify_all();
+}
+
+void AttachEngineLogger(Logger* host)
+{
+    Logger::Attach(host);
+}
@@ -0,0 +1,366 @@
+#pragma once
+#include "EngineExport.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+enum class LogLevel : uint8_t
+{
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error
+};
+
+// Calls below this level are compiled out, arguments included:
+// -DRAYWAVES_MIN_LOG_LEVEL=3 keeps only warnings and errors
+#ifndef RAYWAVES_MIN_LOG_LEVEL
+#ifdef NDEBUG
+#define RAYWAVES_MIN_LOG_LEVEL 2
+#else
+#define RAYWAVES_MIN_LOG_LEVEL 1
+#endif
+#endif
+
+constexpr LogLevel c_MIN_LOG_LEVEL = static_cast<LogLevel>(RAYWAVES_MIN_LOG_LEVEL);
+
+// Records waiting for the writer thread; producers drop when it is full
+constexpr size_t c_LOG_QUEUE_SIZE = 2048;
+
+// Longer messages are cut off; tags are copied, so a record never points
+// into a GameLogic library that may be unloaded before it is written
+constexpr size_t c_LOG_TEXT_SIZE = 232;
+constexpr size_t c_LOG_TAG_SIZE = 20;
+
+const char* GetLogLevelName(LogLevel level);
+
+struct t_LogRecord
+{
+    double time = 0.0;              // seconds since the logger started
+    LogLevel level = LogLevel::Info;
+    uint16_t length = 0;
+    std::array<char, c_LOG_TAG_SIZE> tag{};
+    std::array<char, c_LOG_TEXT_SIZE> text{};
+
+    std::string_view GetTag() const { return tag.data(); }
+    std::string_view GetText() const { return { text.data(), length }; }
+};
+
+// Sinks are only called from the writer thread
+class LogSink
+{
+public:
+    virtual ~LogSink() = default;
+    virtual void Write(const t_LogRecord& record) = 0;
+
+    // After each batch, so output reaches the OS once per wake-up
+    virtual void Flush() {}
+};
+
+// "[Tag] text" to stdout; warnings and errors to stderr
+class ConsoleLogSink : public LogSink
+{
+public:
+    void Write(const t_LogRecord& record) override;
+    void Flush() override;
+};
+
+// Timestamped lines; the file is truncated when the sink is created
+class FileLogSink : public LogSink
+{
+public:
+    explicit FileLogSink(const std::string& path);
+    ~FileLogSink() override;
+
+    bool b_IsOpen() const { return m_File != nullptr; }
+    void Write(const t_LogRecord& record) override;
+    void Flush() override;
+
+private:
+    std::FILE* m_File = nullptr;
+};
+
+// Keeps the newest records for a UI to show (the editor's Log panel)
+class MemoryLogSink : public LogSink
+{
+public:
+    explicit MemoryLogSink(size_t capacity = 2000) : m_Capacity(capacity) {}
+
+    void Write(const t_LogRecord& record) override;
+
+    // Records written since the last call with the same counter; out is
+    // appended to. The counter starts at 0.
+    void CopyNewRecords(std::vector<t_LogRecord>& out, uint64_t& read_count) const;
+    void Clear();
+
+private:
+    mutable std::mutex m_Mutex;
+    std::deque<t_LogRecord> m_Records;
+    uint64_t m_WriteCount = 0;
+    size_t m_Capacity;
+};
+
+/**
+ * @brief Asynchronous logger that never blocks the calling thread
+ *
+ * A log call claims a slot in a bounded lock-free queue (multi-producer,
+ * one consumer), formats the message straight into it (see
+ * FormatLogMessage) and returns; nothing is allocated and nothing is written or flushed on
+ * the caller's thread. A background thread drains the queue into the
+ * sinks. When the queue is full the record is dropped and counted instead
+ * of waiting.
+ *
+ * The Engine is linked statically into the executables and into every
+ * GameLogic library, so each of them has its own Logger. The host passes
+ * its instance to a library it loads (AttachEngineLogger), and from then
+ * on Logger::Get() in the library returns the host's logger.
+ *
+ * Example Usage:
+ * @code
+ * RW_LOG_INFO("MapManager", "Switching to map: '{}'", map_id);
+ * RW_LOG_ERROR("DemoLevel", "Missing level file {}", path);
+ *
+ * // At startup, next to the default console sink
+ * Logger::Get().AddSink(std::make_shared<FileLogSink>("game.log"));
+ * Logger::Get().SetLevel(LogLevel::Warning);     // runtime filter
+ * @endcode
+ */
+class Logger
+{
+public:
+    Logger();
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // The host's logger once attached, else this binary's own (created on
+    // first use with a console sink)
+    static Logger& Get();
+    static void Attach(Logger* host);
+
+    void AddSink(std::shared_ptr<LogSink> sink);
+    void RemoveSink(const std::shared_ptr<LogSink>& sink);
+
+    void SetLevel(LogLevel level) { m_Level.store(level, std::memory_order_relaxed); }
+    LogLevel GetLevel() const { return m_Level.load(std::memory_order_relaxed); }
+    bool b_IsEnabled(LogLevel level) const { return level >= GetLevel(); }
+
+    template<typename... Args>
+    void Write(LogLevel level, std::string_view tag, std::string_view format, const Args&... args);
+
+    // Waits until everything logged before the call reached the sinks
+    void Flush();
+
+    uint64_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct t_Slot
+    {
+        std::atomic<size_t> sequence{ 0 };
+        t_LogRecord record;
+    };
+
+    // nullptr when the queue is full
+    t_LogRecord* ClaimSlot(size_t& position);
+    void Publish(size_t position, LogLevel level, std::string_view tag);
+
+    void Run();
+    void Drain();
+
+    std::unique_ptr<t_Slot[]> m_Slots;
+    alignas(64) std::atomic<size_t> m_EnqueuePos{ 0 };
+    alignas(64) size_t m_DequeuePos = 0;
+    std::atomic<size_t> m_WrittenPos{ 0 };
+    std::atomic<uint64_t> m_Dropped{ 0 };
+    std::atomic<LogLevel> m_Level{ c_MIN_LOG_LEVEL };
+
+    // Set by the producer that finds the writer idle; the writer waits on it
+    std::atomic<bool> m_bWake{ false };
+    std::atomic<bool> m_bStop{ false };
+
+    std::mutex m_SinkMutex;
+    std::vector<std::shared_ptr<LogSink>> m_Sinks;
+
+    std::chrono::steady_clock::time_point m_StartTime;
+    std::thread m_Thread;
+};
+
+/*
++--------------------------------------------------------+
+|                   MESSAGE FORMATTING                   |
++--------------------------------------------------------+
+*/
+
+// Bounded output of FormatLogMessage; text past the capacity is cut off
+class LogTextWriter
+{
+public:
+    LogTextWriter(char* data, size_t capacity) : m_Data(data), m_Capacity(capacity) {}
+
+    void Append(std::string_view text);
+    size_t GetSize() const { return m_Size; }
+
+private:
+    char* m_Data;
+    size_t m_Capacity;
+    size_t m_Size = 0;
+};
+
+// One argument with the spec between "{:" and "}" ("" for a plain "{}");
+// ".Nf" prints floating point values fixed with N decimals
+void FormatLogValue(LogTextWriter& out, std::string_view spec, std::string_view value);
+void FormatLogValue(LogTextWriter& out, std::string_view spec, bool value);
+void FormatLogValue(LogTextWriter& out, std::string_view spec, char value);
+void FormatLogValue(LogTextWriter& out, std::string_view spec, long long value);
+void FormatLogValue(LogTextWriter& out, std::string_view spec, unsigned long long value);
+void FormatLogValue(LogTextWriter& out, std::string_view spec, float value);
+void FormatLogValue(LogTextWriter& out, std::string_view spec, double value);
+void FormatLogValue(LogTextWriter& out, std::string_view spec, const void* value);
+
+template<typename T>
+void FormatLogArg(LogTextWriter& out, std::string_view spec, const T& value)
+{
+    using Type = std::remove_cvref_t<T>;
+    if constexpr (std::is_same_v<Type, bool> || std::is_same_v<Type, char> || std::is_same_v<Type, float>)
+    {
+        FormatLogValue(out, spec, value);
+    }
+    else if constexpr (std::is_enum_v<Type>)
+    {
+        FormatLogArg(out, spec, std::to_underlying(value));
+    }
+    else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+    {
+        FormatLogValue(out, spec, static_cast<long long>(value));
+    }
+    else if constexpr (std::is_integral_v<Type>)
+    {
+        FormatLogValue(out, spec, static_cast<unsigned long long>(value));
+    }
+    else if constexpr (std::is_floating_point_v<Type>)
+    {
+        FormatLogValue(out, spec, static_cast<double>(value));
+    }
+    else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>)
+    {
+        FormatLogValue(out, spec, std::string_view(value ? value : "(null)"));
+    }
+    else if constexpr (std::is_convertible_v<const Type&, std::string_view>)
+    {
+        FormatLogValue(out, spec, std::string_view(value));
+    }
+    else if constexpr (requires { value.string(); })
+    {
+        // std::filesystem::path
+        FormatLogValue(out, spec, std::string_view(value.string()));
+    }
+    else if constexpr (std::is_pointer_v<Type>)
+    {
+        FormatLogValue(out, spec, static_cast<const void*>(value));
+    }
+    else
+    {
+        static_assert(sizeof(Type) == 0, "RW_LOG: unsupported argument type");
+    }
+}
+
+struct t_LogArg
+{
+    void (*format)(LogTextWriter& out, std::string_view spec, const void* value);
+    const void* value;
+};
+
+template<typename T>
+void FormatLogArgErased(LogTextWriter& out, std::string_view spec, const void* value)
+{
+    FormatLogArg(out, spec, *static_cast<const T*>(value));
+}
+
+// Replaces each "{}" / "{:spec}" with the next argument, "{{" and "}}" with
+// a brace; a placeholder without an argument prints "{?}"
+size_t FormatLogText(char* data, size_t capacity, std::string_view format, const t_LogArg* args, size_t arg_count);
+
+/**
+ * @brief Formats a log message into a fixed buffer without allocating
+ *
+ * A small subset of the std::format syntax that stays within what every
+ * supported compiler ships: "{}" for strings, paths, bools, characters,
+ * integers, enums (as their value), floating point and pointers, plus
+ * "{:.Nf}" for fixed decimals. Returns the number of characters written,
+ * at most capacity.
+ *
+ * Example Usage:
+ * @code
+ * std::array<char, 64> text;
+ * const size_t LENGTH = FormatLogMessage(text.data(), text.size(), "{} took {:.2f} ms", name, ms);
+ * @endcode
+ */
+template<typename... Args>
+size_t FormatLogMessage(char* data, size_t capacity, std::string_view format, const Args&... args)
+{
+    // One extra entry, so the array is never empty
+    const t_LogArg ARGS[] = { t_LogArg{ &FormatLogArgErased<Args>, &args }..., t_LogArg{ nullptr, nullptr } };
+    return FormatLogText(data, capacity, format, ARGS, sizeof...(Args));
+}
+
+template<typename... Args>
+void Logger::Write(LogLevel level, std::string_view tag, std::string_view format, const Args&... args)
+{
+    size_t position = 0;
+    t_LogRecord* record = ClaimSlot(position);
+    if (!record)
+    {
+        return;
+    }
+
+    const size_t LENGTH = FormatLogMessage(record->text.data(), c_LOG_TEXT_SIZE, format, args...);
+    record->length = static_cast<uint16_t>(LENGTH);
+
+    Publish(position, level, tag);
+}
+
+// Exported from every binary the Engine is linked into; the host calls it
+// in each GameLogic library it loads
+ENGINE_EXPORT void AttachEngineLogger(Logger* host);
+using AttachEngineLoggerFunc = void (*)(Logger*);
+
+/*
++--------------------------------------------------------+
+|                       LOG MACROS                       |
++--------------------------------------------------------+
+*/
+
+// Below c_MIN_LOG_LEVEL the call is discarded at compile time (the
+// arguments are still type-checked); above it, disabled levels cost one
+// atomic load
+#define RW_LOG(LEVEL, TAG, ...)                                         \
+    do                                                                  \
+    {                                                                   \
+        if constexpr (LEVEL >= c_MIN_LOG_LEVEL)                         \
+        {                                                               \
+            Logger& rw_logger = Logger::Get();                          \
+            if (rw_logger.b_IsEnabled(LEVEL))                           \
+            {                                                           \
+                rw_logger.Write(LEVEL, TAG, __VA_ARGS__);               \
+            }                                                           \
+        }                                                               \
+    } while (0)
+
+#define RW_LOG_TRACE(TAG, ...)   RW_LOG(LogLevel::Trace, TAG, __VA_ARGS__)
+#define RW_LOG_DEBUG(TAG, ...)   RW_LOG(LogLevel::Debug, TAG, __VA_ARGS__)
+#define RW_LOG_INFO(TAG, ...)    RW_LOG(LogLevel::Info, TAG, __VA_ARGS__)
+#define RW_LOG_WARNING(TAG, ...) RW_LOG(LogLevel::Warning, TAG, __VA_ARGS__)
+#define RW_LOG_ERROR(TAG, ...)   RW_LOG(LogLevel::Error, TAG, __VA_ARGS__)
@@ -1,83 +1,167 @@
 #include "MapManager.h"
+#include "AssetManager.h"
+#include <algorithm>
+
+enum class MapRestore
+{
+    Restored,
+    Skipped,    // nothing saved, or saved by an incompatible version
+    Failed      // the map may be half-restored and has to be rebuilt
+};
+
+static void s_fWriteMapState(MapSnapshot& out, const GameMap& map)
+{
+    MapSnapshot state;
+    if (!map.b_SaveSnapshot(state))
+    {
+        state.Clear();
+    }
+    out.Write(map.GetSnapshotVersion());
+    out.WriteSnapshot(state);
+}
+
+static MapRestore s_fRestoreMapState(GameMap& map, uint32_t version, MapSnapshot& state)
+{
+    if (state.b_IsEmpty() || version != map.GetSnapshotVersion())
+    {
+        return MapRestore::Skipped;
+    }
+
+    state.BeginRead();
+    return map.b_RestoreSnapshot(state) && state.b_IsFullyRead()
+        ? MapRestore::Restored
+        : MapRestore::Failed;
+}
 
 MapManager::MapManager()
     : m_CurrentMap(nullptr)
     , m_CurrentMapId("")
     , m_bUsingDefaultMap(false)
 {
-    std::cout << "[MapManager] Initialized - ready for map registration" 
-              << "\n";
+    RW_LOG_DEBUG("MapManager", "Initialized - ready for map registration");
 }
 
 MapManager::~MapManager()
 {
-    std::cout << "[MapManager] Destroyed - all maps cleaned up" 
-              << "\n";
+    // Maps may stage layer requests while being destroyed, so they go
+    // before the members those callbacks write to
+    m_Pending.reset();
+    m_SuspendedMaps.clear();
+    m_CurrentMap.reset();
+    m_Layers.clear();
+
+    RW_LOG_DEBUG("MapManager", "Destroyed - all maps cleaned up");
 }
 
 void MapManager::Initialize()
 {
-    std::cout << "[MapManager] MapManager initialized - waiting for map registration" 
-              << "\n";
+    RW_LOG_DEBUG("MapManager", "MapManager initialized - waiting for map registration");
 
-    if (m_CurrentMap)
+    // Layers pushed before the engine attached services start over with them
+    for (t_MapLayer& layer : m_Layers)
     {
-        // Make sure the map has proper scene bounds
-        Vector2 bounds = GameMap::GetSceneBounds();
-        m_CurrentMap->SetSceneBounds(bounds.x, bounds.y);
-
-        // Inject transition callback so the map can request transitions
-        m_CurrentMap->SetTransitionCallback
-        (
-            [this](std::string_view id, bool force)
-            {
-                this->b_GotoMap(std::string(id), force);
-            }
-        );
+        InjectServices(*layer.map);
+        layer.map->Initialize();
+    }
 
+    if (m_CurrentMap)
+    {
+        InjectServices(*m_CurrentMap);
         m_CurrentMap->Initialize();
+        CaptureSnapshot();
         
-        std::cout << "[MapManager] Successfully initialized with map: '" 
-                  << m_CurrentMapId 
-                  << "'" 
-                  << "\n";
+        RW_LOG_INFO("MapManager", "Successfully initialized with map: '{}'", m_CurrentMapId);
+
+        UpdatePrefetchSet();
     }
     else if (!m_MapRegistry.empty())
     {
-        std::cout << "[MapManager] Maps registered but none loaded yet. Use GotoMap() to load a map." 
-                  << "\n";
+        RW_LOG_INFO("MapManager", "Maps registered but none loaded yet. Use GotoMap() to load a map.");
 
-        std::cout << "[MapManager] Registered maps: ";
+        std::string names;
         for (const auto& pair : m_MapRegistry)
         {
-            std::cout << "'" << pair.first << "' ";
+            names += "'" + pair.first + "' ";
         }
-        std::cout << "\n";
+        RW_LOG_INFO("MapManager", "Registered maps: {}", names);
     }
     else
     {
-        std::cout << "[MapManager] No maps registered yet. Register maps using RegisterMap<YourMap>()" 
-                  << "\n";
+        RW_LOG_INFO("MapManager", "No maps registered yet. Register maps using RegisterMap<YourMap>()");
     }
 }
 
 void MapManager::Update(float delta_time)
 {
-    // Update the current map if we have one
-    if (m_CurrentMap)
+    ApplyPendingChanges();
+    UpdateLayers(delta_time);
+}
+
+void MapManager::ApplyPendingChanges()
+{
+    // Frame boundary: swap in a prepared map before anything else runs
+    if (m_Pending && b_IsPendingReady())
     {
-        m_CurrentMap->Update(delta_time);
+        CompletePendingTransition();
     }
+
+    ApplyLayerRequests();
 }
 
-void MapManager::Draw()
+void MapManager::UpdateLayers(float delta_time)
 {
-    // Draw the current map if we have one
-    if (m_CurrentMap)
+    // Input focus and pausing flow from the top layer down
+    std::vector<t_LayerView> stack = GetLayerStack();
+    std::vector<bool> runs(stack.size(), false);
+    bool b_InputTaken = false;
+    bool b_PausedFromAbove = false;
+
+    for (size_t i = stack.size(); i-- > 0;)
     {
-        m_CurrentMap->Draw();
+        const t_LayerOptions& OPTIONS = *stack[i].options;
+        const bool b_Runs = !OPTIONS.b_Paused && !b_PausedFromAbove;
+
+        stack[i].map->SetInputFocus(b_Runs && !b_InputTaken);
+        runs[i] = b_Runs;
+
+        if (b_Runs && OPTIONS.b_Visible)
+        {
+            b_InputTaken = b_InputTaken || OPTIONS.b_ConsumesInput;
+            b_PausedFromAbove = b_PausedFromAbove || OPTIONS.b_PausesBelow;
+        }
     }
-    else
+
+    // Maps only stage requests during Update, so the stack stays valid
+    for (size_t i = 0; i < stack.size(); ++i)
+    {
+        if (runs[i])
+        {
+            TickLayer(stack[i], delta_time);
+        }
+    }
+}
+
+void MapManager::TickLayer(const t_LayerView& layer, float delta_time)
+{
+    if (layer.options->tick_rate <= 0.0f)
+    {
+        layer.map->Update(delta_time);
+        return;
+    }
+
+    // One update with the time gathered since the last tick, so a 10 Hz
+    // layer still animates at the right speed
+    *layer.accumulator += delta_time;
+    if (*layer.accumulator >= 1.0f / layer.options->tick_rate)
+    {
+        layer.map->Update(*layer.accumulator);
+        *layer.accumulator = 0.0f;
+    }
+}
+
+void MapManager::Draw()
+{
+    if (!m_CurrentMap)
     {
         // Check if the window is ready before drawing
         if (GetWindowHandle() != nullptr)
@@ -110,6 +194,65 @@ void MapManager::Draw()
             );
         }
     }
+
+    for (const t_LayerView& LAYER : GetLayerStack())
+    {
+        if (LAYER.options->b_Visible)
+        {
+            LAYER.map->Draw();
+        }
+    }
+
+    if (m_Pending && m_bShowLoadingOverlay)
+    {
+        DrawLoadingOverlay();
+    }
+}
+
+void MapManager::DrawLoadingOverlay() const
+{
+    const float ELAPSED = std::chrono::duration<float>
+    (
+        std::chrono::steady_clock::now() - m_Pending->start
+    ).count();
+
+    if (ELAPSED < c_LOADING_OVERLAY_DELAY || GetWindowHandle() == nullptr)
+    {
+        return;
+    }
+
+    const Vector2 BOUNDS = GetSceneBounds();
+    const int WIDTH = static_cast<int>(BOUNDS.x);
+    const int HEIGHT = static_cast<int>(BOUNDS.y);
+
+    // Prefetch progress for the incoming map's manifest
+    float progress = 1.0f;
+    if (m_AssetManager && m_Pending->asset_count > 0)
+    {
+        const size_t REMAINING = std::min
+        (
+            m_AssetManager->GetPrefetchPendingCount(m_Pending->assets),
+            m_Pending->asset_count
+        );
+        progress = 1.0f - static_cast<float>(REMAINING) / m_Pending->asset_count;
+    }
+
+    DrawRectangle(0, 0, WIDTH, HEIGHT, Fade(BLACK, 0.6f));
+
+    const std::string LABEL = "Loading " + m_Pending->map_id + "...";
+    DrawText
+    (
+        LABEL.c_str(), 
+        (WIDTH - MeasureText(LABEL.c_str(), 24)) / 2, 
+        HEIGHT / 2 - 40, 
+        24, 
+        RAYWHITE
+    );
+
+    const int BAR_WIDTH = WIDTH / 3;
+    const int BAR_X = (WIDTH - BAR_WIDTH) / 2;
+    DrawRectangle(BAR_X, HEIGHT / 2, BAR_WIDTH, 8, DARKGRAY);
+    DrawRectangle(BAR_X, HEIGHT / 2, static_cast<int>(BAR_WIDTH * progress), 8, RAYWHITE);
 }
 
 void MapManager::SetSceneBounds(float width, float height)
@@ -122,6 +265,11 @@ void MapManager::SetSceneBounds(float width, float height)
     {
         m_CurrentMap->SetSceneBounds(width, height);
     }
+
+    for (t_MapLayer& layer : m_Layers)
+    {
+        layer.map->SetSceneBounds(width, height);
+    }
 }
 
 Vector2 MapManager::GetSceneBounds() const
@@ -140,34 +288,46 @@ bool MapManager::b_GotoMap(const std::string& map_id, bool force_reload)
     // Check if map is registered
     if (!b_IsMapRegistered(map_id))
     {
-        std::cerr << "[MapManager] Error: Map '" 
-                  << map_id 
-                  << "' is not registered!" 
-                  << "\n";
+        RW_LOG_ERROR("MapManager", "Map '{}' is not registered!", map_id);
 
-        std::cerr << "[MapManager] Available maps: ";
+        std::string names;
         for (const auto& available_map : GetAvailableMaps())
         {
-            std::cerr << "'" << available_map << "' ";
+            names += "'" + available_map + "' ";
         }
-        std::cerr << "\n";
+        RW_LOG_ERROR("MapManager", "Available maps: {}", names);
         return false;
     }
     
+    // A direct switch overrides any staged one, even back to the current map
+    const bool b_HadPending = m_Pending.has_value();
+    m_Pending.reset();
+
     // If it's the same map and we don't want to force reload, just return true
     if (m_CurrentMapId == map_id && !force_reload)
     {
-        std::cout << "[MapManager] Map '" 
-                  << map_id 
-                  << "' is already loaded" 
-                  << "\n";
+        if (b_HadPending)
+        {
+            UpdatePrefetchSet();
+        }
+        RW_LOG_INFO("MapManager", "Map '{}' is already loaded", map_id);
         return true;
     }
+
+    if (!force_reload)
+    {
+        MapSnapshot snapshot;
+        if (auto suspended = TakeSuspendedMap(map_id, &snapshot))
+        {
+            RW_LOG_INFO("MapManager", "Resuming map: '{}'", map_id);
+
+            ActivateMap(map_id, std::move(suspended), true);
+            m_Snapshot = std::move(snapshot);
+            return true;
+        }
+    }
     
-    std::cout << "[MapManager] Switching to map: '" 
-              << map_id 
-              << "'" 
-              << "\n";
+    RW_LOG_INFO("MapManager", "Switching to map: '{}'", map_id);
     
     try
     {
@@ -177,169 +337,1065 @@ bool MapManager::b_GotoMap(const std::string& map_id, bool force_reload)
         
         if (!new_map)
         {
-            std::cerr << "[MapManager] Error: Factory for map '"
-                      << map_id
-                      << "' returned null!"
-                      << "\n";
+            RW_LOG_ERROR("MapManager", "Factory for map '{}' returned null!", map_id);
             return false;
         }
         
-        // Created new map 
-        m_CurrentMap = std::move(new_map);
-        m_CurrentMapId = map_id;
-        m_MapInfo[map_id].b_IsLoaded = true;
-        m_bUsingDefaultMap = false; 
-        
-        // Set up the new map with current scene bounds
-        Vector2 bounds = GameMap::GetSceneBounds();
-        if (m_CurrentMap) 
-        {
-            m_CurrentMap->SetSceneBounds(bounds.x, bounds.y);
-
-            // Inject transition callback for map-driven transitions
-            m_CurrentMap->SetTransitionCallback
-            (
-                [this](std::string_view id, bool force)
-                {
-                    this->b_GotoMap(std::string(id), force);
-                }
-            );
-            m_CurrentMap->Initialize();
-        }
-        std::cout << "[MapManager] Successfully loaded map: '" 
-                  << map_id 
-                  << "'" 
-                  << "\n";
-
-        std::cout << "[MapManager] Current map ID: '" 
-                  << m_CurrentMapId 
-                  << "'" 
-                  << "\n";
-
+        ActivateMap(map_id, std::move(new_map));
         return true;
     }
     catch (const std::exception& e)
     {
-        std::cerr << "[MapManager] Error creating map '" 
-                  << map_id 
-                  << "': " 
-                  << e.what() 
-                  << "\n";
+        RW_LOG_ERROR("MapManager", "Error creating map '{}': {}", map_id, e.what());
 
         return false;
     }
     catch (...)
     {
-        std::cerr << "[MapManager] Unknown error creating map '" 
-                  << map_id 
-                  << "'" 
-                  << "\n";
+        RW_LOG_ERROR("MapManager", "Unknown error creating map '{}'", map_id);
 
         return false;
     }
 }
 
-bool MapManager::b_IsCurrentMap(const std::string& map_id) const
+bool MapManager::b_BeginGotoMap(const std::string& map_id, bool force_reload)
 {
-    return m_CurrentMapId == map_id &&
-           m_CurrentMap != nullptr;
-}
+    if (!b_IsMapRegistered(map_id))
+    {
+        RW_LOG_ERROR("MapManager", "Map '{}' is not registered!", map_id);
+        return false;
+    }
 
-std::vector<std::string> MapManager::GetAvailableMaps() const
-{
-    std::vector<std::string> maps;
-    maps.reserve(m_MapRegistry.size());
-    
-    for (const auto& pair : m_MapRegistry)
+    if (m_Pending && m_Pending->map_id == map_id)
     {
-        maps.push_back(pair.first);
+        return true;
     }
-    
-    return maps;
+
+    if (m_CurrentMapId == map_id && !force_reload)
+    {
+        // Asking for the current map cancels a transition away from it
+        if (m_Pending)
+        {
+            m_Pending.reset();
+            UpdatePrefetchSet();
+        }
+        return true;
+    }
+
+    RW_LOG_INFO("MapManager", "Preparing map: '{}'", map_id);
+
+    // Replacing a pending transition waits for its factory to return
+    t_PendingTransition pending;
+    pending.map_id = map_id;
+    pending.start = std::chrono::steady_clock::now();
+    pending.b_Resume = !force_reload && b_IsMapSuspended(map_id);
+    if (!pending.b_Resume)
+    {
+        pending.map = std::async(std::launch::async, m_MapRegistry[map_id]);
+    }
+    m_Pending = std::move(pending);
+
+    // Narrows the prefetch set to the incoming map's manifest; readiness
+    // and progress only look at those assets
+    UpdatePrefetchSet();
+    if (m_AssetManager && !m_Pending->b_Resume)
+    {
+        m_Pending->assets = m_MapInfo[map_id].manifest.assets;
+        m_Pending->asset_count = m_AssetManager->GetPrefetchPendingCount(m_Pending->assets);
+    }
+    return true;
 }
 
-bool MapManager::b_IsMapRegistered(const std::string& map_id) const
+bool MapManager::b_IsPendingReady() const
 {
-    return m_MapRegistry.find(map_id) != m_MapRegistry.end();
+    if (m_Pending->b_Resume)
+    {
+        return true;
+    }
+
+    if (m_Pending->map.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return false;
+    }
+    return !m_AssetManager || m_AssetManager->GetPrefetchPendingCount(m_Pending->assets) == 0;
 }
 
-void MapManager::UnloadCurrentMap()
+void MapManager::CompletePendingTransition()
 {
-    if (m_CurrentMap)
+    t_PendingTransition pending = std::move(*m_Pending);
+    m_Pending.reset();
+
+    // Also rebuilds the map if its suspended instance was evicted meanwhile
+    if (pending.b_Resume)
     {
-        std::cout << "[MapManager] Unloading map: '" 
-                  << m_CurrentMapId 
-                  << "'" 
-                  << "\n";
-        
-        // Mark as not loaded in metadata
-        if (m_MapInfo.find(m_CurrentMapId) != m_MapInfo.end())
+        b_GotoMap(pending.map_id);
+        return;
+    }
+
+    const double PREPARE_MS = std::chrono::duration<double, std::milli>
+    (
+        std::chrono::steady_clock::now() - pending.start
+    ).count();
+
+    try
+    {
+        auto new_map = pending.map.get();
+        if (!new_map)
         {
-            m_MapInfo[m_CurrentMapId].b_IsLoaded = false;
+            RW_LOG_ERROR("MapManager", "Factory for map '{}' returned null!", pending.map_id);
+            UpdatePrefetchSet();
+            return;
         }
-        
-        m_CurrentMap.reset();
-        m_CurrentMapId = "";
-        m_bUsingDefaultMap = false;
+
+        RW_LOG_INFO
+        (
+            "MapManager",
+            "Map '{}' prepared in {} ms ({} assets prefetched)",
+            pending.map_id,
+            static_cast<int>(PREPARE_MS),
+            pending.asset_count
+        );
+
+        ActivateMap(pending.map_id, std::move(new_map));
     }
-    else
+    catch (const std::exception& e)
+    {
+        RW_LOG_ERROR("MapManager", "Error creating map '{}': {}", pending.map_id, e.what());
+        UpdatePrefetchSet();
+    }
+    catch (...)
     {
-        std::cout << "[MapManager] No map to unload" << "\n";
+        RW_LOG_ERROR("MapManager", "Unknown error creating map '{}'", pending.map_id);
+        UpdatePrefetchSet();
     }
 }
 
-bool MapManager::b_ReloadCurrentMap()
+void MapManager::ActivateMap
+(
+    const std::string& map_id, 
+    std::unique_ptr<GameMap> new_map, 
+    bool b_Resumed
+)
 {
-    if (m_CurrentMapId.empty())
+    // Learn the transition for prefetching the next time we are here
+    if (!m_CurrentMapId.empty() && m_CurrentMapId != map_id)
     {
-        std::cout << "[MapManager] No current map to reload" << "\n";
-        return false;
+        ++m_MapInfo[m_CurrentMapId].transitions[map_id];
     }
+    std::erase(m_PreloadRequests, map_id);
+
+    ReleaseCurrentMap(map_id);
+
+    // A fresh instance replaces any parked one, which would be stale
+    if (!b_Resumed)
+    {
+        TakeSuspendedMap(map_id);
+    }
+
+    m_CurrentMap = std::move(new_map);
+    m_CurrentMapId = map_id;
+    m_MapInfo[map_id].b_IsLoaded = true;
+    m_bUsingDefaultMap = false; 
+    m_BaseLayer = { .order = c_LAYER_BASE_ORDER };
+    m_BaseAccumulator = 0.0f;
     
-    std::string map_to_reload = m_CurrentMapId;
-    std::cout << "[MapManager] Reloading map: '" 
-              << map_to_reload << "'" 
-              << "\n";
-    
-    return b_GotoMap(map_to_reload, true);
+    InjectServices(*m_CurrentMap);
+
+    if (b_Resumed)
+    {
+        m_CurrentMap->OnResume();
+        RecordStartLayers();
+    }
+    else
+    {
+        m_CurrentMap->Initialize();
+        CaptureSnapshot();
+    }
+    UpdatePrefetchSet();
+
+    RW_LOG_INFO("MapManager", "Successfully loaded map: '{}'", map_id);
+
+    RW_LOG_DEBUG("MapManager", "Current map ID: '{}'", m_CurrentMapId);
 }
 
-std::string MapManager::GetDebugInfo() const
+void MapManager::ReleaseCurrentMap(const std::string& next_map_id)
 {
-    std::stringstream ss;
-    ss << "=== MapManager Debug Info ===\n";
+    if (!m_CurrentMap)
+    {
+        return;
+    }
 
-    ss << "Current Map: " 
-       << ( m_CurrentMapId.empty() ? "None" : m_CurrentMapId) 
-       << "\n";
+    // Reloading a map always destroys the old instance
+    if (m_SuspendLimit > 0 && m_CurrentMapId != next_map_id)
+    {
+        m_CurrentMap->OnSuspend();
+        m_SuspendedMaps.push_back
+        (
+            { m_CurrentMapId, std::move(m_CurrentMap), std::move(m_Snapshot) }
+        );
+        m_Snapshot.Clear();
 
-    ss << "Using Default Map: " 
-       << (m_bUsingDefaultMap ? "Yes" : "No") 
-       << "\n";
+        RW_LOG_INFO("MapManager", "Suspended map: '{}'", m_SuspendedMaps.back().map_id);
 
-    ss << "Registered Maps (" << m_MapRegistry.size() << "):";
-    
-    for (const auto& pair : m_MapInfo)
+        TrimSuspendedMaps(m_SuspendLimit);
+        return;
+    }
+
+    m_MapInfo[m_CurrentMapId].b_IsLoaded = false;
+    m_CurrentMap.reset();
+    m_Snapshot.Clear();
+}
+
+std::unique_ptr<GameMap> MapManager::TakeSuspendedMap
+(
+    const std::string& map_id, 
+    MapSnapshot* out_snapshot
+)
+{
+    auto it = std::find_if
+    (
+        m_SuspendedMaps.begin(),
+        m_SuspendedMaps.end(),
+        [&](const t_SuspendedMap& suspended) { return suspended.map_id == map_id; }
+    );
+    if (it == m_SuspendedMaps.end())
     {
-        const std::string& MAP_ID = pair.first;
-        const t_MapInfo& INFO = pair.second;
-        ss << "\n  - '" << MAP_ID << "': " << INFO.description;
-        ss << " [" << (INFO.b_IsLoaded ? "LOADED" : "NOT LOADED") << "]";
+        return nullptr;
     }
-    
-    if (m_MapRegistry.empty())
+
+    std::unique_ptr<GameMap> map = std::move(it->map);
+    if (out_snapshot)
     {
-        ss << "\n  (No maps registered - call RegisterMap<YourMap>() to register maps)";
+        *out_snapshot = std::move(it->snapshot);
     }
-    
-    return ss.str();
+    m_SuspendedMaps.erase(it);
+    return map;
+}
+
+void MapManager::TrimSuspendedMaps(size_t max_maps)
+{
+    while (m_SuspendedMaps.size() > max_maps)
+    {
+        const std::string MAP_ID = m_SuspendedMaps.front().map_id;
+        RW_LOG_INFO("MapManager", "Destroying least recently used map: '{}'", MAP_ID);
+
+        m_SuspendedMaps.erase(m_SuspendedMaps.begin());
+        m_MapInfo[MAP_ID].b_IsLoaded = false;
+    }
+}
+
+void MapManager::SetSuspendLimit(size_t max_maps)
+{
+    m_SuspendLimit = max_maps;
+    TrimSuspendedMaps(max_maps);
+}
+
+bool MapManager::b_IsMapSuspended(const std::string& map_id) const
+{
+    return std::any_of
+    (
+        m_SuspendedMaps.begin(),
+        m_SuspendedMaps.end(),
+        [&](const t_SuspendedMap& suspended) { return suspended.map_id == map_id; }
+    );
+}
+
+void MapManager::ClearSuspendedMaps()
+{
+    TrimSuspendedMaps(0);
+}
+
+void MapManager::InjectServices(GameMap& map)
+{
+    Vector2 bounds = GameMap::GetSceneBounds();
+    map.SetSceneBounds(bounds.x, bounds.y);
+    map.SetAssetManager(m_AssetManager);
+    map.SetAudioMixer(m_AudioMixer);
+    map.SetInput(m_Input);
+
+    // Map-driven transitions and layer changes are staged, so a map never
+    // destroys itself (or the stack being walked) from inside its Update
+    map.SetTransitionCallback
+    (
+        [this](std::string_view id, bool force)
+        {
+            this->b_BeginGotoMap(std::string(id), force);
+        }
+    );
+    map.SetLayerCallbacks
+    (
+        [this](std::string_view id, const t_LayerOptions& options)
+        {
+            m_LayerRequests.push_back({ true, std::string(id), options });
+        },
+        [this](std::string_view id)
+        {
+            m_LayerRequests.push_back({ false, std::string(id), {} });
+        }
+    );
+}
+
+bool MapManager::b_PushLayer(const std::string& map_id, const t_LayerOptions& options)
+{
+    if (!b_IsMapRegistered(map_id))
+    {
+        RW_LOG_ERROR("MapManager", "Layer map '{}' is not registered!", map_id);
+        return false;
+    }
+
+    if (b_HasLayer(map_id) || map_id == m_CurrentMapId)
+    {
+        RW_LOG_ERROR("MapManager", "Map '{}' is already running", map_id);
+        return false;
+    }
+
+    std::unique_ptr<GameMap> layer_map;
+    try
+    {
+        layer_map = m_MapRegistry[map_id]();
+    }
+    catch (const std::exception& e)
+    {
+        RW_LOG_ERROR("MapManager", "Error creating layer '{}': {}", map_id, e.what());
+        return false;
+    }
+
+    if (!layer_map)
+    {
+        RW_LOG_ERROR("MapManager", "Factory for layer '{}' returned null!", map_id);
+        return false;
+    }
+
+    InjectServices(*layer_map);
+    layer_map->Initialize();
+
+    // Stable: among equal orders, the layer pushed last draws on top
+    auto it = std::upper_bound
+    (
+        m_Layers.begin(),
+        m_Layers.end(),
+        options.order,
+        [](int order, const t_MapLayer& layer) { return order < layer.options.order; }
+    );
+    m_Layers.insert(it, { map_id, std::move(layer_map), options, 0.0f });
+
+    RW_LOG_INFO("MapManager", "Pushed layer: '{}' (order {})", map_id, options.order);
+    return true;
+}
+
+bool MapManager::b_RemoveLayer(const std::string& map_id)
+{
+    auto it = std::find_if
+    (
+        m_Layers.begin(),
+        m_Layers.end(),
+        [&](const t_MapLayer& layer) { return layer.map_id == map_id; }
+    );
+    if (it == m_Layers.end())
+    {
+        return false;
+    }
+
+    m_Layers.erase(it);
+    RW_LOG_INFO("MapManager", "Removed layer: '{}'", map_id);
+    return true;
+}
+
+bool MapManager::b_HasLayer(const std::string& map_id) const
+{
+    return GetLayer(map_id) != nullptr;
+}
+
+GameMap* MapManager::GetLayer(const std::string& map_id) const
+{
+    for (const t_MapLayer& LAYER : m_Layers)
+    {
+        if (LAYER.map_id == map_id)
+        {
+            return LAYER.map.get();
+        }
+    }
+    return nullptr;
+}
+
+std::vector<t_MapEntityCount> MapManager::GetEntityCounts() const
+{
+    std::vector<t_MapEntityCount> counts;
+    if (m_CurrentMap)
+    {
+        counts.push_back({ m_CurrentMapId, m_CurrentMap->GetEntityCount(), false });
+    }
+    for (const t_MapLayer& LAYER : m_Layers)
+    {
+        counts.push_back({ LAYER.map_id, LAYER.map->GetEntityCount(), true });
+    }
+    return counts;
+}
+
+size_t MapManager::GetEntityCount() const
+{
+    size_t total = 0;
+    for (const t_MapEntityCount& ENTRY : GetEntityCounts())
+    {
+        total += ENTRY.count;
+    }
+    return total;
+}
+
+size_t MapManager::GetSnapshotBytes() const
+{
+    size_t bytes = m_Snapshot.GetSize();
+    for (const t_SuspendedMap& SUSPENDED : m_SuspendedMaps)
+    {
+        bytes += SUSPENDED.snapshot.GetSize();
+    }
+    return bytes;
+}
+
+std::vector<std::string> MapManager::GetLayerIds() const
+{
+    std::vector<std::string> ids;
+    for (const t_MapLayer& LAYER : m_Layers)
+    {
+        ids.push_back(LAYER.map_id);
+    }
+    return ids;
+}
+
+t_LayerOptions* MapManager::FindLayerOptions(const std::string& map_id)
+{
+    if (m_CurrentMap && map_id == m_CurrentMapId)
+    {
+        return &m_BaseLayer;
+    }
+
+    for (t_MapLayer& layer : m_Layers)
+    {
+        if (layer.map_id == map_id)
+        {
+            return &layer.options;
+        }
+    }
+    return nullptr;
+}
+
+void MapManager::SetLayerPaused(const std::string& map_id, bool b_Paused)
+{
+    if (t_LayerOptions* options = FindLayerOptions(map_id))
+    {
+        options->b_Paused = b_Paused;
+    }
+}
+
+void MapManager::SetLayerVisible(const std::string& map_id, bool b_Visible)
+{
+    if (t_LayerOptions* options = FindLayerOptions(map_id))
+    {
+        options->b_Visible = b_Visible;
+    }
+}
+
+void MapManager::SetLayerTickRate(const std::string& map_id, float tick_rate)
+{
+    if (t_LayerOptions* options = FindLayerOptions(map_id))
+    {
+        options->tick_rate = std::max(0.0f, tick_rate);
+    }
+}
+
+void MapManager::ApplyLayerRequests()
+{
+    // Requests made while applying (e.g. in a layer's Initialize) wait a frame
+    std::vector<t_LayerRequest> requests = std::move(m_LayerRequests);
+    m_LayerRequests.clear();
+
+    for (const t_LayerRequest& REQUEST : requests)
+    {
+        // A map re-running Initialize asks for its layers again; keep them
+        if (REQUEST.b_Push && b_HasLayer(REQUEST.map_id))
+        {
+            continue;
+        }
+
+        if (REQUEST.b_Push)
+        {
+            b_PushLayer(REQUEST.map_id, REQUEST.options);
+        }
+        else
+        {
+            b_RemoveLayer(REQUEST.map_id);
+        }
+    }
+}
+
+std::vector<MapManager::t_LayerView> MapManager::GetLayerStack()
+{
+    std::vector<t_LayerView> stack;
+    stack.reserve(m_Layers.size() + 1);
+
+    bool b_BaseAdded = !m_CurrentMap;
+    for (t_MapLayer& layer : m_Layers)
+    {
+        if (!b_BaseAdded && layer.options.order >= m_BaseLayer.order)
+        {
+            stack.push_back({ m_CurrentMap.get(), &m_BaseLayer, &m_BaseAccumulator });
+            b_BaseAdded = true;
+        }
+        stack.push_back({ layer.map.get(), &layer.options, &layer.accumulator });
+    }
+
+    if (!b_BaseAdded)
+    {
+        stack.push_back({ m_CurrentMap.get(), &m_BaseLayer, &m_BaseAccumulator });
+    }
+    return stack;
+}
+
+bool MapManager::b_IsCurrentMap(const std::string& map_id) const
+{
+    return m_CurrentMapId == map_id &&
+           m_CurrentMap != nullptr;
+}
+
+std::vector<std::string> MapManager::GetAvailableMaps() const
+{
+    std::vector<std::string> maps;
+    maps.reserve(m_MapRegistry.size());
+    
+    for (const auto& pair : m_MapRegistry)
+    {
+        maps.push_back(pair.first);
+    }
+    
+    return maps;
+}
+
+bool MapManager::b_IsMapRegistered(const std::string& map_id) const
+{
+    return m_MapRegistry.find(map_id) != m_MapRegistry.end();
+}
+
+void MapManager::UnloadCurrentMap()
+{
+    if (m_CurrentMap)
+    {
+        RW_LOG_INFO("MapManager", "Unloading map: '{}'", m_CurrentMapId);
+        
+        // Mark as not loaded in metadata
+        if (m_MapInfo.find(m_CurrentMapId) != m_MapInfo.end())
+        {
+            m_MapInfo[m_CurrentMapId].b_IsLoaded = false;
+        }
+        
+        m_Pending.reset();
+        m_CurrentMap.reset();
+        m_Snapshot.Clear();
+        m_CurrentMapId = "";
+        m_bUsingDefaultMap = false;
+    }
+    else
+    {
+        RW_LOG_INFO("MapManager", "No map to unload");
+    }
+}
+
+bool MapManager::b_ReloadCurrentMap()
+{
+    if (m_CurrentMapId.empty())
+    {
+        RW_LOG_INFO("MapManager", "No current map to reload");
+        return false;
+    }
+    
+    std::string map_to_reload = m_CurrentMapId;
+    RW_LOG_INFO("MapManager", "Reloading map: '{}'", map_to_reload);
+    
+    return b_GotoMap(map_to_reload, true);
+}
+
+bool MapManager::b_RestartCurrentMap()
+{
+    if (!m_CurrentMap || m_Snapshot.b_IsEmpty())
+    {
+        return b_ReloadCurrentMap();
+    }
+
+    // A restart also cancels a transition the session had started
+    m_Pending.reset();
+
+    const auto START = std::chrono::steady_clock::now();
+
+    m_Snapshot.BeginRead();
+    if (!m_CurrentMap->b_RestoreSnapshot(m_Snapshot) || !m_Snapshot.b_IsFullyRead())
+    {
+        RW_LOG_WARNING("MapManager", "Snapshot restore failed for '{}', reloading", m_CurrentMapId);
+        return b_ReloadCurrentMap();
+    }
+
+    // Fresh layer instances: their own state is not part of the snapshot.
+    // Destroyed layers may stage requests, which the start stack replaces.
+    m_Layers.clear();
+    m_LayerRequests = m_StartLayers;
+    ApplyLayerRequests();
+    m_BaseLayer = { .order = c_LAYER_BASE_ORDER };
+    m_BaseAccumulator = 0.0f;
+
+    const double RESTORE_US = std::chrono::duration<double, std::micro>
+    (
+        std::chrono::steady_clock::now() - START
+    ).count();
+
+    RW_LOG_INFO
+    (
+        "MapManager",
+        "Restarted '{}' from snapshot ({} bytes) in {} us",
+        m_CurrentMapId,
+        m_Snapshot.GetSize(),
+        static_cast<int>(RESTORE_US)
+    );
+
+    UpdatePrefetchSet();
+    return true;
+}
+
+void MapManager::CaptureSnapshot()
+{
+    m_Snapshot.Clear();
+    if (!m_CurrentMap || !m_CurrentMap->b_SaveSnapshot(m_Snapshot))
+    {
+        m_Snapshot.Clear();
+    }
+    RecordStartLayers();
+}
+
+void MapManager::RecordStartLayers()
+{
+    m_StartLayers.clear();
+    for (const t_MapLayer& LAYER : m_Layers)
+    {
+        m_StartLayers.push_back({ true, LAYER.map_id, LAYER.options });
+    }
+
+    // Same rules as ApplyLayerRequests: a push of a running layer is ignored
+    for (const t_LayerRequest& REQUEST : m_LayerRequests)
+    {
+        auto it = std::find_if
+        (
+            m_StartLayers.begin(),
+            m_StartLayers.end(),
+            [&](const t_LayerRequest& layer) { return layer.map_id == REQUEST.map_id; }
+        );
+        if (REQUEST.b_Push && it == m_StartLayers.end())
+        {
+            m_StartLayers.push_back(REQUEST);
+        }
+        else if (!REQUEST.b_Push && it != m_StartLayers.end())
+        {
+            m_StartLayers.erase(it);
+        }
+    }
+}
+
+void MapManager::SaveReloadState(MapSnapshot& out) const
+{
+    WriteReloadState(out, nullptr);
+}
+
+void MapManager::WriteReloadState(MapSnapshot& out, const std::string* module) const
+{
+    auto b_Included = [&](const std::string& map_id)
+    {
+        return !module || GetMapModule(map_id) == *module;
+    };
+
+    const bool b_HasMap = m_CurrentMap && !m_bUsingDefaultMap && b_Included(m_CurrentMapId);
+
+    out.Clear();
+    out.Write(c_RELOAD_STATE_VERSION);
+    out.WriteString(b_HasMap ? m_CurrentMapId : std::string());
+    if (b_HasMap)
+    {
+        out.Write(m_BaseLayer);
+        s_fWriteMapState(out, *m_CurrentMap);
+    }
+
+    const size_t LAYER_COUNT = static_cast<size_t>
+    (
+        std::count_if
+        (
+            m_Layers.begin(),
+            m_Layers.end(),
+            [&](const t_MapLayer& layer) { return b_Included(layer.map_id); }
+        )
+    );
+    out.Write(LAYER_COUNT);
+    for (const t_MapLayer& LAYER : m_Layers)
+    {
+        if (!b_Included(LAYER.map_id))
+        {
+            continue;
+        }
+        out.WriteString(LAYER.map_id);
+        out.Write(LAYER.options);
+        out.Write(LAYER.accumulator);
+        s_fWriteMapState(out, *LAYER.map);
+    }
+}
+
+const std::string& MapManager::GetMapModule(const std::string& map_id) const
+{
+    static const std::string c_MAIN_MODULE;
+
+    auto info = m_MapInfo.find(map_id);
+    return info != m_MapInfo.end() ? info->second.module : c_MAIN_MODULE;
+}
+
+std::vector<std::string> MapManager::GetModuleMaps(const std::string& module) const
+{
+    std::vector<std::string> maps;
+    for (const auto& [MAP_ID, INFO] : m_MapInfo)
+    {
+        if (INFO.module == module && b_IsMapRegistered(MAP_ID))
+        {
+            maps.push_back(MAP_ID);
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+    return maps;
+}
+
+void MapManager::DetachModule(const std::string& module, MapSnapshot& out)
+{
+    auto b_Owned = [&](const std::string& map_id) { return GetMapModule(map_id) == module; };
+
+    WriteReloadState(out, &module);
+
+    // A staged switch into the module would finish with the old factory;
+    // the future waits for it to return
+    if (m_Pending && b_Owned(m_Pending->map_id))
+    {
+        m_Pending.reset();
+    }
+
+    // Destructors stage layer removals (a level dropping its HUD); the
+    // session goes on, so those are discarded below
+    const size_t REQUEST_COUNT = m_LayerRequests.size();
+
+    size_t destroyed = std::erase_if
+    (
+        m_SuspendedMaps,
+        [&](const t_SuspendedMap& suspended) { return b_Owned(suspended.map_id); }
+    );
+    destroyed += std::erase_if
+    (
+        m_Layers,
+        [&](const t_MapLayer& layer) { return b_Owned(layer.map_id); }
+    );
+
+    // Restoring goes through b_GotoMap, which needs the id cleared
+    if (m_CurrentMap && b_Owned(m_CurrentMapId))
+    {
+        m_CurrentMap.reset();
+        m_Snapshot.Clear();
+        m_CurrentMapId.clear();
+        ++destroyed;
+    }
+
+    m_LayerRequests.resize((std::min)(REQUEST_COUNT, m_LayerRequests.size()));
+
+    const std::vector<std::string> MAPS = GetModuleMaps(module);
+    for (const std::string& MAP_ID : MAPS)
+    {
+        m_MapRegistry.erase(MAP_ID);
+        m_MapInfo.erase(MAP_ID);
+    }
+
+    RW_LOG_INFO
+    (
+        "MapManager",
+        "Detached module '{}': {} maps unregistered, {} instances destroyed ({} bytes of state kept)",
+        module,
+        MAPS.size(),
+        destroyed,
+        out.GetSize()
+    );
+
+    UpdatePrefetchSet();
+}
+
+bool MapManager::b_RestoreReloadState(MapSnapshot& in)
+{
+    const auto START = std::chrono::steady_clock::now();
+
+    uint32_t format_version = 0;
+    std::string map_id;
+    in.BeginRead();
+    if (!in.b_Read(format_version) || format_version != c_RELOAD_STATE_VERSION || !in.b_ReadString(map_id))
+    {
+        RW_LOG_WARNING("MapManager", "Reload state has an unknown layout, starting fresh");
+        return false;
+    }
+
+    int restored = 0;
+    int saved = 0;
+    uint32_t version = 0;
+    MapSnapshot state;
+
+    if (!map_id.empty())
+    {
+        t_LayerOptions base_options;
+        if (!in.b_Read(base_options) || !in.b_Read(version) || !in.b_ReadSnapshot(state))
+        {
+            return false;
+        }
+
+        if (b_IsMapRegistered(map_id) && (map_id == m_CurrentMapId || b_GotoMap(map_id)))
+        {
+            ++saved;
+            const MapRestore RESULT = s_fRestoreMapState(*m_CurrentMap, version, state);
+            if (RESULT == MapRestore::Failed)
+            {
+                b_GotoMap(map_id, true);
+            }
+            restored += RESULT == MapRestore::Restored;
+            m_BaseLayer = base_options;
+        }
+    }
+
+    // Layers the restored map asked for in Initialize exist before reconciling
+    ApplyLayerRequests();
+
+    size_t layer_count = 0;
+    if (!in.b_Read(layer_count))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < layer_count; ++i)
+    {
+        t_LayerOptions options;
+        float accumulator = 0.0f;
+        if
+        (
+            !in.b_ReadString(map_id) || !in.b_Read(options) || !in.b_Read(accumulator) ||
+            !in.b_Read(version) || !in.b_ReadSnapshot(state)
+        )
+        {
+            return false;
+        }
+
+        if (!b_IsMapRegistered(map_id) || (!b_HasLayer(map_id) && !b_PushLayer(map_id, options)))
+        {
+            continue;
+        }
+
+        ++saved;
+        const MapRestore RESULT = s_fRestoreMapState(*GetLayer(map_id), version, state);
+        if (RESULT == MapRestore::Failed)
+        {
+            b_RemoveLayer(map_id);
+            b_PushLayer(map_id, options);
+        }
+        restored += RESULT == MapRestore::Restored;
+
+        for (t_MapLayer& layer : m_Layers)
+        {
+            if (layer.map_id == map_id)
+            {
+                layer.options = options;
+                layer.accumulator = accumulator;
+            }
+        }
+    }
+
+    // Restored options may carry a different order than the layer was pushed with
+    std::stable_sort
+    (
+        m_Layers.begin(),
+        m_Layers.end(),
+        [](const t_MapLayer& a, const t_MapLayer& b) { return a.options.order < b.options.order; }
+    );
+
+    const double RESTORE_US = std::chrono::duration<double, std::micro>
+    (
+        std::chrono::steady_clock::now() - START
+    ).count();
+
+    RW_LOG_INFO
+    (
+        "MapManager",
+        "Reload state: restored {} of {} maps ({} bytes) in {} us",
+        restored,
+        saved,
+        in.GetSize(),
+        static_cast<int>(RESTORE_US)
+    );
+
+    UpdatePrefetchSet();
+    return true;
+}
+
+std::string MapManager::GetDebugInfo() const
+{
+    std::stringstream ss;
+    ss << "=== MapManager Debug Info ===\n";
+
+    ss << "Current Map: " 
+       << ( m_CurrentMapId.empty() ? "None" : m_CurrentMapId) 
+       << "\n";
+
+    ss << "Using Default Map: " 
+       << (m_bUsingDefaultMap ? "Yes" : "No") 
+       << "\n";
+
+    ss << "Pending Transition: " 
+       << (m_Pending ? m_Pending->map_id : "None") 
+       << "\n";
+
+    ss << "Layers (" << m_Layers.size() << "):";
+    for (const t_MapLayer& LAYER : m_Layers)
+    {
+        ss << " '" << LAYER.map_id << "'@" << LAYER.options.order
+           << (LAYER.options.b_Paused ? " [PAUSED]" : "")
+           << (LAYER.options.b_Visible ? "" : " [HIDDEN]");
+    }
+    ss << "\n";
+
+    ss << "Restart Snapshot: " 
+       << (m_Snapshot.b_IsEmpty() ? "None" : std::to_string(m_Snapshot.GetSize()) + " bytes") 
+       << "\n";
+
+    ss << "Registered Maps (" << m_MapRegistry.size() << "):";
+    
+    for (const auto& pair : m_MapInfo)
+    {
+        const std::string& MAP_ID = pair.first;
+        const t_MapInfo& INFO = pair.second;
+        ss << "\n  - '" << MAP_ID << "': " << INFO.description;
+        if (b_IsMapSuspended(MAP_ID))
+        {
+            ss << " [SUSPENDED]";
+        }
+        else
+        {
+            ss << " [" << (INFO.b_IsLoaded ? "LOADED" : "NOT LOADED") << "]";
+        }
+    }
+    
+    if (m_MapRegistry.empty())
+    {
+        ss << "\n  (No maps registered - call RegisterMap<YourMap>() to register maps)";
+    }
+    
+    return ss.str();
+}
+
+void MapManager::PreloadMap(const std::string& map_id)
+{
+    if (!b_IsMapRegistered(map_id))
+    {
+        RW_LOG_ERROR("MapManager", "Cannot preload unregistered map: '{}'", map_id);
+        return;
+    }
+
+    if (map_id == m_CurrentMapId ||
+        std::find(m_PreloadRequests.begin(), m_PreloadRequests.end(), map_id) != m_PreloadRequests.end())
+    {
+        return;
+    }
+
+    m_PreloadRequests.push_back(map_id);
+    UpdatePrefetchSet();
+}
+
+std::vector<std::string> MapManager::GetLikelyNextMaps(const std::string& map_id) const
+{
+    std::vector<std::string> maps;
+    auto info = m_MapInfo.find(map_id);
+    if (info == m_MapInfo.end())
+    {
+        return maps;
+    }
+
+    auto add = [&](const std::string& next)
+    {
+        if (next != map_id && b_IsMapRegistered(next) &&
+            std::find(maps.begin(), maps.end(), next) == maps.end())
+        {
+            maps.push_back(next);
+        }
+    };
+
+    for (const std::string& NEXT : info->second.manifest.next_maps)
+    {
+        add(NEXT);
+    }
+
+    std::vector<std::pair<std::string, int>> learned
+    (
+        info->second.transitions.begin(),
+        info->second.transitions.end()
+    );
+    std::sort
+    (
+        learned.begin(),
+        learned.end(),
+        [](const auto& a, const auto& b) { return a.second > b.second; }
+    );
+    for (const auto& [NEXT, COUNT] : learned)
+    {
+        add(NEXT);
+    }
+
+    if (maps.size() > c_MAX_PREDICTED_MAPS)
+    {
+        maps.resize(c_MAX_PREDICTED_MAPS);
+    }
+    return maps;
+}
+
+void MapManager::UpdatePrefetchSet()
+{
+    // Before injection (e.g. inside CreateGameMap) there is nothing to feed
+    if (!m_AssetManager)
+    {
+        return;
+    }
+
+    std::vector<std::string> maps = m_PreloadRequests;
+    for (const std::string& NEXT : GetLikelyNextMaps(m_CurrentMapId))
+    {
+        if (std::find(maps.begin(), maps.end(), NEXT) == maps.end())
+        {
+            maps.push_back(NEXT);
+        }
+    }
+
+    // While a transition is staged, only its map is worth decoding
+    if (m_Pending)
+    {
+        maps = { m_Pending->map_id };
+    }
+
+    std::vector<std::string> assets;
+    for (const std::string& MAP_ID : maps)
+    {
+        // A suspended instance still holds everything it loaded
+        if (b_IsMapSuspended(MAP_ID))
+        {
+            continue;
+        }
+
+        const t_MapManifest& MANIFEST = m_MapInfo[MAP_ID].manifest;
+        assets.insert(assets.end(), MANIFEST.assets.begin(), MANIFEST.assets.end());
+    }
+
+    m_AssetManager->SetPrefetchSet(assets);
 }
 
 void MapManager::LoadDefaultMap()
 {
-    std::cout << "[MapManager] No default map available in Engine library" 
-              << "\n";
+    RW_LOG_INFO("MapManager", "No default map available in Engine library");
 
-    std::cout << "[MapManager] Register and load your own maps using RegisterMap<YourMap>()" 
-              << "\n";
+    RW_LOG_INFO("MapManager", "Register and load your own maps using RegisterMap<YourMap>()");
 }
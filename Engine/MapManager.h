@@ -1,11 +1,42 @@
 #pragma once
 #include "GameMap.h"
+#include "Logger.h"
+#include <chrono>
 #include <functional>
+#include <future>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 #include <sstream>
 
+// How many predicted next maps get their assets prefetched at once
+constexpr size_t c_MAX_PREDICTED_MAPS = 2;
+
+// Suspended map instances kept by default (0 = destroy on every switch)
+constexpr size_t c_DEFAULT_SUSPENDED_MAPS = 0;
+
+// Quick transitions finish before the loading overlay would flash up
+constexpr float c_LOADING_OVERLAY_DELAY = 0.15f;
+
+// Layout of the buffer SaveReloadState writes; bump when it changes
+constexpr uint32_t c_RELOAD_STATE_VERSION = 1;
+
+// Assets a map loads in Initialize, and the maps usually entered from it
+struct t_MapManifest
+{
+    std::vector<std::string> assets{};
+    std::vector<std::string> next_maps{};
+};
+
+// One running map's GameMap::GetEntityCount
+struct t_MapEntityCount
+{
+    std::string map_id;
+    size_t count = 0;
+    bool b_Layer = false;
+};
+
 /**
  * @brief Developer-friendly MapManager for easy game map management
  * 
@@ -19,14 +50,40 @@
  * @code
  * // In your map registration (usually in Initialize):
  * manager.RegisterMap<YourMapClass>("map_id");
+ *
+ * // With a manifest, the assets of likely next maps are decoded in the
+ * // background while this map runs, so switching to them is instant
+ * manager.RegisterMap<Menu>("menu", "Main menu",
+ *     { .assets = { "Assets/menu.png" }, .next_maps = { "level" } });
+ * manager.PreloadMap("level");
  * 
  * // Switch maps anywhere in your code:
  * manager.b_GotoMap("map_id");
+ *
+ * // Or stage the switch: the map is built on a background job while its
+ * // manifest assets are prefetched, then swapped in at the next frame
+ * // boundary. Maps calling RequestGotoMap() always go through this path.
+ * manager.b_BeginGotoMap("map_id");
+ *
+ * // Keep the two most recently left maps alive; going back to one calls
+ * // its OnResume() instead of constructing and initializing a new one
+ * manager.SetSuspendLimit(2);
+ *
+ * // Run a 10 Hz HUD above whatever map is current, and a pause menu
+ * // that takes the input and freezes everything beneath it
+ * manager.b_PushLayer("hud", { .order = 100, .tick_rate = 10.0f });
+ * manager.b_PushLayer("pause", { .order = 200, .b_ConsumesInput = true, .b_PausesBelow = true });
  * 
  * // Check current map:
  * if (manager.b_IsCurrentMap("map_id")) {
  *     // Do something specific to that map
  * }
+ *
+ * // Maps registered between these calls belong to the "levels" logic
+ * // module, which can then be hot-reloaded without touching the others
+ * manager.BeginModule("levels");
+ * manager.RegisterMap<Level1>("level1");
+ * manager.EndModule();
  * @endcode
  */
 class MapManager : public GameMap
@@ -45,11 +102,89 @@ private:
     {
         std::string description;
         bool b_IsLoaded = false;
+        t_MapManifest manifest;
+
+        // Observed transitions out of this map, by destination
+        std::unordered_map<std::string, int> transitions;
+
+        // Logic module that registered the map ("" = the main GameLogic)
+        std::string module;
     };
 
     std::unordered_map<std::string, t_MapInfo> m_MapInfo;
     bool m_bUsingDefaultMap;
 
+    // Module RegisterMap currently tags maps with (see BeginModule)
+    std::string m_RegisteringModule;
+
+    // Maps explicitly requested through PreloadMap, until entered
+    std::vector<std::string> m_PreloadRequests;
+
+    // Transition being prepared in the background (see b_BeginGotoMap)
+    struct t_PendingTransition
+    {
+        std::string map_id;
+        std::future<std::unique_ptr<GameMap>> map;
+        std::chrono::steady_clock::time_point start;
+        std::vector<std::string> assets;    // manifest prefetched for it
+        size_t asset_count = 0;
+        bool b_Resume = false;      // suspended instance, nothing to prepare
+    };
+
+    std::optional<t_PendingTransition> m_Pending;
+    bool m_bShowLoadingOverlay = true;
+
+    // Maps left recently, least recently used first
+    struct t_SuspendedMap
+    {
+        std::string map_id;
+        std::unique_ptr<GameMap> map;
+        MapSnapshot snapshot;       // kept so Restart stays instant after resume
+    };
+
+    std::vector<t_SuspendedMap> m_SuspendedMaps;
+    size_t m_SuspendLimit = c_DEFAULT_SUSPENDED_MAPS;
+
+    // Gameplay state of the current map right after its Initialize
+    MapSnapshot m_Snapshot;
+
+    // Maps stacked around the current one, sorted by order (stable)
+    struct t_MapLayer
+    {
+        std::string map_id;
+        std::unique_ptr<GameMap> map;
+        t_LayerOptions options;
+        float accumulator = 0.0f;   // time since the last tick (tick_rate > 0)
+    };
+
+    std::vector<t_MapLayer> m_Layers;
+
+    // Layer settings of the current map, reset whenever it changes
+    t_LayerOptions m_BaseLayer{ .order = c_LAYER_BASE_ORDER };
+    float m_BaseAccumulator = 0.0f;
+
+    // Requests made by maps during Update, applied at the next frame start
+    struct t_LayerRequest
+    {
+        bool b_Push = true;
+        std::string map_id;
+        t_LayerOptions options;
+    };
+
+    std::vector<t_LayerRequest> m_LayerRequests;
+
+    // Layers the current map started with (as pushes), which a restart
+    // recreates in place of whatever is stacked by then
+    std::vector<t_LayerRequest> m_StartLayers;
+
+    // One entry of the combined draw/update order (current map included)
+    struct t_LayerView
+    {
+        GameMap* map = nullptr;
+        t_LayerOptions* options = nullptr;
+        float* accumulator = nullptr;
+    };
+
 public:
     MapManager();
     ~MapManager() override;
@@ -65,6 +200,15 @@ public:
     void Initialize() override;
     void Update(float delta_time) override;
     void Draw() override;
+
+    // The two halves of Update. ApplyPendingChanges completes a staged
+    // transition and layer requests, which initializes maps and so needs
+    // the render thread; UpdateLayers only runs the maps' Update.
+    void ApplyPendingChanges();
+    void UpdateLayers(float delta_time);
+
+    // Sum over the current map and its layers
+    size_t GetEntityCount() const override;
     
     void SetSceneBounds(float width, float height);
     Vector2 GetSceneBounds() const;
@@ -73,23 +217,139 @@ public:
     void RegisterMap
     (
         const std::string& map_id, 
-        const std::string& description = ""
+        const std::string& description = "",
+        const t_MapManifest& manifest = {}
     );
     bool b_GotoMap(const std::string& map_id, bool force_reload = false);
+
+    // Staged switch: returns once preparation has started; the map is swapped
+    // in at the start of the first Update after it and its assets are ready
+    bool b_BeginGotoMap(const std::string& map_id, bool force_reload = false);
+    bool b_IsTransitionPending() const { return m_Pending.has_value(); }
+    void SetLoadingOverlay(bool b_Enabled) { m_bShowLoadingOverlay = b_Enabled; }
+
+    // How many left maps stay alive for instant resume; extras are destroyed
+    void SetSuspendLimit(size_t max_maps);
+    size_t GetSuspendLimit() const { return m_SuspendLimit; }
+    bool b_IsMapSuspended(const std::string& map_id) const;
+    void ClearSuspendedMaps();
+
+    // Layers: registered maps that run alongside the current map, each with
+    // its own tick rate, pause/visibility flags and place in the input
+    // order. They get their own instance and survive map switches.
+    bool b_PushLayer(const std::string& map_id, const t_LayerOptions& options = {});
+    bool b_RemoveLayer(const std::string& map_id);
+    bool b_HasLayer(const std::string& map_id) const;
+    GameMap* GetLayer(const std::string& map_id) const;
+    std::vector<std::string> GetLayerIds() const;
+
+    // Also accept the current map's id, which is the layer at c_LAYER_BASE_ORDER
+    void SetLayerPaused(const std::string& map_id, bool b_Paused);
+    void SetLayerVisible(const std::string& map_id, bool b_Visible);
+    void SetLayerTickRate(const std::string& map_id, float tick_rate);
+
     bool b_IsCurrentMap(const std::string& map_id) const;
     bool b_IsMapRegistered(const std::string& map_id) const;
     bool b_ReloadCurrentMap();
 
+    // Puts the current map back into its just-initialized state from the
+    // snapshot taken after Initialize: no factory call, no asset loads.
+    // Layers are rebuilt as the map started with them, so an open pause
+    // menu closes and a HUD starts over. Maps without snapshot support, or
+    // a failed restore, are reloaded.
+    bool b_RestartCurrentMap();
+    bool b_HasSnapshot() const { return !m_Snapshot.b_IsEmpty(); }
+
+    // GameLogic hot reload. The outgoing manager writes its current map,
+    // layers and their snapshots; the incoming one (after Initialize)
+    // recreates them and restores each snapshot whose version still
+    // matches. Maps that cannot restore start fresh. Suspended maps are
+    // not carried over.
+    void SaveReloadState(MapSnapshot& out) const;
+    bool b_RestoreReloadState(MapSnapshot& in);
+
+    // Logic modules: libraries besides GameLogic that register their own
+    // maps into this manager and are rebuilt and reloaded on their own.
+    // Maps registered between BeginModule and EndModule belong to it.
+    void BeginModule(const std::string& module) { m_RegisteringModule = module; }
+    void EndModule() { m_RegisteringModule.clear(); }
+    const std::string& GetMapModule(const std::string& map_id) const;
+    std::vector<std::string> GetModuleMaps(const std::string& module) const;
+
+    // Before a module is unloaded: writes the state of its running maps in
+    // the SaveReloadState layout, then destroys every instance of them
+    // (current, layers, suspended, staged) and drops their registrations,
+    // so no code of the module is referenced anymore. Maps of other modules
+    // keep running. Once the rebuilt module has registered again,
+    // b_RestoreReloadState brings its maps back.
+    void DetachModule(const std::string& module, MapSnapshot& out);
+
     const std::string& GetCurrentMapId() const { return m_CurrentMapId; }
     std::vector<std::string> GetAvailableMaps() const;
 
+    // Starts decoding the map's manifest assets in the background
+    void PreloadMap(const std::string& map_id);
+
+    // Manifest next_maps first, then learned transitions by frequency
+    std::vector<std::string> GetLikelyNextMaps(const std::string& map_id) const;
+
     void UnloadCurrentMap();
     std::string GetDebugInfo() const;
 
+    // Current map first, then layers in draw order
+    std::vector<t_MapEntityCount> GetEntityCounts() const;
+
+    // Restart and suspended-map snapshots held in memory
+    size_t GetSnapshotBytes() const;
+
     
 private:
 
     void LoadDefaultMap();
+
+    // Scene bounds, services and the transition/layer callbacks
+    void InjectServices(GameMap& map);
+
+    // Makes new_map current: injects services, then runs Initialize, or
+    // OnResume for an instance taken from the suspended set
+    void ActivateMap
+    (
+        const std::string& map_id, 
+        std::unique_ptr<GameMap> new_map, 
+        bool b_Resumed = false
+    );
+
+    // Parks the current map in the LRU set, or destroys it
+    void ReleaseCurrentMap(const std::string& next_map_id);
+    std::unique_ptr<GameMap> TakeSuspendedMap
+    (
+        const std::string& map_id, 
+        MapSnapshot* out_snapshot = nullptr
+    );
+    void TrimSuspendedMaps(size_t max_maps);
+
+    bool b_IsPendingReady() const;
+    void CompletePendingTransition();
+    void DrawLoadingOverlay() const;
+
+    // Hands the assets of preloaded and predicted maps to the AssetManager
+    void UpdatePrefetchSet();
+
+    // Replaces m_Snapshot with the current map's state (empty if unsupported)
+    void CaptureSnapshot();
+
+    // Records m_StartLayers: the stack once the staged requests are applied
+    void RecordStartLayers();
+
+    // SaveReloadState, limited to one module's maps unless module is null
+    void WriteReloadState(MapSnapshot& out, const std::string* module) const;
+
+    void ApplyLayerRequests();
+    t_LayerOptions* FindLayerOptions(const std::string& map_id);
+
+    // Current map and layers, lowest order first
+    std::vector<t_LayerView> GetLayerStack();
+    static void TickLayer(const t_LayerView& layer, float delta_time);
 };
 
 /*
@@ -102,7 +362,8 @@ template<typename T>
 void MapManager::RegisterMap
 (
     const std::string& map_id, 
-    const std::string& description
+    const std::string& description,
+    const t_MapManifest& manifest
 )
 {
     static_assert
@@ -120,14 +381,10 @@ void MapManager::RegisterMap
     // Store metadata
     m_MapInfo[map_id] = 
     { 
-        description.empty() ? "No description" : description, false 
+        description.empty() ? "No description" : description, false, manifest, {}, m_RegisteringModule
     };
     
-    std::cout << "[MapManager] Registered map: '" 
-              << map_id 
-              << "' - " 
-              << description 
-              << std::endl;
+    RW_LOG_DEBUG("MapManager", "Registered map: '{}' - {}", map_id, description);
 }
 /*
 +----------------------------------------------------------------+
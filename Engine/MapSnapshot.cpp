@@ -0,0 +1,73 @@
+#include "MapSnapshot.h"
+#include <cstring>
+
+void MapSnapshot::Clear()
+{
+    m_Data.clear();
+    m_ReadOffset = 0;
+}
+
+void MapSnapshot::WriteString(std::string_view text)
+{
+    Write(text.size());
+    WriteBytes(text.data(), text.size());
+}
+
+bool MapSnapshot::b_ReadString(std::string& out)
+{
+    size_t length = 0;
+    if (!b_Read(length) || length > m_Data.size() - m_ReadOffset)
+    {
+        return false;
+    }
+
+    out.resize(length);
+    return b_ReadBytes(out.data(), length);
+}
+
+void MapSnapshot::WriteSnapshot(const MapSnapshot& nested)
+{
+    Write(nested.m_Data.size());
+    WriteBytes(nested.m_Data.data(), nested.m_Data.size());
+}
+
+bool MapSnapshot::b_ReadSnapshot(MapSnapshot& out)
+{
+    size_t length = 0;
+    if (!b_Read(length) || length > m_Data.size() - m_ReadOffset)
+    {
+        return false;
+    }
+
+    const auto BEGIN = m_Data.begin() + static_cast<std::ptrdiff_t>(m_ReadOffset);
+    out.m_Data.assign(BEGIN, BEGIN + static_cast<std::ptrdiff_t>(length));
+    out.m_ReadOffset = 0;
+    m_ReadOffset += length;
+    return true;
+}
+
+void MapSnapshot::WriteBytes(const void* data, size_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    const auto* BYTES = static_cast<const unsigned char*>(data);
+    m_Data.insert(m_Data.end(), BYTES, BYTES + size);
+}
+
+bool MapSnapshot::b_ReadBytes(void* out, size_t size)
+{
+    if (size > m_Data.size() - m_ReadOffset)
+    {
+        return false;
+    }
+
+    if (size > 0)
+    {
+        std::memcpy(out, m_Data.data() + m_ReadOffset, size);
+        m_ReadOffset += size;
+    }
+    return true;
+}
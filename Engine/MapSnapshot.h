@@ -0,0 +1,137 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Compact in-memory blob of a map's gameplay state
+ *
+ * Maps write their gameplay state (positions, timers, flags, counters)
+ * in b_SaveSnapshot and read it back in the same order in
+ * b_RestoreSnapshot. Only trivially copyable values go in as raw bytes;
+ * asset handles should not be written at all, since a restore runs on
+ * the same instance with its assets still loaded.
+ *
+ * Reads are bounds-checked: a b_Read* past the end returns false and
+ * the map should give up, which makes MapManager fall back to a full
+ * reload.
+ *
+ * Snapshots nest (WriteSnapshot / b_ReadSnapshot), which is how
+ * MapManager bundles every running map into one hot-reload buffer.
+ *
+ * Example Usage:
+ * @code
+ * bool b_SaveSnapshot(MapSnapshot& out) const override
+ * {
+ *     out.Write(m_Score);
+ *     out.WriteVector(m_Pickups);
+ *     return true;
+ * }
+ *
+ * bool b_RestoreSnapshot(MapSnapshot& in) override
+ * {
+ *     return in.b_Read(m_Score) && in.b_ReadVector(m_Pickups);
+ * }
+ * @endcode
+ */
+class MapSnapshot
+{
+public:
+    void Clear();
+    bool b_IsEmpty() const { return m_Data.empty(); }
+    size_t GetSize() const { return m_Data.size(); }
+
+    template<typename T>
+    void Write(const T& value);
+
+    template<typename T>
+    void WriteVector(const std::vector<T>& values);
+
+    void WriteString(std::string_view text);
+
+    // Length-prefixed copy of another snapshot's bytes
+    void WriteSnapshot(const MapSnapshot& nested);
+
+    // Rewinds reading to the start of the blob
+    void BeginRead() { m_ReadOffset = 0; }
+    bool b_IsFullyRead() const { return m_ReadOffset == m_Data.size(); }
+
+    template<typename T>
+    bool b_Read(T& out);
+
+    template<typename T>
+    bool b_ReadVector(std::vector<T>& out);
+
+    bool b_ReadString(std::string& out);
+
+    // Replaces out with the next nested snapshot, ready to read
+    bool b_ReadSnapshot(MapSnapshot& out);
+
+private:
+    void WriteBytes(const void* data, size_t size);
+    bool b_ReadBytes(void* out, size_t size);
+
+    std::vector<unsigned char> m_Data;
+    size_t m_ReadOffset = 0;
+};
+
+/*
++--------------------------------------------------------+
+|                   UTILITY TEMPLATES                    |
++--------------------------------------------------------+
+*/
+
+template<typename T>
+void MapSnapshot::Write(const T& value)
+{
+    static_assert
+    (
+        std::is_trivially_copyable_v<T>,
+        "Snapshot values must be trivially copyable"
+    );
+    WriteBytes(&value, sizeof(T));
+}
+
+template<typename T>
+void MapSnapshot::WriteVector(const std::vector<T>& values)
+{
+    static_assert
+    (
+        std::is_trivially_copyable_v<T>,
+        "Snapshot values must be trivially copyable"
+    );
+    Write(values.size());
+    WriteBytes(values.data(), values.size() * sizeof(T));
+}
+
+template<typename T>
+bool MapSnapshot::b_Read(T& out)
+{
+    static_assert
+    (
+        std::is_trivially_copyable_v<T>,
+        "Snapshot values must be trivially copyable"
+    );
+    return b_ReadBytes(&out, sizeof(T));
+}
+
+template<typename T>
+bool MapSnapshot::b_ReadVector(std::vector<T>& out)
+{
+    static_assert
+    (
+        std::is_trivially_copyable_v<T>,
+        "Snapshot values must be trivially copyable"
+    );
+
+    size_t count = 0;
+    if (!b_Read(count) || count > (m_Data.size() - m_ReadOffset) / sizeof(T))
+    {
+        return false;
+    }
+
+    out.resize(count);
+    return b_ReadBytes(out.data(), count * sizeof(T));
+}
@@ -0,0 +1,142 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
++--------------------------------------------------------+
+|                      MAPPED FILE                       |
++--------------------------------------------------------+
+*/
+
+static bool s_bfFail(std::string* out_error, const char* step, const std::string& path)
+{
+    if (out_error)
+    {
+        *out_error = std::string(step) + ": " + path;
+    }
+    return false;
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::b_Open(const std::string& path, std::string* out_error)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA
+    (
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return s_bfFail(out_error, "Failed to open", path);
+    }
+
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return s_bfFail(out_error, "Failed to stat", path);
+    }
+
+    HANDLE mapping = CreateFileMappingA
+    (
+        file, nullptr, PAGE_READONLY, 0, 0, nullptr
+    );
+    if (!mapping)
+    {
+        CloseHandle(file);
+        return s_bfFail(out_error, "Failed to map", path);
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return s_bfFail(out_error, "Failed to map view", path);
+    }
+
+    m_FileHandle = file;
+    m_MappingHandle = mapping;
+    m_pBase = static_cast<const unsigned char*>(view);
+    m_Size = static_cast<size_t>(file_size.QuadPart);
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return s_bfFail(out_error, "Failed to open", path);
+    }
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return s_bfFail(out_error, "Failed to stat", path);
+    }
+
+    void* view = mmap
+    (
+        nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0
+    );
+    if (view == MAP_FAILED)
+    {
+        close(fd);
+        return s_bfFail(out_error, "Failed to map", path);
+    }
+
+    // The mapping keeps the file alive; the descriptor is no longer needed
+    close(fd);
+    m_pBase = static_cast<const unsigned char*>(view);
+    m_Size = static_cast<size_t>(st.st_size);
+#endif
+
+    return true;
+}
+
+void MappedFile::Close()
+{
+#ifdef _WIN32
+    if (m_pBase)
+    {
+        UnmapViewOfFile(m_pBase);
+    }
+    if (m_MappingHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+    }
+    if (m_FileHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(m_FileHandle));
+    }
+#else
+    if (m_pBase)
+    {
+        munmap(const_cast<unsigned char*>(m_pBase), m_Size);
+    }
+#endif
+
+    m_pBase = nullptr;
+    m_Size = 0;
+    m_FileHandle = nullptr;
+    m_MappingHandle = nullptr;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <string>
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ *
+ * Shared by AssetPack and LevelFile. Pages are faulted in by the OS as
+ * they are touched, so opening costs the same for a 1 KB file as for a
+ * 1 GB one. The view stays valid until Close() or destruction.
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Fails for missing or empty files; out_error says which step failed
+    bool b_Open(const std::string& path, std::string* out_error = nullptr);
+    void Close();
+    bool b_IsOpen() const { return m_pBase != nullptr; }
+
+    const unsigned char* GetData() const { return m_pBase; }
+    size_t GetSize() const { return m_Size; }
+    std::span<const unsigned char> GetBytes() const { return { m_pBase, m_Size }; }
+
+private:
+    const unsigned char* m_pBase = nullptr;
+    size_t m_Size = 0;
+
+    // Platform mapping handles (Windows only; POSIX closes the fd after mmap)
+    void* m_FileHandle = nullptr;
+    void* m_MappingHandle = nullptr;
+};
@@ -0,0 +1,34 @@
+#include "RenderTaskQueue.h"
+
+void RenderTaskQueue::SetRenderThread(std::thread::id id)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_RenderThread = id;
+}
+
+bool RenderTaskQueue::b_IsRenderThread() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_RenderThread == std::thread::id() || m_RenderThread == std::this_thread::get_id();
+}
+
+size_t RenderTaskQueue::Pump()
+{
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        tasks.swap(m_Tasks);
+    }
+
+    for (std::function<void()>& task : tasks)
+    {
+        task();
+    }
+    return tasks.size();
+}
+
+void RenderTaskQueue::Post(std::function<void()> task)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Tasks.push_back(std::move(task));
+}
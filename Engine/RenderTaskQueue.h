@@ -0,0 +1,60 @@
+#pragma once
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Runs GPU work on the thread that owns the GL context
+ *
+ * raylib's GL context belongs to the thread that opened the window. Code
+ * that may run on another thread (the editor's simulation thread) wraps its
+ * texture and font loads in Run(): on the render thread the call runs
+ * inline, on any other it is queued and the caller blocks until the render
+ * thread calls Pump(). Until SetRenderThread() names a thread, every thread
+ * counts as the render thread and nothing is queued.
+ *
+ * Example Usage:
+ * @code
+ * Texture2D texture = m_RenderTasks.Run([&]() { return ::LoadTexture(path); });
+ *
+ * // Render thread, at least once per frame
+ * m_RenderTasks.Pump();
+ * @endcode
+ */
+class RenderTaskQueue
+{
+public:
+    // A default id turns queuing off again
+    void SetRenderThread(std::thread::id id);
+    bool b_IsRenderThread() const;
+
+    template <typename Func>
+    std::invoke_result_t<Func&> Run(Func&& func)
+    {
+        using Result = std::invoke_result_t<Func&>;
+        if (b_IsRenderThread())
+        {
+            return func();
+        }
+
+        // The caller waits, so func's captures stay valid until it ran
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+        std::future<Result> result = task->get_future();
+        Post([task]() { (*task)(); });
+        return result.get();
+    }
+
+    // Render thread: runs everything queued so far, returns how many ran
+    size_t Pump();
+
+private:
+    void Post(std::function<void()> task);
+
+    mutable std::mutex m_Mutex;
+    std::thread::id m_RenderThread;
+    std::vector<std::function<void()>> m_Tasks;
+};
@@ -0,0 +1,152 @@
+#include "StartupProfiler.h"
+#include "Logger.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+StartupProfiler::Scope::Scope(StartupProfiler* profiler, std::string_view name)
+{
+    if (profiler && profiler->b_IsActive())
+    {
+        m_pProfiler = profiler;
+        m_Index = profiler->BeginPhase(name);
+    }
+}
+
+StartupProfiler::Scope::Scope
+(
+    StartupProfiler* profiler,
+    std::string_view label,
+    std::string_view detail
+)
+{
+    if (profiler && profiler->b_IsActive())
+    {
+        std::string name(label);
+        name += ' ';
+        name += detail;
+
+        m_pProfiler = profiler;
+        m_Index = profiler->BeginPhase(name);
+    }
+}
+
+StartupProfiler::Scope::~Scope()
+{
+    if (m_pProfiler)
+    {
+        m_pProfiler->EndPhase(m_Index);
+    }
+}
+
+StartupProfiler::StartupProfiler()
+    : m_Start(Clock::now())
+{
+}
+
+double StartupProfiler::GetElapsedMs() const
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - m_Start).count();
+}
+
+size_t StartupProfiler::BeginPhase(std::string_view name)
+{
+    t_Phase phase;
+    phase.name = name;
+    phase.start_ms = GetElapsedMs();
+    phase.depth = m_Depth++;
+    m_Phases.push_back(std::move(phase));
+    return m_Phases.size() - 1;
+}
+
+void StartupProfiler::EndPhase(size_t index)
+{
+    // A scope opened before Finish() may close after it; keep its timing
+    if (index < m_Phases.size())
+    {
+        m_Phases[index].duration_ms = GetElapsedMs() - m_Phases[index].start_ms;
+    }
+    m_Depth = std::max(0, m_Depth - 1);
+}
+
+void StartupProfiler::Finish(const std::string& report_path, std::string_view target_name)
+{
+    if (m_bFinished)
+    {
+        return;
+    }
+
+    m_TotalMs = GetElapsedMs();
+    m_bFinished = true;
+
+    RW_LOG_INFO("Startup", "First frame presented after {:.1f} ms", m_TotalMs);
+
+    if (!b_WriteReport(report_path, target_name))
+    {
+        RW_LOG_WARNING("Startup", "Failed to write report: {}", report_path);
+    }
+}
+
+bool StartupProfiler::b_WriteReport
+(
+    const std::string& report_path,
+    std::string_view target_name
+) const
+{
+    std::ofstream out(report_path, std::ios::trunc);
+    if (!out.is_open())
+    {
+        return false;
+    }
+
+    out << "Startup report: " << target_name << "\n";
+    out << std::fixed << std::setprecision(2);
+    out << "Total (main to first presented frame): " << m_TotalMs << " ms\n\n";
+
+    out << std::setw(10) << "start ms" << std::setw(13) << "duration ms"
+        << std::setw(8) << "share" << "  phase\n";
+
+    double asset_ms = 0.0;
+    size_t asset_count = 0;
+    int asset_depth = -1;
+    for (const t_Phase& PHASE : m_Phases)
+    {
+        const double SHARE = m_TotalMs > 0.0 ? 100.0 * PHASE.duration_ms / m_TotalMs : 0.0;
+        out << std::setw(10) << PHASE.start_ms
+            << std::setw(13) << PHASE.duration_ms
+            << std::setw(7) << std::setprecision(1) << SHARE << "%"
+            << std::setprecision(2) << "  "
+            << std::string(static_cast<size_t>(PHASE.depth) * 2, ' ')
+            << PHASE.name << "\n";
+
+        // Count outermost asset loads only (LoadTexture may decode via LoadImage)
+        if (asset_depth >= 0 && PHASE.depth <= asset_depth)
+        {
+            asset_depth = -1;
+        }
+        if (asset_depth < 0 && PHASE.name.rfind("Load ", 0) == 0)
+        {
+            ++asset_count;
+            asset_ms += PHASE.duration_ms;
+            asset_depth = PHASE.depth;
+        }
+    }
+
+    // Top-level phases only, so nested time is not counted twice
+    auto slowest = std::max_element
+    (
+        m_Phases.begin(),
+        m_Phases.end(),
+        [](const t_Phase& a, const t_Phase& b)
+        {
+            return (a.depth == 0 ? a.duration_ms : -1.0) < (b.depth == 0 ? b.duration_ms : -1.0);
+        }
+    );
+
+    out << "\nAsset loads: " << asset_count << " (" << asset_ms << " ms)\n";
+    if (slowest != m_Phases.end())
+    {
+        out << "Dominant phase: " << slowest->name << " (" << slowest->duration_ms << " ms)\n";
+    }
+    return out.good();
+}
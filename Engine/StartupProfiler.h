@@ -0,0 +1,75 @@
+#pragma once
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Records how long each startup phase takes, up to the first frame
+ *
+ * Owned by GameEngine, so the clock starts when main() builds the engine.
+ * Phases nest (asset loads show up under "Map Initialize") and are timed
+ * with a scope object. Once Finish() runs after the first EndDrawing the
+ * profiler goes inactive and every later scope is a no-op.
+ *
+ * Example Usage:
+ * @code
+ * {
+ *     StartupProfiler::Scope phase(&profiler, "Config parse");
+ *     config.m_bLoadFromFile("config.ini");
+ * }
+ * @endcode
+ */
+class StartupProfiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct t_Phase
+    {
+        std::string name;
+        double start_ms = 0.0;
+        double duration_ms = 0.0;
+        int depth = 0;
+    };
+
+    class Scope
+    {
+    public:
+        Scope(StartupProfiler* profiler, std::string_view name);
+
+        // Name is "<label> <detail>", only built while the profiler is active
+        Scope(StartupProfiler* profiler, std::string_view label, std::string_view detail);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        StartupProfiler* m_pProfiler = nullptr;
+        size_t m_Index = 0;
+    };
+
+    StartupProfiler();
+
+    bool b_IsActive() const { return !m_bFinished; }
+
+    // Stops recording and writes the report; later calls do nothing
+    void Finish(const std::string& report_path, std::string_view target_name);
+
+    const std::vector<t_Phase>& GetPhases() const { return m_Phases; }
+    double GetTotalMs() const { return m_TotalMs; }
+
+private:
+    size_t BeginPhase(std::string_view name);
+    void EndPhase(size_t index);
+    double GetElapsedMs() const;
+
+    bool b_WriteReport(const std::string& report_path, std::string_view target_name) const;
+
+    Clock::time_point m_Start;
+    std::vector<t_Phase> m_Phases;
+    int m_Depth = 0;
+    bool m_bFinished = false;
+    double m_TotalMs = 0.0;
+};
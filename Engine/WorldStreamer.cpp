@@ -0,0 +1,551 @@
+#include "WorldStreamer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+WorldStreamer::~WorldStreamer()
+{
+    // The owning map is being destroyed, so no callbacks
+    StopWorker();
+    for (auto& [key, slot] : m_Chunks)
+    {
+        Deactivate(slot, false);
+    }
+
+    if (m_AssetManager && !m_PrefetchedTextures.empty())
+    {
+        m_AssetManager->SetPrefetchSet({}, GetPrefetchOwner());
+    }
+    EngineStats::Get().SetMemoryUsage("World chunks", 0);
+}
+
+void WorldStreamer::SetChunkSize(float chunk_size)
+{
+    Clear();
+    m_ChunkSize = std::max(1.0f, chunk_size);
+}
+
+void WorldStreamer::SetLoader(ChunkLoader loader)
+{
+    Clear();
+    m_Loader = std::move(loader);
+}
+
+void WorldStreamer::SetRadii(int active_radius, int prefetch_radius)
+{
+    m_ActiveRadius = std::max(0, active_radius);
+    m_PrefetchRadius = std::max(m_ActiveRadius, prefetch_radius);
+}
+
+void WorldStreamer::SetCallbacks(ChunkCallback on_activate, ChunkCallback on_deactivate)
+{
+    m_OnActivate = std::move(on_activate);
+    m_OnDeactivate = std::move(on_deactivate);
+}
+
+uint64_t WorldStreamer::ChunkKey(t_ChunkCoord coord)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(coord.x)) << 32) |
+           static_cast<uint32_t>(coord.y);
+}
+
+int WorldStreamer::Ring(t_ChunkCoord a, t_ChunkCoord b)
+{
+    return std::max(std::abs(a.x - b.x), std::abs(a.y - b.y));
+}
+
+size_t WorldStreamer::EstimateBytes(const t_WorldChunk& chunk)
+{
+    size_t bytes = sizeof(t_WorldChunk)
+        + chunk.tiles.size() * sizeof(t_ChunkTile)
+        + chunk.actors.size() * sizeof(t_ChunkActor);
+
+    for (const t_ChunkActor& ACTOR : chunk.actors)
+    {
+        bytes += ACTOR.type.capacity();
+    }
+    for (const std::string& PATH : chunk.textures)
+    {
+        bytes += sizeof(std::string) + PATH.capacity();
+    }
+    return bytes;
+}
+
+std::string WorldStreamer::GetPrefetchOwner() const
+{
+    // One AssetManager prefetch set per streamer
+    return "WorldStreamer:" + std::to_string(reinterpret_cast<uintptr_t>(this));
+}
+
+t_ChunkCoord WorldStreamer::WorldToChunk(Vector2 position) const
+{
+    return
+    {
+        static_cast<int32_t>(std::floor(position.x / m_ChunkSize)),
+        static_cast<int32_t>(std::floor(position.y / m_ChunkSize))
+    };
+}
+
+/*
++--------------------------------------------------------+
+|                    STREAMING THREAD                    |
++--------------------------------------------------------+
+*/
+
+void WorldStreamer::StreamWorker()
+{
+    std::unique_lock lock(m_Mutex);
+    while (true)
+    {
+        m_Cv.wait(lock, [this] { return m_bStop || !m_Queue.empty(); });
+        if (m_bStop)
+        {
+            return;
+        }
+
+        const t_ChunkCoord COORD = m_Queue.front();
+        m_Queue.pop_front();
+        m_LoadingKey = ChunkKey(COORD);
+
+        lock.unlock();
+        t_LoadedChunk loaded;
+        loaded.chunk.coord = COORD;
+        {
+            WorkerMeter::Scope busy(m_StreamMeter);
+            loaded.b_Loaded = m_Loader(COORD, loaded.chunk);
+        }
+        lock.lock();
+
+        m_Loaded.push_back(std::move(loaded));
+        m_LoadingKey.reset();
+        m_Cv.notify_all();
+    }
+}
+
+void WorldStreamer::StopWorker()
+{
+    {
+        std::lock_guard lock(m_Mutex);
+        m_bStop = true;
+    }
+    m_Cv.notify_all();
+
+    if (m_Thread.joinable())
+    {
+        m_Thread.join();
+    }
+
+    std::lock_guard lock(m_Mutex);
+    m_bStop = false;
+}
+
+void WorldStreamer::Enqueue(t_ChunkCoord coord)
+{
+    m_Requested.insert(ChunkKey(coord));
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Queue.push_back(coord);
+        if (!m_Thread.joinable())
+        {
+            m_Thread = std::thread(&WorldStreamer::StreamWorker, this);
+        }
+    }
+    m_Cv.notify_all();
+}
+
+void WorldStreamer::CollectLoaded()
+{
+    std::vector<t_LoadedChunk> loaded;
+    {
+        std::lock_guard lock(m_Mutex);
+        loaded.swap(m_Loaded);
+    }
+
+    for (t_LoadedChunk& chunk : loaded)
+    {
+        // Requests cancelled meanwhile are discarded
+        if (m_Requested.erase(ChunkKey(chunk.chunk.coord)) > 0)
+        {
+            Insert(std::move(chunk));
+        }
+    }
+}
+
+void WorldStreamer::LoadNow(t_ChunkCoord coord)
+{
+    const uint64_t KEY = ChunkKey(coord);
+    const bool WAS_REQUESTED = m_Requested.contains(KEY);
+    {
+        std::unique_lock lock(m_Mutex);
+        std::erase_if(m_Queue, [KEY](t_ChunkCoord queued) { return ChunkKey(queued) == KEY; });
+        m_Cv.wait(lock, [this, KEY] { return m_LoadingKey != KEY; });
+    }
+
+    // It may have finished on the streaming thread after all
+    CollectLoaded();
+    if (m_Chunks.contains(KEY))
+    {
+        return;
+    }
+    m_Requested.erase(KEY);
+
+    t_LoadedChunk loaded;
+    loaded.chunk.coord = coord;
+    loaded.b_Loaded = m_Loader(coord, loaded.chunk);
+    Insert(std::move(loaded));
+
+    if (WAS_REQUESTED)
+    {
+        ++m_Stats.stalls_total;
+        RW_LOG_WARNING("WorldStreamer", "Stall: chunk ({}, {}) loaded on the main thread", coord.x, coord.y);
+    }
+}
+
+void WorldStreamer::Insert(t_LoadedChunk&& loaded)
+{
+    const uint64_t KEY = ChunkKey(loaded.chunk.coord);
+    auto [it, b_Inserted] = m_Chunks.try_emplace(KEY);
+    if (!b_Inserted)
+    {
+        return;
+    }
+
+    t_ChunkSlot& slot = it->second;
+    slot.b_Empty = !loaded.b_Loaded;
+    slot.chunk = std::move(loaded.chunk);
+    slot.memory_bytes = EstimateBytes(slot.chunk);
+    m_ChunkBytes += slot.memory_bytes;
+    ++m_Stats.loaded_total;
+}
+
+/*
++--------------------------------------------------------+
+|                      MAIN THREAD                       |
++--------------------------------------------------------+
+*/
+
+void WorldStreamer::Update(Vector2 focus)
+{
+    if (!m_Loader)
+    {
+        return;
+    }
+
+    CollectLoaded();
+    const t_ChunkCoord CENTER = WorldToChunk(focus);
+
+    // Out of range, with one chunk of hysteresis against thrashing at edges
+    std::vector<uint64_t> dropped;
+    for (auto& [key, slot] : m_Chunks)
+    {
+        const int RING = Ring(slot.chunk.coord, CENTER);
+        if (RING > m_PrefetchRadius + 1)
+        {
+            dropped.push_back(key);
+        }
+        else if (slot.b_Active && RING > m_ActiveRadius + 1)
+        {
+            Deactivate(slot, true);
+        }
+    }
+    for (uint64_t key : dropped)
+    {
+        Drop(key, true);
+    }
+
+    {
+        std::lock_guard lock(m_Mutex);
+        std::erase_if
+        (
+            m_Queue,
+            [&](t_ChunkCoord queued)
+            {
+                if (Ring(queued, CENTER) <= m_PrefetchRadius + 1)
+                {
+                    return false;
+                }
+                m_Requested.erase(ChunkKey(queued));
+                return true;
+            }
+        );
+    }
+
+    // The active area has to be there this frame
+    for (int dy = -m_ActiveRadius; dy <= m_ActiveRadius; ++dy)
+    {
+        for (int dx = -m_ActiveRadius; dx <= m_ActiveRadius; ++dx)
+        {
+            const t_ChunkCoord COORD = { CENTER.x + dx, CENTER.y + dy };
+            if (!m_Chunks.contains(ChunkKey(COORD)))
+            {
+                LoadNow(COORD);
+            }
+
+            t_ChunkSlot& slot = m_Chunks.at(ChunkKey(COORD));
+            if (!slot.b_Active)
+            {
+                Activate(slot);
+            }
+        }
+    }
+
+    // Prefetch ring, nearest first, while there is budget left
+    std::vector<t_ChunkCoord> wanted;
+    for (int dy = -m_PrefetchRadius; dy <= m_PrefetchRadius; ++dy)
+    {
+        for (int dx = -m_PrefetchRadius; dx <= m_PrefetchRadius; ++dx)
+        {
+            const t_ChunkCoord COORD = { CENTER.x + dx, CENTER.y + dy };
+            const uint64_t KEY = ChunkKey(COORD);
+            if (!m_Chunks.contains(KEY) && !m_Requested.contains(KEY))
+            {
+                wanted.push_back(COORD);
+            }
+        }
+    }
+    std::sort
+    (
+        wanted.begin(),
+        wanted.end(),
+        [&](t_ChunkCoord a, t_ChunkCoord b) { return Ring(a, CENTER) < Ring(b, CENTER); }
+    );
+    for (t_ChunkCoord coord : wanted)
+    {
+        if (m_ChunkBytes + m_TextureBytes >= m_MemoryBudget)
+        {
+            break;
+        }
+        Enqueue(coord);
+    }
+
+    EnforceBudget(CENTER);
+    UpdateTexturePrefetch();
+
+    m_Stats.resident_chunks = m_Chunks.size();
+    m_Stats.active_chunks = static_cast<size_t>(std::count_if
+    (
+        m_Chunks.begin(),
+        m_Chunks.end(),
+        [](const auto& pair) { return pair.second.b_Active; }
+    ));
+    m_Stats.queued_chunks = m_Requested.size();
+    m_Stats.memory_bytes = m_ChunkBytes + m_TextureBytes;
+    m_Stats.memory_budget = m_MemoryBudget;
+
+    // Textures are already counted by the AssetManager
+    EngineStats::Get().SetMemoryUsage("World chunks", m_ChunkBytes);
+}
+
+void WorldStreamer::Activate(t_ChunkSlot& slot)
+{
+    slot.b_Active = true;
+    if (slot.b_Empty)
+    {
+        return;
+    }
+
+    for (const std::string& PATH : slot.chunk.textures)
+    {
+        AcquireTexture(PATH);
+    }
+    if (m_OnActivate)
+    {
+        m_OnActivate(slot.chunk);
+    }
+}
+
+void WorldStreamer::Deactivate(t_ChunkSlot& slot, bool b_Notify)
+{
+    if (!slot.b_Active)
+    {
+        return;
+    }
+
+    slot.b_Active = false;
+    if (slot.b_Empty)
+    {
+        return;
+    }
+
+    if (b_Notify && m_OnDeactivate)
+    {
+        m_OnDeactivate(slot.chunk);
+    }
+    for (const std::string& PATH : slot.chunk.textures)
+    {
+        ReleaseTexture(PATH);
+    }
+}
+
+void WorldStreamer::Drop(uint64_t key, bool b_Notify)
+{
+    auto it = m_Chunks.find(key);
+    if (it == m_Chunks.end())
+    {
+        return;
+    }
+
+    Deactivate(it->second, b_Notify);
+    m_ChunkBytes -= it->second.memory_bytes;
+    m_Chunks.erase(it);
+    ++m_Stats.evicted_total;
+}
+
+void WorldStreamer::EnforceBudget(t_ChunkCoord center)
+{
+    while (m_ChunkBytes + m_TextureBytes > m_MemoryBudget)
+    {
+        // Farthest inactive chunk first; active ones are never evicted
+        auto victim = m_Chunks.end();
+        for (auto it = m_Chunks.begin(); it != m_Chunks.end(); ++it)
+        {
+            if (!it->second.b_Active &&
+                (victim == m_Chunks.end() ||
+                 Ring(it->second.chunk.coord, center) > Ring(victim->second.chunk.coord, center)))
+            {
+                victim = it;
+            }
+        }
+
+        if (victim == m_Chunks.end())
+        {
+            if (!m_bOverBudgetReported)
+            {
+                RW_LOG_WARNING
+                (
+                    "WorldStreamer",
+                    "Active chunks alone use {} KB, over the {} KB budget",
+                    (m_ChunkBytes + m_TextureBytes) / 1024,
+                    m_MemoryBudget / 1024
+                );
+                m_bOverBudgetReported = true;
+            }
+            return;
+        }
+        Drop(victim->first, true);
+    }
+    m_bOverBudgetReported = false;
+}
+
+void WorldStreamer::UpdateTexturePrefetch()
+{
+    if (!m_AssetManager)
+    {
+        return;
+    }
+
+    // Textures of loaded but inactive chunks, decoded ahead of activation
+    std::vector<std::string> wanted;
+    for (const auto& [key, slot] : m_Chunks)
+    {
+        if (slot.b_Active || slot.b_Empty)
+        {
+            continue;
+        }
+        for (const std::string& PATH : slot.chunk.textures)
+        {
+            if (!m_Textures.contains(PATH))
+            {
+                wanted.push_back(PATH);
+            }
+        }
+    }
+    std::sort(wanted.begin(), wanted.end());
+    wanted.erase(std::unique(wanted.begin(), wanted.end()), wanted.end());
+
+    if (wanted != m_PrefetchedTextures)
+    {
+        m_AssetManager->SetPrefetchSet(wanted, GetPrefetchOwner());
+        m_PrefetchedTextures = std::move(wanted);
+    }
+}
+
+void WorldStreamer::AcquireTexture(const std::string& path)
+{
+    t_TextureRef& ref = m_Textures[path];
+    if (ref.ref_count++ > 0)
+    {
+        return;
+    }
+
+    ref.texture = m_AssetManager
+        ? m_AssetManager->LoadTexture(path.c_str())
+        : ::LoadTexture(path.c_str());
+
+    m_TextureBytes += static_cast<size_t>
+    (
+        GetPixelDataSize(ref.texture.width, ref.texture.height, ref.texture.format)
+    );
+}
+
+void WorldStreamer::ReleaseTexture(const std::string& path)
+{
+    auto it = m_Textures.find(path);
+    if (it == m_Textures.end() || --it->second.ref_count > 0)
+    {
+        return;
+    }
+
+    const Texture2D& TEXTURE = it->second.texture;
+    m_TextureBytes -= static_cast<size_t>
+    (
+        GetPixelDataSize(TEXTURE.width, TEXTURE.height, TEXTURE.format)
+    );
+
+    if (m_AssetManager)
+    {
+        m_AssetManager->UnloadTexture(TEXTURE);
+    }
+    else
+    {
+        ::UnloadTexture(TEXTURE);
+    }
+    m_Textures.erase(it);
+}
+
+std::vector<const t_WorldChunk*> WorldStreamer::GetActiveChunks() const
+{
+    std::vector<const t_WorldChunk*> chunks;
+    for (const auto& [key, slot] : m_Chunks)
+    {
+        if (slot.b_Active && !slot.b_Empty)
+        {
+            chunks.push_back(&slot.chunk);
+        }
+    }
+    return chunks;
+}
+
+Texture2D WorldStreamer::GetTexture(const std::string& path) const
+{
+    auto it = m_Textures.find(path);
+    return it != m_Textures.end() ? it->second.texture : Texture2D{};
+}
+
+void WorldStreamer::Clear()
+{
+    StopWorker();
+    for (auto& [key, slot] : m_Chunks)
+    {
+        Deactivate(slot, true);
+    }
+
+    m_Chunks.clear();
+    m_Requested.clear();
+    m_Queue.clear();
+    m_Loaded.clear();
+    m_ChunkBytes = 0;
+    m_TextureBytes = 0;
+
+    if (m_AssetManager && !m_PrefetchedTextures.empty())
+    {
+        m_AssetManager->SetPrefetchSet({}, GetPrefetchOwner());
+    }
+    m_PrefetchedTextures.clear();
+
+    m_Stats.resident_chunks = 0;
+    m_Stats.active_chunks = 0;
+    m_Stats.queued_chunks = 0;
+    m_Stats.memory_bytes = 0;
+}
@@ -0,0 +1,202 @@
+#pragma once
+#include "AssetManager.h"
+#include "EngineStats.h"
+#include <raylib.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+constexpr float c_STREAM_DEFAULT_CHUNK_SIZE = 512.0f;
+constexpr int c_STREAM_DEFAULT_ACTIVE_RADIUS = 1;
+constexpr int c_STREAM_DEFAULT_PREFETCH_RADIUS = 2;
+constexpr size_t c_STREAM_DEFAULT_MEMORY_BUDGET = 64u * 1024u * 1024u;
+
+struct t_ChunkCoord
+{
+    int32_t x = 0;
+    int32_t y = 0;
+
+    bool operator==(const t_ChunkCoord&) const = default;
+};
+
+struct t_ChunkTile
+{
+    Rectangle rect{};
+    int32_t type = 0;
+};
+
+// Spawn entry; the map decides what type names mean
+struct t_ChunkActor
+{
+    std::string type;
+    Vector2 position{};
+    float param_a = 0.0f;
+    float param_b = 0.0f;
+};
+
+struct t_WorldChunk
+{
+    t_ChunkCoord coord;
+    std::vector<t_ChunkTile> tiles;
+    std::vector<t_ChunkActor> actors;
+    std::vector<std::string> textures;      // acquired while the chunk is active
+};
+
+struct t_StreamStats
+{
+    size_t resident_chunks = 0;     // data in memory, active or not
+    size_t active_chunks = 0;
+    size_t queued_chunks = 0;       // waiting for or on the streaming thread
+    size_t memory_bytes = 0;        // chunk data plus active textures
+    size_t memory_budget = 0;
+    size_t loaded_total = 0;
+    size_t evicted_total = 0;
+    size_t stalls_total = 0;        // active chunks that had to load on the main thread
+};
+
+/**
+ * @brief Streams a chunked world in and out around a focus point
+ *
+ * The world is a grid of square chunks. A loader fills a chunk's tiles,
+ * actor spawns and texture list on a background thread. Chunks within the
+ * prefetch radius of the focus are loaded ahead of time; chunks within
+ * the active radius are activated on the main thread (textures acquired
+ * through the AssetManager, activate callback run). Chunks farther than
+ * the prefetch radius are dropped, and inactive chunks are evicted
+ * farthest first while the memory budget is exceeded. Radii are measured
+ * in chunks (Chebyshev distance) and both have one chunk of hysteresis.
+ *
+ * An active chunk that is not loaded yet is loaded on the main thread so
+ * the world never has holes; GetStats().stalls_total counts those.
+ *
+ * Example Usage:
+ * @code
+ * m_World.SetAssetManager(&GetAssets());
+ * m_World.SetLoader([](t_ChunkCoord coord, t_WorldChunk& chunk)
+ * {
+ *     return s_bfReadChunkFile(coord, chunk);     // streaming thread
+ * });
+ * m_World.SetCallbacks(
+ *     [this](const t_WorldChunk& chunk) { SpawnActors(chunk); },
+ *     [this](const t_WorldChunk& chunk) { DespawnActors(chunk); });
+ *
+ * // Every frame
+ * m_World.Update(m_Camera.GetTarget());
+ * @endcode
+ */
+class WorldStreamer
+{
+public:
+    // Streaming thread: fill the chunk; return false for empty space
+    using ChunkLoader = std::function<bool(t_ChunkCoord coord, t_WorldChunk& chunk)>;
+
+    // Main thread
+    using ChunkCallback = std::function<void(const t_WorldChunk& chunk)>;
+
+    WorldStreamer() = default;
+    ~WorldStreamer();
+
+    WorldStreamer(const WorldStreamer&) = delete;
+    WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+    // Changing the layout or loader drops every chunk (see Clear)
+    void SetChunkSize(float chunk_size);
+    void SetLoader(ChunkLoader loader);
+    void SetRadii(int active_radius, int prefetch_radius);
+    void SetMemoryBudget(size_t bytes) { m_MemoryBudget = bytes; }
+    void SetAssetManager(AssetManager* asset_manager) { m_AssetManager = asset_manager; }
+    void SetCallbacks(ChunkCallback on_activate, ChunkCallback on_deactivate);
+
+    // Main thread, once per frame
+    void Update(Vector2 focus);
+
+    // Deactivates (with callbacks) and drops every chunk
+    void Clear();
+
+    t_ChunkCoord WorldToChunk(Vector2 position) const;
+    float GetChunkSize() const { return m_ChunkSize; }
+
+    std::vector<const t_WorldChunk*> GetActiveChunks() const;
+    Texture2D GetTexture(const std::string& path) const;
+    const t_StreamStats& GetStats() const { return m_Stats; }
+
+private:
+    struct t_ChunkSlot
+    {
+        t_WorldChunk chunk;
+        size_t memory_bytes = 0;
+        bool b_Empty = false;
+        bool b_Active = false;
+    };
+
+    struct t_LoadedChunk
+    {
+        t_WorldChunk chunk;
+        bool b_Loaded = false;
+    };
+
+    struct t_TextureRef
+    {
+        Texture2D texture{};
+        int ref_count = 0;
+    };
+
+    static uint64_t ChunkKey(t_ChunkCoord coord);
+    static int Ring(t_ChunkCoord a, t_ChunkCoord b);
+    static size_t EstimateBytes(const t_WorldChunk& chunk);
+
+    void StreamWorker();
+    void StopWorker();
+    void CollectLoaded();
+    void Enqueue(t_ChunkCoord coord);
+    void LoadNow(t_ChunkCoord coord);
+    void Insert(t_LoadedChunk&& loaded);
+
+    void Activate(t_ChunkSlot& slot);
+    void Deactivate(t_ChunkSlot& slot, bool b_Notify);
+    void Drop(uint64_t key, bool b_Notify);
+    void EnforceBudget(t_ChunkCoord center);
+    void UpdateTexturePrefetch();
+    std::string GetPrefetchOwner() const;
+
+    void AcquireTexture(const std::string& path);
+    void ReleaseTexture(const std::string& path);
+
+    float m_ChunkSize = c_STREAM_DEFAULT_CHUNK_SIZE;
+    int m_ActiveRadius = c_STREAM_DEFAULT_ACTIVE_RADIUS;
+    int m_PrefetchRadius = c_STREAM_DEFAULT_PREFETCH_RADIUS;
+    size_t m_MemoryBudget = c_STREAM_DEFAULT_MEMORY_BUDGET;
+
+    AssetManager* m_AssetManager = nullptr;
+    ChunkLoader m_Loader;
+    ChunkCallback m_OnActivate;
+    ChunkCallback m_OnDeactivate;
+
+    // Main thread only
+    std::unordered_map<uint64_t, t_ChunkSlot> m_Chunks;
+    std::unordered_set<uint64_t> m_Requested;   // queued, loading or loaded but not collected
+    std::unordered_map<std::string, t_TextureRef> m_Textures;
+    std::vector<std::string> m_PrefetchedTextures;
+    size_t m_ChunkBytes = 0;
+    size_t m_TextureBytes = 0;
+    bool m_bOverBudgetReported = false;
+    t_StreamStats m_Stats;
+
+    // Shared with the streaming thread
+    std::mutex m_Mutex;
+    std::condition_variable m_Cv;
+    std::deque<t_ChunkCoord> m_Queue;
+    std::optional<uint64_t> m_LoadingKey;
+    std::vector<t_LoadedChunk> m_Loaded;
+    std::thread m_Thread;
+    bool m_bStop = false;
+    WorkerMeter m_StreamMeter{ "World streaming" };
+};
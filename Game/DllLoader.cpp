@@ -1,91 +1,586 @@
 #include "DllLoader.h"
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#ifdef _WIN32
 #include <Windows.h>
+#include <winioctl.h>
+#else
+#include <cerrno>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__APPLE__)
+#include <sys/clonefile.h>
+#elif defined(__linux__)
+#include <linux/fs.h>
+#endif
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+/*
++--------------------------------------------------------+
+|                   PLATFORM BACKENDS                    |
++--------------------------------------------------------+
+*/
+
+static double s_fElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+#ifdef _WIN32
+
+static void* s_fOpenLibrary(const std::string& path)
+{
+    return reinterpret_cast<void*>(LoadLibraryA(path.c_str()));
+}
+
+static void s_fCloseLibrary(void* handle)
+{
+    FreeLibrary(reinterpret_cast<HMODULE>(handle));
+}
+
+static void* s_fFindSymbol(void* handle, const char* SYMBOL_NAME)
+{
+    return reinterpret_cast<void*>
+    (
+        GetProcAddress(reinterpret_cast<HMODULE>(handle), SYMBOL_NAME)
+    );
+}
+
+static std::string s_fLastError()
+{
+    return "error " + std::to_string(GetLastError());
+}
+
+static unsigned long s_fProcessId()
+{
+    return GetCurrentProcessId();
+}
+
+static bool s_bfIsProcessAlive(unsigned long pid)
+{
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(pid));
+    if (!process)
+    {
+        return false;
+    }
+
+    DWORD exit_code = 0;
+    const bool b_Alive = GetExitCodeProcess(process, &exit_code) && exit_code == STILL_ACTIVE;
+    CloseHandle(process);
+    return b_Alive;
+}
+
+// Next to the executable, so the copy finds raylib.dll the same way the original does
+static std::vector<fs::path> s_fShadowDirectories()
+{
+    std::array<char, MAX_PATH> exe_path_buffer{};
+    GetModuleFileNameA
+    (
+        nullptr,
+        exe_path_buffer.data(),
+        static_cast<DWORD>(exe_path_buffer.size())
+    );
+    return { fs::path(exe_path_buffer.data()).parent_path() };
+}
+
+/*
+    Block cloning (ReFS, Dev Drive): the clone shares the original's
+    clusters until either side is written. Ranges must be cluster aligned,
+    so the clone is grown to a cluster multiple and trimmed afterwards.
+*/
+static bool s_bfCloneFile(const fs::path& source_path, const fs::path& dest_path)
+{
+#ifdef FSCTL_DUPLICATE_EXTENTS_TO_FILE
+    HANDLE source = CreateFileW
+    (
+        source_path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+    );
+    if (source == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    DWORD volume_flags = 0;
+    LARGE_INTEGER size{};
+    DWORD sectors_per_cluster = 0;
+    DWORD bytes_per_sector = 0;
+    DWORD free_clusters = 0;
+    DWORD total_clusters = 0;
+    const bool b_Supported =
+        GetVolumeInformationByHandleW(source, nullptr, 0, nullptr, nullptr, &volume_flags, nullptr, 0) &&
+        (volume_flags & FILE_SUPPORTS_BLOCK_REFCOUNTING) &&
+        GetFileSizeEx(source, &size) &&
+        GetDiskFreeSpaceW
+        (
+            source_path.root_path().c_str(), &sectors_per_cluster, &bytes_per_sector,
+            &free_clusters, &total_clusters
+        );
+    if (!b_Supported)
+    {
+        CloseHandle(source);
+        return false;
+    }
+
+    HANDLE dest = CreateFileW
+    (
+        dest_path.c_str(), GENERIC_READ | GENERIC_WRITE | DELETE, 0,
+        nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr
+    );
+    if (dest == INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(source);
+        return false;
+    }
+
+    const LONGLONG CLUSTER = static_cast<LONGLONG>(sectors_per_cluster) * bytes_per_sector;
+    const LONGLONG ALIGNED_SIZE = (size.QuadPart + CLUSTER - 1) / CLUSTER * CLUSTER;
+    const LONGLONG MAX_CHUNK = (1LL << 30) / CLUSTER * CLUSTER;
+
+    FILE_END_OF_FILE_INFO end_of_file{};
+    end_of_file.EndOfFile.QuadPart = ALIGNED_SIZE;
+    bool b_Cloned = SetFileInformationByHandle(dest, FileEndOfFileInfo, &end_of_file, sizeof(end_of_file));
+
+    for (LONGLONG offset = 0; b_Cloned && offset < ALIGNED_SIZE; offset += MAX_CHUNK)
+    {
+        DUPLICATE_EXTENTS_DATA extents{};
+        extents.FileHandle = source;
+        extents.SourceFileOffset.QuadPart = offset;
+        extents.TargetFileOffset.QuadPart = offset;
+        extents.ByteCount.QuadPart = (std::min)(MAX_CHUNK, ALIGNED_SIZE - offset);
+
+        DWORD returned = 0;
+        b_Cloned = DeviceIoControl
+        (
+            dest, FSCTL_DUPLICATE_EXTENTS_TO_FILE, &extents, sizeof(extents),
+            nullptr, 0, &returned, nullptr
+        );
+    }
+
+    end_of_file.EndOfFile = size;
+    b_Cloned = b_Cloned && SetFileInformationByHandle(dest, FileEndOfFileInfo, &end_of_file, sizeof(end_of_file));
+
+    if (!b_Cloned)
+    {
+        FILE_DISPOSITION_INFO disposition{ TRUE };
+        SetFileInformationByHandle(dest, FileDispositionInfo, &disposition, sizeof(disposition));
+    }
+    CloseHandle(dest);
+    CloseHandle(source);
+    return b_Cloned;
+#else
+    (void)source_path;
+    (void)dest_path;
+    return false;
+#endif
+}
+
+// A hardlinked DLL shares the original's file, and LoadLibrary would lock
+// it against the linker; that is the lock the shadow exists to avoid
+static bool s_bfHardlinkFile(const fs::path&, const fs::path&)
+{
+    return false;
+}
+
+// LoadLibrary tells libraries apart by path, which is unique per shadow
+static void s_fTrackLoaded(void*, const fs::path&)
+{
+}
+
+static void s_fUntrackLoaded(void*)
+{
+}
+
+#else
+
+static void* s_fOpenLibrary(const std::string& path)
+{
+    // RTLD_NOW surfaces unresolved symbols here instead of mid-frame
+    return dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+}
+
+static void s_fCloseLibrary(void* handle)
+{
+    dlclose(handle);
+}
+
+static void* s_fFindSymbol(void* handle, const char* SYMBOL_NAME)
+{
+    return dlsym(handle, SYMBOL_NAME);
+}
+
+static std::string s_fLastError()
+{
+    const char* ERROR_TEXT = dlerror();
+    return ERROR_TEXT ? ERROR_TEXT : "unknown error";
+}
+
+static unsigned long s_fProcessId()
+{
+    return static_cast<unsigned long>(getpid());
+}
+
+static bool s_bfIsProcessAlive(unsigned long pid)
+{
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+}
+
+/*
+    tmpfs first: the copy is a memory-to-memory write and never touches
+    the disk, so it stays cheap no matter how often we reload. /dev/shm
+    is mounted noexec on some systems, in which case dlopen fails and
+    LoadDll moves on to the next directory.
+*/
+static std::vector<fs::path> s_fShadowDirectories()
+{
+    std::vector<fs::path> directories;
+    std::error_code ec;
+
+    if (fs::is_directory("/dev/shm", ec))
+    {
+        directories.emplace_back("/dev/shm");
+    }
+
+    if (const char* RUNTIME_DIR = std::getenv("XDG_RUNTIME_DIR"))
+    {
+        if (fs::is_directory(RUNTIME_DIR, ec))
+        {
+            directories.emplace_back(RUNTIME_DIR);
+        }
+    }
+
+    const fs::path TEMP_DIR = fs::temp_directory_path(ec);
+    if (!ec)
+    {
+        directories.push_back(TEMP_DIR);
+    }
+    return directories;
+}
+
+// Copy-on-write clone; fails on filesystems without reflinks (ext4, tmpfs)
+static bool s_bfCloneFile(const fs::path& source_path, const fs::path& dest_path)
+{
+#if defined(__APPLE__)
+    return clonefile(source_path.c_str(), dest_path.c_str(), 0) == 0;
+#elif defined(FICLONE)
+    const int SOURCE_FD = open(source_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (SOURCE_FD < 0)
+    {
+        return false;
+    }
+
+    const int DEST_FD = open(dest_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0755);
+    bool b_Cloned = DEST_FD >= 0 && ioctl(DEST_FD, FICLONE, SOURCE_FD) == 0;
+
+    if (DEST_FD >= 0)
+    {
+        close(DEST_FD);
+        if (!b_Cloned)
+        {
+            unlink(dest_path.c_str());
+        }
+    }
+    close(SOURCE_FD);
+    return b_Cloned;
+#else
+    (void)source_path;
+    (void)dest_path;
+    return false;
+#endif
+}
+
+/*
+    glibc's dlopen tells libraries apart by device and inode, not by path.
+    The editor loads the new library before unloading the old one, so a
+    hardlink to a file that was not replaced since (Reset, a Compile with
+    nothing to rebuild) would hand back the old handle. Every loaded file's
+    identity is kept here so the hardlink is skipped for those.
+*/
+struct t_LoadedFile
+{
+    void* handle;
+    dev_t device;
+    ino_t inode;
+};
+
+static std::vector<t_LoadedFile> s_LoadedFiles;
+
+static void s_fTrackLoaded(void* handle, const fs::path& path)
+{
+    struct stat info{};
+    if (stat(path.c_str(), &info) == 0)
+    {
+        s_LoadedFiles.push_back({ handle, info.st_dev, info.st_ino });
+    }
+}
+
+static void s_fUntrackLoaded(void* handle)
+{
+    const auto IT = std::find_if
+    (
+        s_LoadedFiles.begin(), s_LoadedFiles.end(),
+        [handle](const t_LoadedFile& file) { return file.handle == handle; }
+    );
+    if (IT != s_LoadedFiles.end())
+    {
+        s_LoadedFiles.erase(IT);
+    }
+}
+
+static bool s_bfIsLoaded(const struct stat& info)
+{
+    return std::any_of
+    (
+        s_LoadedFiles.begin(), s_LoadedFiles.end(),
+        [&info](const t_LoadedFile& file)
+        {
+            return file.device == info.st_dev && file.inode == info.st_ino;
+        }
+    );
+}
+
+/*
+    A hardlink gives dlopen a new name for the same inode. That only stays
+    safe because linkers (ld.bfd, gold, lld, mold) replace their output
+    with a new file instead of rewriting it, so the inode we mapped is left
+    alone. A tool that truncates the library in place would corrupt the
+    mapped code; set RAYWAVES_SHADOW_COPY=1 to always copy in that case.
+*/
+static bool s_bfHardlinkFile(const fs::path& source_path, const fs::path& dest_path)
+{
+    // A loaded inode falls through to a copy, which dlopen sees as new
+    struct stat info{};
+    if (stat(source_path.c_str(), &info) != 0 || s_bfIsLoaded(info))
+    {
+        return false;
+    }
+    return link(source_path.c_str(), dest_path.c_str()) == 0;
+}
+
+#endif
+
+/*
++--------------------------------------------------------+
+|                     SHADOW COPIES                      |
++--------------------------------------------------------+
+*/
+
+const char* GetShadowMethodName(ShadowMethod method)
+{
+    switch (method)
+    {
+        case ShadowMethod::Reflink:  return "reflink";
+        case ShadowMethod::Hardlink: return "hardlink";
+        case ShadowMethod::Copy:     return "copy";
+        default:                     return "direct";
+    }
+}
 
+static bool s_bfForceCopy()
+{
+    static const bool s_bForceCopy = std::getenv("RAYWAVES_SHADOW_COPY") != nullptr;
+    return s_bForceCopy;
+}
 
-DllHandle LoadDll(const char* PATH) 
+// Removes copies left behind by processes that exited without UnloadDll
+static void s_fRemoveStaleShadows(const fs::path& directory, const std::string& base_name)
+{
+    const std::string PREFIX = base_name + ".shadow.";
+
+    std::error_code ec;
+    for (const fs::directory_entry& ENTRY : fs::directory_iterator(directory, ec))
+    {
+        const std::string FILENAME = ENTRY.path().filename().string();
+        if (!FILENAME.starts_with(PREFIX))
+        {
+            continue;
+        }
+
+        const unsigned long PID = std::strtoul(FILENAME.c_str() + PREFIX.size(), nullptr, 10);
+        if (PID != 0 && PID != s_fProcessId() && !s_bfIsProcessAlive(PID))
+        {
+            std::error_code remove_ec;
+            fs::remove(ENTRY.path(), remove_ec);
+        }
+    }
+}
+
+DllHandle LoadDll(const char* PATH)
 {
     /*
-      On Windows, LoadLibrary locks the file on disk, which prevents recompiling the DLL while the application is running. To avoid this, copy the DLL to a temporary uniquely named file (shadow copy) and load that instead.  
+      LoadLibrary locks the file on disk, which prevents recompiling the DLL
+      while the application is running. dlopen does not lock it, but it
+      returns the already loaded image for a path it has seen, and a linker
+      rewriting the file under a mapped library crashes the process. In both
+      cases: load the library under a uniquely named file (shadow) instead.
+
+      The shadow is made without copying where the filesystem allows it: a
+      reflink or hardlink next to the original (same filesystem by
+      construction). Only when neither works are the bytes copied, into the
+      shadow directories.
     */
 
+    static unsigned long s_ShadowSequence = 0;
+
+    const auto START = Clock::now();
     DllHandle result{ nullptr, {} };
+    std::string direct_path = PATH;
+
+    // Loads dest_path; on failure the shadow is removed again
+    auto try_load = [&](const fs::path& dest_path, ShadowMethod method)
+    {
+        const auto LOAD_START = Clock::now();
+        result.handle = s_fOpenLibrary(dest_path.string());
+        result.timings.load_ms += s_fElapsedMs(LOAD_START);
+        if (result.handle)
+        {
+            result.shadow_path = dest_path.string();
+            result.shadow_method = method;
+            s_fTrackLoaded(result.handle, dest_path);
+            return true;
+        }
+
+        RW_LOG_WARNING("DllLoader", "Failed to load shadow {}: {}", dest_path.string(), s_fLastError());
+        std::error_code ec;
+        fs::remove(dest_path, ec);
+        return false;
+    };
 
     try
     {
         fs::path src_path = fs::path(PATH);
-        if (!fs::exists(src_path))
+        if (fs::exists(src_path))
         {
-            // Fall back to trying to load directly (will fail similarly if missing)
-            HMODULE direct = LoadLibraryA(PATH);
-            result.handle = reinterpret_cast<void*>(direct);
-            result.shadow_path = PATH;
-            return result;
-        }
+            // dlopen only searches the library path for bare file names
+            const fs::path ABSOLUTE_PATH = fs::absolute(src_path);
+            direct_path = ABSOLUTE_PATH.string();
 
-        // Determine destination directory: use the executable 
-        std::array<char, MAX_PATH> exe_path_buffer{};
-        GetModuleFileNameA
-        (
-            nullptr, 
-            exe_path_buffer.data(), 
-            static_cast<DWORD>(exe_path_buffer.size())
-        );
+            // Build a unique filename: GameLogic.shadow.<pid>.<sequence>.dll
+            // stem() will return file name without extention
+            const std::string BASE_NAME = src_path.stem().string();
+            const std::string UNIQUE_NAME = BASE_NAME
+                + ".shadow."
+                + std::to_string(s_fProcessId())
+                + "."
+                + std::to_string(++s_ShadowSequence)
+                + src_path.extension().string();
 
-        fs::path exe_dir = fs::path(exe_path_buffer.data()).parent_path();
+            // 1) Next to the original: no data moves
+            if (!s_bfForceCopy())
+            {
+                const auto LINK_START = Clock::now();
+                const fs::path SOURCE_DIR = ABSOLUTE_PATH.parent_path();
+                s_fRemoveStaleShadows(SOURCE_DIR, BASE_NAME);
 
-        // Build a unique filename: GameLogic.shadow.<pid>.<tick>.dll
-        DWORD pid = GetCurrentProcessId();
-        DWORD ticks = static_cast<DWORD>(GetTickCount64());
+                const fs::path DEST_PATH = SOURCE_DIR / UNIQUE_NAME;
+                ShadowMethod method = ShadowMethod::None;
+                if (s_bfCloneFile(ABSOLUTE_PATH, DEST_PATH))
+                {
+                    method = ShadowMethod::Reflink;
+                }
+                else if (s_bfHardlinkFile(ABSOLUTE_PATH, DEST_PATH))
+                {
+                    method = ShadowMethod::Hardlink;
+                }
+                result.timings.copy_ms += s_fElapsedMs(LINK_START);
 
-        // stem() will return file name without extention
-        std::string base_name = src_path.stem().string();
-        std::string unique_name = base_name 
-            + ".shadow." 
-            + std::to_string(pid) 
-            + "." 
-            + std::to_string(ticks) 
-            + src_path.extension().string();
+                if (method != ShadowMethod::None)
+                {
+                    try_load(DEST_PATH, method);
+                }
+            }
 
-        fs::path dest_path = exe_dir / unique_name;
+            // 2) Full copy into the shadow directories
+            for (const fs::path& DIRECTORY : s_fShadowDirectories())
+            {
+                if (result.handle)
+                {
+                    break;
+                }
 
-        // Copy to destination (overwrite not expected due to uniqueness)
-        fs::copy_file
-        (
-            src_path, 
-            dest_path, 
-            fs::copy_options::overwrite_existing
-        );
+                const auto COPY_START = Clock::now();
+                s_fRemoveStaleShadows(DIRECTORY, BASE_NAME);
 
-        HMODULE mod = LoadLibraryA(dest_path.string().c_str());
-        result.handle = reinterpret_cast<void*>(mod);
-        result.shadow_path = dest_path.string();
-        return result;
+                const fs::path DEST_PATH = DIRECTORY / UNIQUE_NAME;
+                std::error_code ec;
+                fs::copy_file(src_path, DEST_PATH, fs::copy_options::overwrite_existing, ec);
+                result.timings.copy_ms += s_fElapsedMs(COPY_START);
+                if (ec)
+                {
+                    continue;
+                }
+
+                if (try_load(DEST_PATH, ShadowMethod::Copy))
+                {
+                    result.timings.copied_bytes = fs::file_size(DEST_PATH, ec);
+                }
+            }
+        }
     }
     catch (...)
     {
-        // As a last resort, try direct load
-        HMODULE mod = LoadLibraryA(PATH);
-        result.handle = reinterpret_cast<void*>(mod);
+    }
+
+    if (!result.handle)
+    {
+        // As a last resort (or for a missing file, which fails the same way), try direct load
+        const auto LOAD_START = Clock::now();
+        result.handle = s_fOpenLibrary(direct_path);
+        result.timings.load_ms += s_fElapsedMs(LOAD_START);
         result.shadow_path = PATH;
-        return result;
+        result.shadow_method = ShadowMethod::None;
+
+        if (result.handle)
+        {
+            s_fTrackLoaded(result.handle, direct_path);
+        }
+        else
+        {
+            RW_LOG_ERROR("DllLoader", "Failed to load {}: {}", PATH, s_fLastError());
+        }
     }
-}
 
-void UnloadDll(DllHandle dll) 
-{
-    if (dll.handle) 
+    result.timings.total_ms = s_fElapsedMs(START);
+    if (result.handle)
     {
-        FreeLibrary
+        RW_LOG_INFO
         (
-            reinterpret_cast<HMODULE>(dll.handle)
+            "DllLoader",
+            "Loaded {} via {} (shadow {:.2f} ms, load {:.2f} ms, total {:.2f} ms, {} KB copied)",
+            result.shadow_path,
+            GetShadowMethodName(result.shadow_method),
+            result.timings.copy_ms,
+            result.timings.load_ms,
+            result.timings.total_ms,
+            result.timings.copied_bytes / 1024
         );
     }
+    return result;
+}
+
+void UnloadDll(DllHandle dll)
+{
+    if (dll.handle)
+    {
+        s_fUntrackLoaded(dll.handle);
+        s_fCloseLibrary(dll.handle);
+    }
 
     // Attempt to delete the shadow copy after unloading. Ignore failures.
     if (!dll.shadow_path.empty())
     {
         fs::path p = fs::path(dll.shadow_path);
-        
+
         // Only delete if it looks like one of our shadow copies
         std::string filename = p.filename().string();
         if (filename.find(".shadow.") != std::string::npos)
@@ -96,18 +591,11 @@ void UnloadDll(DllHandle dll)
     }
 }
 
-void* GetDllSymbol(DllHandle dll, const char* SYMBOL_NAME) 
+void* GetDllSymbol(DllHandle dll, const char* SYMBOL_NAME)
 {
     if (!dll.handle)
     {
         return nullptr;
     }
-    return reinterpret_cast<void*>
-    (
-        GetProcAddress
-        (
-            reinterpret_cast<HMODULE>(dll.handle),
-            SYMBOL_NAME
-        )
-    );
-}
\ No newline at end of file
+    return s_fFindSymbol(dll.handle, SYMBOL_NAME);
+}
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <filesystem>
 #include <string>
@@ -9,13 +10,42 @@
 namespace fs = std::filesystem;
 #define WIN32_LEAN_AND_MEAN
 
-struct DllHandle 
+// File name of the game logic library as the build produces it
+#ifdef _WIN32
+constexpr const char* c_GAME_LOGIC_LIBRARY = "GameLogic.dll";
+#else
+constexpr const char* c_GAME_LOGIC_LIBRARY = "libGameLogic.so";
+#endif
+
+// How the shadow file was made; only Copy moves the library's bytes
+enum class ShadowMethod
+{
+    None,       // loaded the original directly
+    Reflink,    // copy-on-write clone: FICLONE (btrfs, XFS), clonefile (APFS), block cloning (ReFS)
+    Hardlink,   // second name for the same file (POSIX only)
+    Copy
+};
+
+const char* GetShadowMethodName(ShadowMethod method);
+
+// How long the phases of the last LoadDll took, for tracking reload latency
+struct t_DllLoadTimings
+{
+    double copy_ms = 0.0;   // creating the shadow file (plus stale-shadow cleanup)
+    double load_ms = 0.0;   // LoadLibrary / dlopen, including static initializers
+    double total_ms = 0.0;
+    uintmax_t copied_bytes = 0;     // 0 unless the shadow had to be copied
+};
+
+struct DllHandle
 {
     void* handle;
-    // Absolute path of the shadow-copied DLL actually loaded via LoadLibrary.
-    // This allows unloading and deleting the copy so the original DLL remains
-    // writable for recompilation while the application is running.
+    // Absolute path of the shadow DLL actually loaded via LoadLibrary (or
+    // dlopen). This allows unloading and deleting the shadow so the original
+    // DLL remains writable for recompilation while the application is running.
     std::string shadow_path;
+    t_DllLoadTimings timings = {};
+    ShadowMethod shadow_method = ShadowMethod::None;
 };
 
 DllHandle LoadDll(const char* path);
@@ -0,0 +1,123 @@
+#include "LogicModules.h"
+#include "CVar.h"
+#include "EngineStats.h"
+#include "Logger.h"
+#include "MapManager.h"
+#include <algorithm>
+
+std::vector<t_LogicModule> FindLogicModules(const fs::path& game_logic_path)
+{
+    std::vector<t_LogicModule> modules;
+
+    // Keeps the spelling of a relative GameLogic path ("libGameLogic.so")
+    const fs::path DIRECTORY = game_logic_path.parent_path();
+    const std::string PREFIX = c_LOGIC_MODULE_PREFIX;
+
+    std::error_code ec;
+    for (const fs::directory_entry& ENTRY : fs::directory_iterator(DIRECTORY.empty() ? "." : DIRECTORY, ec))
+    {
+        const std::string STEM = ENTRY.path().stem().string();
+        if
+        (
+            !ENTRY.is_regular_file(ec) ||
+            ENTRY.path().extension() != c_LOGIC_MODULE_EXTENSION ||
+            !STEM.starts_with(PREFIX) ||
+            STEM.size() == PREFIX.size() ||
+            STEM.find(".shadow.") != std::string::npos
+        )
+        {
+            continue;
+        }
+
+        t_LogicModule module;
+        module.name = STEM.substr(PREFIX.size());
+        module.path = (DIRECTORY / ENTRY.path().filename()).string();
+        modules.push_back(std::move(module));
+    }
+
+    std::sort
+    (
+        modules.begin(),
+        modules.end(),
+        [](const t_LogicModule& a, const t_LogicModule& b) { return a.name < b.name; }
+    );
+    return modules;
+}
+
+bool b_LoadLogicModule(t_LogicModule& module)
+{
+    DllHandle dll = LoadDll(module.path.c_str());
+    if (!dll.handle)
+    {
+        RW_LOG_ERROR("LogicModules", "Failed to load module: {}", module.path);
+        return false;
+    }
+
+    auto register_maps = reinterpret_cast<RegisterGameMapsFunc>
+    (
+        GetDllSymbol(dll, "RegisterGameMaps")
+    );
+    if (!register_maps)
+    {
+        RW_LOG_ERROR("LogicModules", "{} does not export RegisterGameMaps", module.path);
+        UnloadDll(dll);
+        return false;
+    }
+
+    AttachEngineServices(dll);
+    module.dll = dll;
+    module.register_maps = register_maps;
+    return true;
+}
+
+void UnloadLogicModule(t_LogicModule& module)
+{
+    if (module.dll.handle)
+    {
+        UnloadDll(module.dll);
+    }
+    module.dll = { nullptr, {} };
+    module.register_maps = nullptr;
+}
+
+void RegisterLogicModule(const t_LogicModule& module, MapManager& manager)
+{
+    if (!module.register_maps)
+    {
+        return;
+    }
+
+    manager.BeginModule(module.name);
+    module.register_maps(&manager);
+    manager.EndModule();
+}
+
+void AttachEngineServices(const DllHandle& dll)
+{
+    auto attach_logger = reinterpret_cast<AttachEngineLoggerFunc>
+    (
+        GetDllSymbol(dll, "AttachEngineLogger")
+    );
+    if (attach_logger)
+    {
+        attach_logger(&Logger::Get());
+    }
+
+    auto attach_cvars = reinterpret_cast<AttachEngineCVarsFunc>
+    (
+        GetDllSymbol(dll, "AttachEngineCVars")
+    );
+    if (attach_cvars)
+    {
+        attach_cvars(&CVarRegistry::Get());
+    }
+
+    auto attach_stats = reinterpret_cast<AttachEngineStatsFunc>
+    (
+        GetDllSymbol(dll, "AttachEngineStats")
+    );
+    if (attach_stats)
+    {
+        attach_stats(&EngineStats::Get());
+    }
+}
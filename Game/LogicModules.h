@@ -0,0 +1,45 @@
+#pragma once
+
+#include "DllLoader.h"
+#include <string>
+#include <vector>
+
+class MapManager;
+
+// Logic modules are built from GameLogic/<Name>/ and ship next to the main
+// GameLogic library as GameLogic_<Name>.dll / libGameLogic_<Name>.so
+#ifdef _WIN32
+constexpr const char* c_LOGIC_MODULE_PREFIX = "GameLogic_";
+constexpr const char* c_LOGIC_MODULE_EXTENSION = ".dll";
+#else
+constexpr const char* c_LOGIC_MODULE_PREFIX = "libGameLogic_";
+constexpr const char* c_LOGIC_MODULE_EXTENSION = ".so";
+#endif
+
+using RegisterGameMapsFunc = void (*)(MapManager*);
+
+struct t_LogicModule
+{
+    std::string name;           // "DemoLevel", the tag its maps get in MapManager
+    std::string path;           // as found, e.g. "libGameLogic_DemoLevel.so"
+    DllHandle dll{ nullptr, {} };
+    RegisterGameMapsFunc register_maps = nullptr;
+};
+
+// Module libraries in the directory of the main GameLogic library, by name
+std::vector<t_LogicModule> FindLogicModules(const fs::path& game_logic_path);
+
+// Loads module.path (module must not be loaded yet) and resolves
+// RegisterGameMaps. To reload, load a copy of the entry first, so a broken
+// rebuild leaves the running one alone.
+bool b_LoadLogicModule(t_LogicModule& module);
+void UnloadLogicModule(t_LogicModule& module);
+
+// Registers the module's maps into manager, tagged with the module's name
+void RegisterLogicModule(const t_LogicModule& module, MapManager& manager);
+
+// Points the Engine singletons linked into a loaded GameLogic library (the
+// main one or a module) at this binary's: its log output reaches the same
+// sinks, its CVars join this registry and its draws and workers are counted
+// in this binary's EngineStats
+void AttachEngineServices(const DllHandle& dll);
@@ -1,17 +1,24 @@
 #include "GameEngine.h"
 #include "DllLoader.h"
+#include "LogicModules.h"
+#include "Logger.h"
+#include "MapManager.h"
 #include "GameConfig.h"
+#include "CVar.h"
 using CreateGameMapFunc = GameMap* (*)();
 
 static std::unique_ptr<GameMap> s_fLoadGameLogic
 (
-    std::string_view dll_path, DllHandle& out_handle
+    std::string_view dll_path, DllHandle& out_handle, StartupProfiler& startup
 )
 {
-    out_handle = LoadDll(dll_path.data());
+    {
+        StartupProfiler::Scope phase(&startup, "LoadDll");
+        out_handle = LoadDll(dll_path.data());
+    }
     if (!out_handle.handle)
     {
-        std::cerr << "Failed to load GameLogic DLL: " << dll_path << "\n";
+        RW_LOG_ERROR("Game", "Failed to load GameLogic DLL: {}", dll_path);
         return nullptr;
     }
 
@@ -21,16 +28,21 @@ static std::unique_ptr<GameMap> s_fLoadGameLogic
     );
     if (!CreateFn)
     {
-        std::cerr << "Failed to find symbol CreateGameMap in GameLogic DLL\n";
+        RW_LOG_ERROR("Game", "Failed to find symbol CreateGameMap in GameLogic DLL");
         UnloadDll(out_handle);
         out_handle = {nullptr, {}};
         return nullptr;
     }
+    AttachEngineServices(out_handle);
 
-    GameMap* raw = CreateFn();
+    GameMap* raw = nullptr;
+    {
+        StartupProfiler::Scope phase(&startup, "CreateGameMap");
+        raw = CreateFn();
+    }
     if (!raw)
     {
-        std::cerr << "CreateGameMap returned null\n";
+        RW_LOG_ERROR("Game", "CreateGameMap returned null");
         UnloadDll(out_handle);
         out_handle = {nullptr, {}};
         return nullptr;
@@ -39,15 +51,26 @@ static std::unique_ptr<GameMap> s_fLoadGameLogic
     return std::unique_ptr<GameMap>(raw);
 }
 
-int main()
+int main(int argc, char** argv)
 {
-    std::cout << "Starting game runtime..." << std::endl;
+    // Built first so the startup report covers everything from here on
+    GameEngine engine;
+    StartupProfiler& startup = engine.GetStartupProfiler();
+
+    // Console output stays; game.log keeps it for bug reports
+    Logger::Get().AddSink(std::make_shared<FileLogSink>("game.log"));
+    RW_LOG_INFO("Game", "Starting game runtime...");
 
     // Load configuration
     GameConfig& config = GameConfig::GetInstance();
-    config.m_bLoadFromFile("config.ini");
+    {
+        StartupProfiler::Scope phase(&startup, "Config parse");
+        config.m_bLoadFromFile("config.ini");
+
+        // +name=value arguments override config.ini
+        CVarRegistry::Get().ApplyCommandLine(argc, argv);
+    }
     
-    GameEngine engine;
     engine.LaunchWindow(config.GetWindowConfig());
     
     // Set FPS based on vsync setting
@@ -60,16 +83,34 @@ int main()
         SetTargetFPS(config.GetWindowConfig().target_fps);
     }
 
+    // Exported games ship their assets as one memory-mapped archive
+    if (fs::exists("Assets.pak"))
+    {
+        StartupProfiler::Scope phase(&startup, "Mount Assets.pak");
+        engine.b_MountAssetPack("Assets.pak");
+    }
+
     DllHandle game_logic_handle{nullptr, {}};
-    auto map = s_fLoadGameLogic("GameLogic.dll", game_logic_handle);
+    auto map = s_fLoadGameLogic(c_GAME_LOGIC_LIBRARY, game_logic_handle, startup);
+    std::vector<t_LogicModule> logic_modules;
     if (map)
     {
+        // CreateGameMap returns GameLogic's MapManager; the modules next to
+        // it add their maps before it initializes
+        StartupProfiler::Scope phase(&startup, "Logic modules");
+        logic_modules = FindLogicModules(c_GAME_LOGIC_LIBRARY);
+        for (t_LogicModule& module : logic_modules)
+        {
+            if (b_LoadLogicModule(module))
+            {
+                RegisterLogicModule(module, static_cast<MapManager&>(*map));
+            }
+        }
         engine.SetMap(std::move(map));
     }
     else
     {
-        std::cerr << "Running without GameLogic (no map loaded)." 
-                  << std::endl;
+        RW_LOG_WARNING("Game", "Running without GameLogic (no map loaded).");
     }
 
     while (!WindowShouldClose())
@@ -86,9 +127,22 @@ int main()
         BeginDrawing();
         ClearBackground(BLACK);
         engine.DrawMap();
-        EndDrawing();
+        {
+            StartupProfiler::Scope phase(&startup, "First EndDrawing");
+            EndDrawing();
+        }
+        engine.EndFrame();
+
+        // No-op after the first frame
+        startup.Finish("startup_report.txt", "game");
     }
 
+    // Maps and the asset prefetch thread run DLL code; stop them first
+    engine.SetMap(nullptr);
+    for (t_LogicModule& module : logic_modules)
+    {
+        UnloadLogicModule(module);
+    }
     UnloadDll(game_logic_handle);
     CloseWindow();
     return 0;
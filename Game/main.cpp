@@ -1,16 +1,20 @@
 #include "GameEditor.h"
 #include "GameEngine.h"
 #include "GameMap.h"
+#include "Logger.h"
 
 // DLL loading now handled by GameEditor for hot-reload
-int main()
+int main(int argc, char** argv)
 {
-    printf("Game Engine Starting...\n");
+    RW_LOG_INFO("Main", "Game Engine Starting...");
     GameEditor editor;
     editor.Init(1280,720,"RayWaves");
 
+    // +name=value arguments override config.ini (read by Init)
+    CVarRegistry::Get().ApplyCommandLine(argc, argv);
+
     // Load logic DLL and create the map (will show default map if load fails)
-    editor.b_LoadGameLogic("GameLogic.dll");
+    editor.b_LoadGameLogic(c_GAME_LOGIC_LIBRARY);
     editor.Run();
     return 0;
 }
\ No newline at end of file
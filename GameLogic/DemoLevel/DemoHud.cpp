@@ -0,0 +1,29 @@
+#include "DemoHud.h"
+
+DemoHud::DemoHud()
+    : GameMap("HUD")
+{
+}
+
+void DemoHud::Initialize()
+{
+    m_PlayTime = 0.0f;
+    m_Fps = GetFPS();
+}
+
+void DemoHud::Update(float DeltaTime)
+{
+    // Runs at the layer's tick rate; DeltaTime covers the whole interval
+    m_PlayTime += DeltaTime;
+    m_Fps = GetFPS();
+}
+
+void DemoHud::Draw()
+{
+    const int32_t Minutes = static_cast<int32_t>(m_PlayTime) / 60;
+    const int32_t Seconds = static_cast<int32_t>(m_PlayTime) % 60;
+
+    DrawRectangle(10, 10, 220, 58, Color{ 0, 0, 0, 120 });
+    DrawText(TextFormat("Time %02d:%02d   FPS %d", Minutes, Seconds, m_Fps), 20, 18, 18, WHITE);
+    DrawText("P: Pause", 20, 42, 16, Color{ 200, 200, 200, 255 });
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "../../Engine/GameMap.h"
+#include <raylib.h>
+
+// Stats overlay pushed by DemoLevel as a 10 Hz layer
+class DemoHud : public GameMap
+{
+private:
+    float m_PlayTime = 0.0f;
+    int32_t m_Fps = 0;
+
+public:
+    DemoHud();
+    ~DemoHud() override = default;
+
+    void Initialize() override;
+    void Update(float DeltaTime) override;
+    void Draw() override;
+};
@@ -0,0 +1,505 @@
+#include "DemoLevel.h"
+#include "../../Engine/CVar.h"
+#include "../../Engine/EngineStats.h"
+#include "../../Engine/Logger.h"
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+constexpr float TileSrcSize = 16.0f;
+constexpr float TileRenderSize = 32.0f;
+constexpr float FloorY = 405.0f;
+constexpr int32_t ChunkColumns = 16;
+constexpr const char* LevelPath = "Assets/Levels/demo.rwl";
+
+// Tunable from the editor's CVars panel, config.ini or +name=value
+static CVar<float> s_Gravity("demo.gravity", 1200.0f, 0.0f, 5000.0f, "Downward acceleration of the player (px/s^2)");
+static CVar<bool> s_CullGround("demo.cull_ground", true, "Skip ground columns outside the camera view when drawing");
+
+DemoLevel::DemoLevel() 
+    : GameMap("Platformer Demo")
+{
+}
+
+DemoLevel::~DemoLevel()
+{
+    RemoveOverlays();
+
+    AssetManager& Assets = GetAssets();
+    Assets.UnloadTexture(m_TilesetTex);
+    Assets.UnloadTexture(m_SlimeTexture);
+    GetAudio().UnloadSound(m_SlimeDeathSound);
+    
+    for (auto& Tex : m_BackgroundLayers)
+    {
+        Assets.UnloadTexture(Tex);
+    }
+    m_BackgroundLayers.clear();
+}
+
+void DemoLevel::Initialize()
+{
+    AssetManager& Assets = GetAssets();
+    m_Player.Initialize(Assets, GetAudio(), "Assets/player.png");
+    m_TilesetTex = Assets.LoadTexture("Assets/tileset.png");
+    m_SlimeTexture = Assets.LoadTexture("Assets/slime.png");
+    m_SlimeDeathSound = Assets.LoadSound("Assets/Sounds/slime_death.wav");
+
+    // A wave of kills layers a few death sounds instead of one per slime
+    GetAudio().SetInstanceLimit(m_SlimeDeathSound, 3);
+
+    m_BackgroundLayers.clear();
+    m_BackgroundLayers.push_back(Assets.LoadTexture("Assets/background_0.png"));
+    m_BackgroundLayers.push_back(Assets.LoadTexture("Assets/background_1.png"));
+    m_BackgroundLayers.push_back(Assets.LoadTexture("Assets/background_2.png"));
+
+    // Layout and spawns live in the level file; its tiles are read in place.
+    // The streaming thread reads the old mapping until the world is cleared.
+    m_World.Clear();
+    m_LevelLeft = 0.0f;
+    m_LevelRight = 0.0f;
+    m_pGroundLayer = nullptr;
+    if (b_LoadLevel(LevelPath))
+    {
+        m_pGroundLayer = GetLevel().FindLayer("ground");
+    }
+
+    float LevelTileSize = TileRenderSize;
+    if (m_pGroundLayer)
+    {
+        LevelTileSize = GetLevel().GetTileSize();
+        m_LevelLeft = m_pGroundLayer->origin_x;
+        m_LevelRight = m_pGroundLayer->origin_x + m_pGroundLayer->width * LevelTileSize;
+    }
+
+    m_World.SetAssetManager(&Assets);
+    m_World.SetChunkSize(ChunkColumns * LevelTileSize);
+    m_World.SetLoader([this](t_ChunkCoord Coord, t_WorldChunk& Chunk)
+    {
+        return LoadGroundChunk(Coord, Chunk);
+    });
+    m_World.SetCallbacks(
+        [this](const t_WorldChunk&) { m_bGroundDirty = true; },
+        [this](const t_WorldChunk&) { m_bGroundDirty = true; }
+    );
+
+    Reset();
+    PushOverlays();
+    RW_LOG_INFO("DemoLevel", "Assets Loaded & Initialized");
+}
+
+void DemoLevel::OnSuspend()
+{
+    RemoveOverlays();
+}
+
+void DemoLevel::OnResume()
+{
+    PushOverlays();
+}
+
+void DemoLevel::PushOverlays()
+{
+    // The HUD only shows timers, so 10 updates a second are plenty
+    RequestPushLayer("DemoHud", { .order = 100, .tick_rate = 10.0f });
+}
+
+void DemoLevel::RemoveOverlays()
+{
+    RequestRemoveLayer("DemoHud");
+    RequestRemoveLayer("DemoPause");
+}
+
+void DemoLevel::Reset()
+{
+    const LevelFile& Level = GetLevel();
+
+    Vector2 PlayerSpawn = { 0.0f, 0.0f };
+    m_Slimes.clear();
+    for (const t_LevelSpawn& Spawn : Level.GetSpawns())
+    {
+        const std::string_view Type = Level.GetSpawnType(Spawn);
+        if (Type == "player")
+        {
+            PlayerSpawn = { Spawn.x, Spawn.y };
+        }
+        else if (Type == "slime")
+        {
+            // Y is the center of the slime; patrol bounds are param_a/param_b
+            Slime SlimeEnemy;
+            SlimeEnemy.Initialize(m_SlimeTexture, m_SlimeDeathSound, GetAudio(), { Spawn.x, Spawn.y });
+            SlimeEnemy.SetPatrolBounds(Spawn.param_a, Spawn.param_b);
+            m_Slimes.push_back(SlimeEnemy);
+        }
+    }
+
+    m_Player.Reset(PlayerSpawn);
+    
+    m_Camera.Initialize(m_Player.GetPosition(), 2.5f);
+    m_Camera.SetMinZoom(2.5f);
+    
+    float LevelTop = 0.0f;
+    float LevelBottom = 350.0f;
+    m_Camera.SetBounds(m_LevelLeft, m_LevelRight, LevelTop, LevelBottom);
+
+    // Chunks around the spawn point load immediately
+    StreamWorld();
+}
+
+// Runs on the streaming thread: the ground tiles whose top-left corner
+// falls inside the chunk, read straight out of the mapped level
+bool DemoLevel::LoadGroundChunk(t_ChunkCoord Coord, t_WorldChunk& Chunk) const
+{
+    if (!m_pGroundLayer)
+    {
+        return false;
+    }
+
+    const LevelFile& Level = GetLevel();
+    const t_LevelLayer& Ground = *m_pGroundLayer;
+    const float TileSize = Level.GetTileSize();
+    const float ChunkSize = ChunkColumns * TileSize;
+
+    auto FirstCell = [TileSize](float Edge, float Origin, uint32_t Count)
+    {
+        const float Cell = std::ceil((Edge - Origin) / TileSize);
+        return static_cast<int64_t>(std::clamp(Cell, 0.0f, static_cast<float>(Count)));
+    };
+
+    const int64_t ColBegin = FirstCell(Coord.x * ChunkSize, Ground.origin_x, Ground.width);
+    const int64_t ColEnd = FirstCell((Coord.x + 1) * ChunkSize, Ground.origin_x, Ground.width);
+    const int64_t RowBegin = FirstCell(Coord.y * ChunkSize, Ground.origin_y, Ground.height);
+    const int64_t RowEnd = FirstCell((Coord.y + 1) * ChunkSize, Ground.origin_y, Ground.height);
+
+    for (int64_t Row = RowBegin; Row < RowEnd; ++Row)
+    {
+        for (int64_t Col = ColBegin; Col < ColEnd; ++Col)
+        {
+            if (Level.GetTile(Ground, Col, Row) == c_LEVEL_TILE_EMPTY)
+            {
+                continue;
+            }
+
+            // Type is the column within the level, which picks the tile pattern
+            Rectangle Rect = { Ground.origin_x + Col * TileSize, Ground.origin_y + Row * TileSize, TileSize, TileSize };
+            Chunk.tiles.push_back({ Rect, static_cast<int32_t>(Col) });
+        }
+    }
+    return !Chunk.tiles.empty();
+}
+
+bool DemoLevel::b_SaveSnapshot(MapSnapshot& Out) const
+{
+    m_Player.SaveState(Out);
+    Out.Write(m_Camera);
+    Out.Write(m_Slimes.size());
+    for (const Slime& SlimeEnemy : m_Slimes)
+    {
+        SlimeEnemy.SaveState(Out);
+    }
+    return true;
+}
+
+bool DemoLevel::b_RestoreSnapshot(MapSnapshot& In)
+{
+    size_t SlimeCount = 0;
+    if (!m_Player.RestoreState(In) || !In.b_Read(m_Camera) || !In.b_Read(SlimeCount))
+    {
+        return false;
+    }
+
+    // Slimes added since the snapshot reuse the loaded texture and sound
+    while (m_Slimes.size() < SlimeCount)
+    {
+        Slime SlimeEnemy;
+        SlimeEnemy.Initialize(m_SlimeTexture, m_SlimeDeathSound, GetAudio(), { 0, 0 });
+        m_Slimes.push_back(SlimeEnemy);
+    }
+    m_Slimes.resize(SlimeCount);
+
+    for (Slime& SlimeEnemy : m_Slimes)
+    {
+        if (!SlimeEnemy.RestoreState(In))
+        {
+            return false;
+        }
+    }
+
+    // Ground chunks follow the restored player position
+    StreamWorld();
+    return true;
+}
+
+size_t DemoLevel::GetEntityCount() const
+{
+    // Player, slimes still in play and the streamed ground columns
+    const size_t SLIMES = std::count_if
+    (
+        m_Slimes.begin(),
+        m_Slimes.end(),
+        [](const Slime& SlimeEnemy) { return !SlimeEnemy.IsFullyDead(); }
+    );
+    return 1 + SLIMES + m_GroundTiles.size();
+}
+
+inline Rectangle DemoLevel::GetTileRect(int32_t Col, int32_t Row) const
+{
+    return { Col * TileSrcSize, Row * TileSrcSize, TileSrcSize, TileSrcSize };
+}
+
+inline int32_t DemoLevel::PseudoRandom(int32_t X, int32_t Seed) const
+{
+    int32_t Hash = X * 374761393 + Seed * 668265263;
+    Hash = (Hash ^ (Hash >> 13)) * 1274126177;
+    return Hash ^ (Hash >> 16);
+}
+
+void DemoLevel::StreamWorld()
+{
+    m_World.Update(m_Player.GetPosition());
+    if (m_bGroundDirty)
+    {
+        RebuildGroundTiles();
+    }
+}
+
+void DemoLevel::RebuildGroundTiles()
+{
+    m_GroundTiles.clear();
+    for (const t_WorldChunk* Chunk : m_World.GetActiveChunks())
+    {
+        for (const t_ChunkTile& Tile : Chunk->tiles)
+        {
+            m_GroundTiles.push_back({ Tile.rect, Tile.type });
+        }
+    }
+    m_bGroundDirty = false;
+}
+
+void DemoLevel::Update(float DeltaTime)
+{
+    StreamWorld();
+
+    // A pause menu above takes the input (and stops this Update entirely)
+    if (b_HasInputFocus())
+    {
+        m_Player.HandleInput(GetInput(), DeltaTime);
+
+        if (GetInput().b_IsKeyPressed(KEY_P))
+        {
+            RequestPushLayer("DemoPause", { .order = 200, .b_ConsumesInput = true, .b_PausesBelow = true });
+        }
+    }
+    m_Player.Update(DeltaTime);
+    m_Player.ApplyGravity(DeltaTime, s_Gravity.Get());
+    m_Player.ResolveCollisions(DeltaTime, m_GroundTiles);
+    
+    m_Player.ClampToLevel(m_LevelLeft + 32.0f, m_LevelRight - 32.0f);
+    
+    m_Camera.FollowTarget(m_Player.GetPosition(), DeltaTime, 5.0f);
+    
+    // Update slimes
+    for (auto& SlimeEnemy : m_Slimes)
+    {
+        SlimeEnemy.Update(DeltaTime);
+    }
+    
+    // Check player attack vs slimes
+    if (m_Player.IsAttacking())
+    {
+        Rectangle AttackHitbox = m_Player.GetAttackHitbox();
+        for (auto& SlimeEnemy : m_Slimes)
+        {
+            if (SlimeEnemy.IsAlive() && !SlimeEnemy.IsDying())
+            {
+                Rectangle SlimeHitbox = SlimeEnemy.GetHitbox();
+                if (CheckCollisionRecs(AttackHitbox, SlimeHitbox))
+                {
+                    SlimeEnemy.TakeDamage();
+                }
+            }
+        }
+    }
+    
+    if (m_Player.GetPosition().y > 1000)
+    {
+        Reset();
+    }
+}
+
+void DemoLevel::Draw()
+{
+    ClearBackground(Color{ 20, 24, 46, 255 });
+    m_Camera.Begin();
+
+    DrawBackground();
+    DrawTrees(FloorY);
+    DrawGround(FloorY);
+    DrawSparkles();
+    DrawSlimes();
+    m_Player.Draw();
+    m_Camera.End();
+}
+
+void DemoLevel::DrawBackground()
+{
+    DrawRectangle(-10000, -10000, 20000, 20000, Color{ 40, 48, 70, 255 });
+
+    float GroundCamY = 300.0f;
+    Vector2 CamTarget = m_Camera.GetTarget();
+
+    for (size_t i = 0; i < m_BackgroundLayers.size(); ++i)
+    {
+        Texture2D& Tex = m_BackgroundLayers[i];
+        
+        if (Tex.id <= 0)
+        {
+            continue;
+        }
+        
+        float Speed = 0.05f + (i * 0.15f);
+        float Scale = 2.0f;
+        float ScaledW = static_cast<float>(Tex.width) * Scale;
+        float ScaledH = static_cast<float>(Tex.height) * Scale;
+        
+        float BgX = CamTarget.x * (1.0f - Speed);
+        float AlignedX = floor(BgX / ScaledW) * ScaledW;
+        
+        float Overlap = 64.0f;
+        float Offset = (FloorY - ScaledH) - (GroundCamY * (1.0f - Speed)) + Overlap;
+        float BgY = CamTarget.y * (1.0f - Speed) + Offset;
+        
+        for (int32_t k = -1; k <= 2; ++k)
+        {
+            DrawTextureProCounted(
+                Tex,
+                { 0, 0, static_cast<float>(Tex.width), static_cast<float>(Tex.height) },
+                { AlignedX + k * ScaledW, BgY, ScaledW, ScaledH },
+                { 0, 0 },
+                0,
+                WHITE
+            );
+        }
+    }
+    
+    DrawRectangle(-2000, static_cast<int>(FloorY + TileRenderSize), 5000, 1000, Color{ 15, 12, 22, 255 });
+}
+
+void DemoLevel::DrawTrees(float InFloorY)
+{
+    auto DrawTree = [&](float X, float Y)
+    {
+        Rectangle Src = { 160, 0, 128, 128 };
+        Rectangle Dst = { X - 128, Y - 256 + 32, 256, 256 };
+        DrawTextureProCounted(m_TilesetTex, Src, Dst, { 0, 0 }, 0, WHITE);
+    };
+    
+    DrawTree(200, InFloorY);
+    DrawTree(900, InFloorY);
+    DrawTree(1500, InFloorY);
+}
+
+void DemoLevel::DrawGround(float InFloorY)
+{
+    const int32_t SurfacePattern[] = { 9, 10, 9, 4, 5, 6, 7, 8 };
+    const int32_t SurfacePatternLen = 8;
+    const int32_t UnderPattern[] = { 8, 9 };
+    const int32_t UnderPatternLen = 2;
+    const int32_t DeepUnderPattern[] = { 0, 1, 2 };
+    const int32_t TileOffset[] = { 4, 5, 3, 6, 3, 5 };
+    int32_t DeepUnderPatternLen = 3;
+
+    // A column is its surface tile plus six below it
+    const bool bCull = s_CullGround.Get();
+    const Rectangle View = m_Camera.GetVisibleRect();
+
+    for (const auto& Tile : m_GroundTiles)
+    {
+        if (bCull)
+        {
+            Rectangle Column = Tile.Rect;
+            Column.height += 6 * TileRenderSize;
+            if (!CheckCollisionRecs(Column, View))
+            {
+                continue;
+            }
+        }
+
+        const int32_t TileIndex = Tile.Type;
+        int32_t SurfaceCol = SurfacePattern[TileIndex % SurfacePatternLen];
+        DrawTextureProCounted(m_TilesetTex, GetTileRect(SurfaceCol, 8), Tile.Rect, { 0, 0 }, 0, WHITE);
+        
+        for (int32_t Depth = 1; Depth <= 6; ++Depth)
+        {
+            Rectangle DeepRect = Tile.Rect;
+            DeepRect.y += Depth * TileRenderSize;
+
+            if (Depth <= 1)
+            {
+                int32_t UnderCol = UnderPattern[TileIndex % UnderPatternLen];
+                DrawTextureProCounted(m_TilesetTex, GetTileRect(UnderCol, 9), DeepRect, { 0, 0 }, 0, WHITE);
+            }
+            else
+            {
+                DeepUnderPatternLen = TileOffset[Depth - 1]; 
+                int32_t UnderCol = DeepUnderPattern[TileIndex % DeepUnderPatternLen];
+                DrawTextureProCounted(m_TilesetTex, GetTileRect(UnderCol, 9), DeepRect, { 0, 0 }, 0, WHITE);
+            }
+        }
+    }
+}
+
+void DemoLevel::DrawSparkles()
+{
+    double Time = GetTime();
+    
+    for (int32_t s = 0; s < 12; ++s)
+    {
+        float SparkleX = 50.0f + s * 120.0f + static_cast<float>(sin(Time * 0.5 + s)) * 8.0f;
+        float SparkleY = 280.0f + static_cast<float>(cos(Time * 0.3 + s * 0.7)) * 40.0f;
+        float Alpha = (static_cast<float>(sin(Time * 2.0 + s)) + 1.0f) * 0.4f;
+        
+        DrawCircle(
+            static_cast<int>(SparkleX),
+            static_cast<int>(SparkleY),
+            2,
+            Color{ 255, 230, 180, static_cast<unsigned char>(Alpha * 200) }
+        );
+    }
+}
+
+void DemoLevel::DrawSlimes()
+{
+    for (auto& SlimeEnemy : m_Slimes)
+    {
+        SlimeEnemy.Draw();
+    }
+}
+
+void DemoLevel::DrawDebugTileset()
+{
+    float Scale = 2.0f;
+    float StartX = 50;
+    float StartY = 80;
+    
+    DrawTextureExCounted(m_TilesetTex, { StartX, StartY }, 0, Scale, WHITE);
+    DrawRectangleLinesEx(
+        Rectangle{ StartX, StartY, m_TilesetTex.width * Scale, m_TilesetTex.height * Scale },
+        2.0f,
+        YELLOW
+    );
+    
+    float YLedge = 64.0f;
+    float YGround = 128.0f;
+    
+    DrawRectangleLinesEx(
+        Rectangle{ StartX, StartY + (YGround * Scale), m_TilesetTex.width * Scale, 16 * Scale },
+        2.0f,
+        Color{ 255, 0, 0, 255 }
+    );
+    DrawRectangleLinesEx(
+        Rectangle{ StartX, StartY + (YLedge * Scale), m_TilesetTex.width * Scale, 16 * Scale },
+        2.0f,
+        Color{ 0, 255, 0, 255 }
+    );
+}
@@ -1,5 +1,6 @@
 #pragma once
-#include "../Engine/GameMap.h"
+#include "../../Engine/GameMap.h"
+#include "../../Engine/WorldStreamer.h"
 #include "Player.h"
 #include "GameCamera.h"
 #include "Slime.h"
@@ -24,6 +25,11 @@ private:
     void DrawSparkles();
     void DrawSlimes();
     void DrawDebugTileset();
+    void StreamWorld();
+    void RebuildGroundTiles();
+    void PushOverlays();
+    void RemoveOverlays();
+    bool LoadGroundChunk(t_ChunkCoord Coord, t_WorldChunk& Chunk) const;
 
     Player m_Player;
     GameCamera m_Camera;
@@ -35,7 +41,14 @@ private:
     std::vector<Texture2D> m_BackgroundLayers;
     std::vector<GroundTile> m_GroundTiles;
 
-    static constexpr float GRAVITY = 1200.0f;
+    // Ground is streamed in chunks around the player
+    WorldStreamer m_World;
+    bool m_bGroundDirty = false;
+
+    // From the level file, set in Initialize
+    const t_LevelLayer* m_pGroundLayer = nullptr;
+    float m_LevelLeft = 0.0f;
+    float m_LevelRight = 0.0f;
 
 public:
     DemoLevel();
@@ -43,5 +56,10 @@ public:
     void Initialize() override;
     void Update(float DeltaTime) override;
     void Draw() override;
+    void OnSuspend() override;
+    void OnResume() override;
+    bool b_SaveSnapshot(MapSnapshot& Out) const override;
+    bool b_RestoreSnapshot(MapSnapshot& In) override;
+    size_t GetEntityCount() const override;
     void Reset();
 };
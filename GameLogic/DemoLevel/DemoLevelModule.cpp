@@ -0,0 +1,35 @@
+#include "../../Engine/MapManager.h"
+#include "../GameLogicExport.h"
+#include "DemoLevel.h"
+#include "DemoHud.h"
+#include "DemoPauseMenu.h"
+
+// Called by the loader once the main GameLogic has created the manager,
+// and again each time this module is rebuilt. Only the maps registered
+// here are torn down when that happens; the menu keeps running.
+GAME_LOGIC_EXPORT void RegisterGameMaps(MapManager* manager)
+{
+    manager->RegisterMap<DemoLevel>
+    (
+        "DemoLevel",
+        "Platformer demo level",
+        {
+            .assets =
+            {
+                "Assets/player.png",
+                "Assets/tileset.png",
+                "Assets/slime.png",
+                "Assets/background_0.png",
+                "Assets/background_1.png",
+                "Assets/background_2.png",
+                "Assets/Sounds/jump.wav",
+                "Assets/Sounds/attack.wav",
+                "Assets/Sounds/slime_death.wav"
+            }
+        }
+    );
+
+    // Overlays DemoLevel stacks on itself as layers
+    manager->RegisterMap<DemoHud>("DemoHud", "Level HUD overlay");
+    manager->RegisterMap<DemoPauseMenu>("DemoPause", "Pause menu overlay");
+}
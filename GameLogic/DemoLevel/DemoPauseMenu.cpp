@@ -0,0 +1,38 @@
+#include "DemoPauseMenu.h"
+
+DemoPauseMenu::DemoPauseMenu()
+    : GameMap("Pause Menu")
+{
+}
+
+void DemoPauseMenu::Update(float DeltaTime)
+{
+    if (!b_HasInputFocus())
+    {
+        return;
+    }
+
+    const InputState& Input = GetInput();
+    if (Input.b_IsKeyPressed(KEY_P) || Input.b_IsKeyPressed(KEY_ENTER))
+    {
+        RequestRemoveLayer("DemoPause");
+    }
+    else if (Input.b_IsKeyPressed(KEY_Q))
+    {
+        RequestRemoveLayer("DemoPause");
+        RequestGotoMap("DemoMainMenu");
+    }
+}
+
+void DemoPauseMenu::Draw()
+{
+    const int32_t ScreenWidth = GetScreenWidth();
+    const int32_t ScreenHeight = GetScreenHeight();
+
+    DrawRectangle(0, 0, ScreenWidth, ScreenHeight, Color{ 10, 10, 20, 160 });
+
+    const char* Title = "PAUSED";
+    const char* Hint = "P / Enter: Resume    Q: Main Menu";
+    DrawText(Title, (ScreenWidth - MeasureText(Title, 60)) / 2, ScreenHeight / 2 - 60, 60, WHITE);
+    DrawText(Hint, (ScreenWidth - MeasureText(Hint, 20)) / 2, ScreenHeight / 2 + 20, 20, Color{ 200, 200, 200, 255 });
+}
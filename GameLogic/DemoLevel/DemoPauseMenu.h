@@ -0,0 +1,14 @@
+#pragma once
+#include "../../Engine/GameMap.h"
+#include <raylib.h>
+
+// Pause overlay pushed by DemoLevel; takes the input and freezes the level
+class DemoPauseMenu : public GameMap
+{
+public:
+    DemoPauseMenu();
+    ~DemoPauseMenu() override = default;
+
+    void Update(float DeltaTime) override;
+    void Draw() override;
+};
@@ -1,4 +1,5 @@
 #include "GameCamera.h"
+#include "../../Engine/EngineStats.h"
 
 GameCamera::GameCamera()
     : m_BoundsLeft(0)
@@ -80,10 +81,27 @@ void GameCamera::SetMinZoom(float MinZoom)
 
 void GameCamera::Begin() const
 {
+    // Changing the matrix flushes rlgl's batch
+    EngineStats::Get().BreakBatch();
     BeginMode2D(m_Camera);
 }
 
 void GameCamera::End() const
 {
+    EngineStats::Get().BreakBatch();
     EndMode2D();
 }
+
+Rectangle GameCamera::GetVisibleRect() const
+{
+    const float Margin = 32.0f;
+    const float VisibleWidth = GetScreenWidth() / m_Camera.zoom;
+    const float VisibleHeight = GetScreenHeight() / m_Camera.zoom;
+    return
+    {
+        m_Camera.target.x - VisibleWidth / 2.0f - Margin,
+        m_Camera.target.y - VisibleHeight / 2.0f - Margin,
+        VisibleWidth + 2.0f * Margin,
+        VisibleHeight + 2.0f * Margin
+    };
+}
@@ -20,6 +20,9 @@ public:
     Camera2D GetRaylibCamera() const { return m_Camera; }
     Vector2 GetTarget() const { return m_Camera.target; }
     float GetZoom() const { return m_Camera.zoom; }
+
+    // World-space area on screen, one tile of margin on each side
+    Rectangle GetVisibleRect() const;
     
 private:
     Camera2D m_Camera;
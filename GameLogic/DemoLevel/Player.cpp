@@ -1,7 +1,13 @@
 #include "Player.h"
 #include "DemoLevel.h"
+#include "../../Engine/CVar.h"
+#include "../../Engine/EngineStats.h"
+#include "../../Engine/Logger.h"
 #include <cmath>
 
+static CVar<float> s_Speed("player.speed", 200.0f, 0.0f, 1000.0f, "Horizontal run speed (px/s)");
+static CVar<float> s_JumpForce("player.jump_force", -550.0f, -2000.0f, 0.0f, "Vertical velocity at the start of a jump (px/s, negative is up)");
+
 Player::Player()
     : m_Position{ 0, 0 }
     , m_Velocity{ 0, 0 }
@@ -10,35 +16,51 @@ Player::Player()
     , m_bIsAttacking(false)
     , m_AttackTimer(0.0f)
     , m_AttackFrame(0)
+    , m_Assets(nullptr)
+    , m_Audio(nullptr)
 {
 }
 
 Player::~Player()
 {
-    UnloadTexture(m_Texture);
-    UnloadSound(m_JumpSound);
-    UnloadSound(m_AttackSound);
+    if (m_Assets)
+    {
+        m_Assets->UnloadTexture(m_Texture);
+    }
+    else
+    {
+        UnloadTexture(m_Texture);
+    }
+
+    if (m_Audio)
+    {
+        m_Audio->UnloadSound(m_JumpSound);
+        m_Audio->UnloadSound(m_AttackSound);
+    }
+    else
+    {
+        UnloadSound(m_JumpSound);
+        UnloadSound(m_AttackSound);
+    }
 }
 
-void Player::Initialize(const char* TexturePath)
+void Player::Initialize(const AssetManager& Assets, AudioMixer& Audio, const char* TexturePath)
 {
-    m_Texture = LoadTexture(TexturePath);
-    LoadSounds();
+    m_Assets = &Assets;
+    m_Audio = &Audio;
+    m_Texture = Assets.LoadTexture(TexturePath);
+    LoadSounds(Assets);
 }
 
-void Player::LoadSounds()
+void Player::LoadSounds(const AssetManager& Assets)
 {
-    if (!IsAudioDeviceReady()) 
-    {
-        InitAudioDevice();
-    }
-
-    m_JumpSound = LoadSound("Assets/Sounds/jump.wav");
-    m_AttackSound = LoadSound("Assets/Sounds/attack.wav");
+    // The audio device is owned by the engine's AudioMixer
+    m_JumpSound = Assets.LoadSound("Assets/Sounds/jump.wav");
+    m_AttackSound = Assets.LoadSound("Assets/Sounds/attack.wav");
     
-    std::cout << "[Player] Audio Device Ready: " << IsAudioDeviceReady() << std::endl;
-    std::cout << "[Player] Jump Sound Loaded: " << (m_JumpSound.frameCount > 0) << std::endl;
-    std::cout << "[Player] Attack Sound Loaded: " << (m_AttackSound.frameCount > 0) << std::endl;
+    RW_LOG_DEBUG("Player", "Audio Device Ready: {}", IsAudioDeviceReady());
+    RW_LOG_DEBUG("Player", "Jump Sound Loaded: {}", (m_JumpSound.frameCount > 0));
+    RW_LOG_DEBUG("Player", "Attack Sound Loaded: {}", (m_AttackSound.frameCount > 0));
 }
 
 void Player::Reset(Vector2 StartPosition)
@@ -52,27 +74,28 @@ void Player::Reset(Vector2 StartPosition)
     m_AttackFrame = 0;
 }
 
-void Player::HandleInput(float DeltaTime)
+void Player::HandleInput(const InputState& Input, float DeltaTime)
 {
     // Attack input - left mouse button
-    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !m_bIsAttacking)
+    if (Input.b_IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !m_bIsAttacking)
     {
         m_bIsAttacking = true;
         m_AttackTimer = 0.0f;
         m_AttackFrame = 0;
-        if (m_AttackSound.frameCount > 0) PlaySound(m_AttackSound);
+        if (m_Audio) m_Audio->Play(m_AttackSound);
     }
     
     // Movement speed modifier (slower while attacking)
-    float MoveSpeed = m_bIsAttacking ? SPEED * 0.3f : SPEED;
+    const float Speed = s_Speed.Get();
+    float MoveSpeed = m_bIsAttacking ? Speed * 0.3f : Speed;
     
     // Movement
-    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D))
+    if (Input.b_IsKeyDown(KEY_RIGHT) || Input.b_IsKeyDown(KEY_D))
     {
         m_Velocity.x = MoveSpeed;
         m_bFacingRight = true;
     }
-    else if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A))
+    else if (Input.b_IsKeyDown(KEY_LEFT) || Input.b_IsKeyDown(KEY_A))
     {
         m_Velocity.x = -MoveSpeed;
         m_bFacingRight = false;
@@ -83,11 +106,11 @@ void Player::HandleInput(float DeltaTime)
     }
 
     // Jump (always allowed)
-    if ((IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) && m_bIsGrounded)
+    if ((Input.b_IsKeyPressed(KEY_SPACE) || Input.b_IsKeyPressed(KEY_UP) || Input.b_IsKeyPressed(KEY_W)) && m_bIsGrounded)
     {
-        m_Velocity.y = JUMP_FORCE;
+        m_Velocity.y = s_JumpForce.Get();
         m_bIsGrounded = false;
-        if (m_JumpSound.frameCount > 0) PlaySound(m_JumpSound);
+        if (m_Audio) m_Audio->Play(m_JumpSound);
     }
 }
 
@@ -212,7 +235,7 @@ void Player::Draw()
             Source.width *= -1;
         }
         
-        DrawTexturePro(
+        DrawTextureProCounted(
             m_Texture,
             Source,
             { m_Position.x - 16, m_Position.y - 16 + 32, 64, 64 },
@@ -247,7 +270,7 @@ void Player::Draw()
         Source.width *= -1;
     }
     
-    DrawTexturePro(
+    DrawTextureProCounted(
         m_Texture,
         Source,
         { m_Position.x - 16, m_Position.y - 16 + 32, 64, 64 },
@@ -277,3 +300,25 @@ Rectangle Player::GetAttackHitbox() const
         HitboxHeight
     };
 }
+
+void Player::SaveState(MapSnapshot& Out) const
+{
+    Out.Write(m_Position);
+    Out.Write(m_Velocity);
+    Out.Write(m_bIsGrounded);
+    Out.Write(m_bFacingRight);
+    Out.Write(m_bIsAttacking);
+    Out.Write(m_AttackTimer);
+    Out.Write(m_AttackFrame);
+}
+
+bool Player::RestoreState(MapSnapshot& In)
+{
+    return In.b_Read(m_Position) &&
+           In.b_Read(m_Velocity) &&
+           In.b_Read(m_bIsGrounded) &&
+           In.b_Read(m_bFacingRight) &&
+           In.b_Read(m_bIsAttacking) &&
+           In.b_Read(m_AttackTimer) &&
+           In.b_Read(m_AttackFrame);
+}
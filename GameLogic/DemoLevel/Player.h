@@ -1,6 +1,10 @@
 #pragma once
 #include <raylib.h>
 #include <vector>
+#include "../../Engine/AssetManager.h"
+#include "../../Engine/AudioMixer.h"
+#include "../../Engine/InputState.h"
+#include "../../Engine/MapSnapshot.h"
 
 struct GroundTile;
 
@@ -10,10 +14,10 @@ public:
     Player();
     ~Player();
     
-    void Initialize(const char* TexturePath);
-    void LoadSounds();
+    void Initialize(const AssetManager& Assets, AudioMixer& Audio, const char* TexturePath);
+    void LoadSounds(const AssetManager& Assets);
     void Reset(Vector2 StartPosition);
-    void HandleInput(float DeltaTime);
+    void HandleInput(const InputState& Input, float DeltaTime);
     void Update(float DeltaTime);
     void ApplyGravity(float DeltaTime, float Gravity);
     void ResolveCollisions(float DeltaTime, const std::vector<GroundTile>& Tiles);
@@ -30,6 +34,10 @@ public:
     void SetPosition(Vector2 NewPosition) { m_Position = NewPosition; }
     void SetVelocity(Vector2 NewVelocity) { m_Velocity = NewVelocity; }
 
+    // Gameplay state for map snapshots; textures and sounds stay as loaded
+    void SaveState(MapSnapshot& Out) const;
+    bool RestoreState(MapSnapshot& In);
+
 private:
     Texture2D m_Texture;
     Vector2 m_Position;
@@ -40,13 +48,15 @@ private:
     bool m_bIsAttacking;
     float m_AttackTimer;
     int32_t m_AttackFrame;
+
+    // Loader of m_Texture, so unloading also stops hot-reload tracking
+    const AssetManager* m_Assets;
+    AudioMixer* m_Audio;
     
     // Sounds
     Sound m_JumpSound;
     Sound m_AttackSound;
     
-    static constexpr float SPEED = 200.0f;
-    static constexpr float JUMP_FORCE = -550.0f;
     static constexpr float HITBOX_WIDTH = 64.0f;
     static constexpr float HITBOX_HEIGHT = 64.0f;
     static constexpr float HITBOX_OFFSET_X = 16.0f;
@@ -1,8 +1,13 @@
 #include "Slime.h"
+#include "../../Engine/CVar.h"
+#include "../../Engine/EngineStats.h"
 #include <cmath>
 
+static CVar<float> s_Speed("slime.speed", 50.0f, 0.0f, 500.0f, "Patrol speed of slimes (px/s)");
+
 Slime::Slime()
-    : m_Position{ 0, 0 }
+    : m_Audio(nullptr)
+    , m_Position{ 0, 0 }
     , m_Velocity{ 0, 0 }
     , m_bIsAlive(true)
     , m_bIsDying(false)
@@ -16,12 +21,13 @@ Slime::Slime()
 {
 }
 
-void Slime::Initialize(Texture2D Texture, Sound DeathSound, Vector2 StartPosition)
+void Slime::Initialize(Texture2D Texture, Sound DeathSound, AudioMixer& Audio, Vector2 StartPosition)
 {
     m_Texture = Texture;
     m_DeathSound = DeathSound;
+    m_Audio = &Audio;
     m_Position = StartPosition;
-    m_Velocity = { SPEED, 0 };
+    m_Velocity = { s_Speed.Get(), 0 };
     m_bFacingRight = true;
 }
 
@@ -50,20 +56,21 @@ void Slime::Update(float DeltaTime)
     m_AnimTimer += DeltaTime * ANIM_SPEED;
     m_CurrentFrame = static_cast<int32_t>(m_AnimTimer) % FRAME_COUNT;
     
-    // Patrol movement
+    // Patrol movement; the speed is re-read so slime.speed applies live
+    m_Velocity.x = m_bFacingRight ? s_Speed.Get() : -s_Speed.Get();
     m_Position.x += m_Velocity.x * DeltaTime;
     
     // Turn around at patrol bounds
     if (m_Position.x <= m_PatrolLeft)
     {
         m_Position.x = m_PatrolLeft;
-        m_Velocity.x = SPEED;
+        m_Velocity.x = s_Speed.Get();
         m_bFacingRight = true;
     }
     else if (m_Position.x >= m_PatrolRight)
     {
         m_Position.x = m_PatrolRight;
-        m_Velocity.x = -SPEED;
+        m_Velocity.x = -s_Speed.Get();
         m_bFacingRight = false;
     }
 }
@@ -116,7 +123,7 @@ void Slime::Draw()
         TintColor.a = static_cast<unsigned char>(Alpha * 255);
     }
     
-    DrawTexturePro(
+    DrawTextureProCounted(
         m_Texture,
         Source,
         Dest,
@@ -160,6 +167,36 @@ void Slime::TakeDamage()
         m_DeathTimer = 0.0f;
         m_DeathFrame = 0;
         m_Velocity = { 0, 0 };
-        if (m_DeathSound.frameCount > 0) PlaySound(m_DeathSound);
+        if (m_Audio) m_Audio->Play(m_DeathSound, { .priority = c_SOUND_PRIORITY_LOW });
     }
 }
+
+void Slime::SaveState(MapSnapshot& Out) const
+{
+    Out.Write(m_Position);
+    Out.Write(m_Velocity);
+    Out.Write(m_bIsAlive);
+    Out.Write(m_bIsDying);
+    Out.Write(m_bFacingRight);
+    Out.Write(m_AnimTimer);
+    Out.Write(m_CurrentFrame);
+    Out.Write(m_DeathTimer);
+    Out.Write(m_DeathFrame);
+    Out.Write(m_PatrolLeft);
+    Out.Write(m_PatrolRight);
+}
+
+bool Slime::RestoreState(MapSnapshot& In)
+{
+    return In.b_Read(m_Position) &&
+           In.b_Read(m_Velocity) &&
+           In.b_Read(m_bIsAlive) &&
+           In.b_Read(m_bIsDying) &&
+           In.b_Read(m_bFacingRight) &&
+           In.b_Read(m_AnimTimer) &&
+           In.b_Read(m_CurrentFrame) &&
+           In.b_Read(m_DeathTimer) &&
+           In.b_Read(m_DeathFrame) &&
+           In.b_Read(m_PatrolLeft) &&
+           In.b_Read(m_PatrolRight);
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include <raylib.h>
+#include "../../Engine/AudioMixer.h"
+#include "../../Engine/MapSnapshot.h"
 #include <cstdint>
 
 class Slime
@@ -7,7 +9,7 @@ class Slime
 public:
     Slime();
     
-    void Initialize(Texture2D Texture, Sound DeathSound, Vector2 StartPosition);
+    void Initialize(Texture2D Texture, Sound DeathSound, AudioMixer& Audio, Vector2 StartPosition);
     void Update(float DeltaTime);
     void Draw();
     
@@ -20,9 +22,14 @@ public:
     void SetPatrolBounds(float Left, float Right);
     void TakeDamage();
 
+    // Gameplay state for map snapshots; texture and sound stay as loaded
+    void SaveState(MapSnapshot& Out) const;
+    bool RestoreState(MapSnapshot& In);
+
 private:
     Texture2D m_Texture;
     Sound m_DeathSound;
+    AudioMixer* m_Audio;
     Vector2 m_Position;
     Vector2 m_Velocity;
     
@@ -39,7 +46,6 @@ private:
     float m_PatrolLeft;
     float m_PatrolRight;
     
-    static constexpr float SPEED = 50.0f;
     static constexpr float FRAME_WIDTH = 32.0f;
     static constexpr float FRAME_HEIGHT = 32.0f;
     static constexpr int32_t FRAME_COUNT = 4;
@@ -1,6 +1,7 @@
 #include "DemoMainMenu.h"
 #include "../Engine/MapManager.h"
-#include <iostream>
+#include "../Engine/EngineStats.h"
+#include "../Engine/Logger.h"
 #include <cmath>
 
 DemoMainMenu::DemoMainMenu() 
@@ -10,11 +11,12 @@ DemoMainMenu::DemoMainMenu()
 
 void DemoMainMenu::Initialize()
 {
-    m_TitleFont = LoadFontEx("Assets/EngineContent/Roboto-Regular.ttf", 64, 0, 0);
-    m_Background = LoadTexture("Assets/menu_background.png");
-    m_SelectSound = LoadSound("Assets/Sounds/menu_select.wav");
+    AssetManager& Assets = GetAssets();
+    m_TitleFont = Assets.LoadFont("Assets/EngineContent/Roboto-Regular.ttf", 64);
+    m_Background = Assets.LoadTexture("Assets/menu_background.png");
+    m_SelectSound = Assets.LoadSound("Assets/Sounds/menu_select.wav");
     
-    std::cout << "[DemoMainMenu] Initialized" << std::endl;
+    RW_LOG_INFO("DemoMainMenu", "Initialized");
 }
 
 void DemoMainMenu::Update(float DeltaTime)
@@ -22,28 +24,34 @@ void DemoMainMenu::Update(float DeltaTime)
     m_Time += DeltaTime;
     m_PulseScale = 1.0f + sin(m_Time * 3.0f) * 0.05f;
 
+    if (!b_HasInputFocus())
+    {
+        return;
+    }
+
     // Navigation
-    if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S))
+    const InputState& Input = GetInput();
+    if (Input.b_IsKeyPressed(KEY_DOWN) || Input.b_IsKeyPressed(KEY_S))
     {
         m_SelectedOption = (m_SelectedOption + 1) % 2;
     }
     
-    if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W))
+    if (Input.b_IsKeyPressed(KEY_UP) || Input.b_IsKeyPressed(KEY_W))
     {
         m_SelectedOption = (m_SelectedOption - 1 + 2) % 2;
     }
 
     // Selection
-    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE))
+    if (Input.b_IsKeyPressed(KEY_ENTER) || Input.b_IsKeyPressed(KEY_SPACE))
     {
-        PlaySound(m_SelectSound);
+        GetAudio().Play(m_SelectSound, { .priority = c_SOUND_PRIORITY_HIGH });
         if (m_SelectedOption == OPTION_PLAY)
         {
             RequestGotoMap("DemoLevel");
         }
         else if (m_SelectedOption == OPTION_EXIT)
         {
-            std::cout << "Exit Requested" << std::endl;
+            RW_LOG_INFO("DemoMainMenu", "Exit requested");
             CloseWindow();
         }
     }
@@ -66,7 +74,7 @@ void DemoMainMenu::Draw()
     float OffsetX = (ScreenWidth - ScaledWidth) / 2.0f;
     float OffsetY = (ScreenHeight - ScaledHeight) / 2.0f;
     
-    DrawTexturePro(
+    DrawTextureProCounted(
         m_Background, 
         Rectangle{ 0, 0, BgWidth, BgHeight },
         Rectangle{ OffsetX, OffsetY, ScaledWidth, ScaledHeight },
@@ -115,3 +123,16 @@ void DemoMainMenu::Draw()
         DrawTextEx(m_TitleFont, Options[i], TextPos, FontSize, 2, TextColor);
     }
 }
+
+bool DemoMainMenu::b_SaveSnapshot(MapSnapshot& Out) const
+{
+    Out.Write(m_SelectedOption);
+    Out.Write(m_Time);
+    Out.Write(m_PulseScale);
+    return true;
+}
+
+bool DemoMainMenu::b_RestoreSnapshot(MapSnapshot& In)
+{
+    return In.b_Read(m_SelectedOption) && In.b_Read(m_Time) && In.b_Read(m_PulseScale);
+}
@@ -26,4 +26,6 @@ public:
     void Initialize() override;
     void Update(float delta_time) override;
     void Draw() override;
+    bool b_SaveSnapshot(MapSnapshot& Out) const override;
+    bool b_RestoreSnapshot(MapSnapshot& In) override;
 };
@@ -0,0 +1,12 @@
+#pragma once
+#include "EngineExport.h"
+
+// Entry points the editor and runtime look up in logic libraries:
+//
+//   GameLogic.dll            GameMap* CreateGameMap()
+//   GameLogic_<Name>.dll     void RegisterGameMaps(MapManager* manager)
+//
+// Each GameLogic/<Name>/ folder builds into its own module library, which
+// registers its maps into the manager GameLogic created and is hot-reloaded
+// on its own when it is rebuilt.
+#define GAME_LOGIC_EXPORT ENGINE_EXPORT
@@ -1,25 +1,43 @@
 #include "../Engine/MapManager.h"
+#include "GameLogicExport.h"
 #include "DemoMainMenu.h"
-#include "DemoLevel.h"
 #include <memory>
 
 // Global static instance to ensure consistency across editor and runtime
 static MapManager* s_GameMapManager = nullptr;
 
-extern "C" __declspec(dllexport) GameMap* CreateGameMap()
+GAME_LOGIC_EXPORT GameMap* CreateGameMap()
 {
     // If we already have a manager, reuse it to maintain map registrations
     if (s_GameMapManager == nullptr)
     {
         s_GameMapManager = new MapManager();
 
-        // Register your game maps - this happens only once
-        s_GameMapManager->RegisterMap<DemoLevel>("DemoLevel");
-        s_GameMapManager->RegisterMap<DemoMainMenu>("DemoMainMenu");
+        // Register your game maps - this happens only once. The manifests
+        // let the manager decode the next map's assets in the background.
+        // The level, its HUD and pause menu live in the DemoLevel module
+        // (GameLogic/DemoLevel), registered by the loader after this returns.
+        s_GameMapManager->RegisterMap<DemoMainMenu>
+        (
+            "DemoMainMenu",
+            "Title screen",
+            {
+                .assets =
+                {
+                    "Assets/EngineContent/Roboto-Regular.ttf",
+                    "Assets/menu_background.png",
+                    "Assets/Sounds/menu_select.wav"
+                },
+                .next_maps = { "DemoLevel" }
+            }
+        );
+
+        // Keep the menu alive while playing so going back to it is instant
+        s_GameMapManager->SetSuspendLimit(1);
     }
 
     // Automatically load the Main Menu
     s_GameMapManager->b_GotoMap("DemoMainMenu");
 
     return s_GameMapManager;
-}
\ No newline at end of file
+}